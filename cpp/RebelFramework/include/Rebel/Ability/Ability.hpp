@@ -4,75 +4,107 @@
 #pragma once
 
 #include "Rebel/Core.hpp"
+#include "Rebel/Ability/AbilityDescription.hpp"
 #include "Rebel/Ability/AbilityImprovement.hpp"
 #include <godot_cpp/classes/resource.hpp>
 #include <godot_cpp/classes/texture2d.hpp>
+#include <godot_cpp/templates/list.hpp>
 #include <godot_cpp/variant/array.hpp>
 #include <godot_cpp/variant/string.hpp>
 
+#include <cstdint>
+
 namespace Rebel::Ability {
 
 /**
  * @brief A single configurable ability that can be unlocked and upgraded.
  *
  * Stores all static data for one ability: identity (name, description, icon),
- * unlock state, unlock cost, and a fixed array of 10 AbilityImprovement slots
- * indexed 0–9 (levels 1–10).
+ * unlock cost, and 10 AbilityImprovement slots indexed 0–9 (levels 1–10).
+ * An Ability is a shared definition — whether it is unlocked and at which
+ * level is per-character data held by an AbilityState.
  *
- * The constructor pre-populates all 10 improvement slots so the Godot Inspector
- * always exposes all slots regardless of how many have been filled in.
+ * Improvements are stored sparsely: a slot only holds its own resource once
+ * the designer authors something for that tier. Unauthored tiers read as a
+ * shared, frozen default, so a library of abilities with one or two upgrade
+ * tiers does not allocate (or load) ten resources each. The Inspector still
+ * shows all 10 tiers as `improvement_N/*` properties; editing one
+ * materializes the slot.
  *
  * Serializable as a .tres file and fully editable in the Godot Inspector.
- *
- * @note current_level == 0 means no improvement is active.
- *       current_level == N means the improvement at index N-1 is active.
  */
 class REBEL_FRAMEWORK Ability : public godot::Resource {
     GDCLASS(Ability, godot::Resource);
 
+    /**
+     * @brief Stable identifier used by AbilityRegistry (e.g. "fireball").
+     *
+     * Survives renames and moves of the resource file; when empty the
+     * resource path stands in for it.
+     */
+    godot::String m_id{};
+
+    /** Cached AbilityRegistry::make_id(m_id); 0 while m_id is empty. */
+    int64_t m_registry_id{0};
+
     /** Display name of the ability. */
     godot::String m_name{};
 
-    /** Description shown in ability selection UI. */
-    godot::String m_description{};
+    /** Description shown in ability selection UI; a template (see AbilityDescription). */
+    AbilityDescription m_description{};
 
     /** Icon representing this ability in the UI. */
     godot::Ref<godot::Texture2D> m_icon{};
 
-    /** Whether this ability has been unlocked/activated. */
-    bool m_enabled{false};
-
     /** Resource cost to unlock this ability. */
     float m_cost{0.0f};
 
     /**
-     * @brief Fixed array of exactly 10 AbilityImprovement resources.
+     * @brief Sparse array of 10 AbilityImprovement slots.
      *
-     * Indexed 0–9, corresponding to upgrade levels 1–10.
-     * Pre-populated in the constructor.
+     * Indexed 0–9, corresponding to upgrade levels 1–10. Null slots are
+     * unauthored and read as the shared default for that level.
      */
     godot::Array m_improvements{};
 
-    /**
-     * @brief Currently active improvement level.
-     *
-     * 0 = no upgrade active. 1–10 = the improvement at index (current_level - 1)
-     * is active.
-     */
-    int m_current_level{0};
-
 protected:
     static void _bind_methods();
 
+    bool _set(const godot::StringName& p_name, const godot::Variant& p_value);
+    bool _get(const godot::StringName& p_name, godot::Variant& r_ret) const;
+    void _get_property_list(godot::List<godot::PropertyInfo>* p_list) const;
+
 public:
     /**
-     * @brief Constructor — pre-populates all 10 improvement slots.
-     *
-     * Ensures the Inspector always shows a full, consistent set of slots even
-     * before the designer has authored any improvements.
+     * @brief Constructor — sizes the improvement array to 10 empty slots.
      */
     Ability();
 
+    /**
+     * @brief Sets the stable identifier of this ability.
+     * @param id Unique string id, e.g. "fireball".
+     */
+    void set_id(const godot::String& id);
+
+    /**
+     * @brief Returns the stable identifier of this ability.
+     * @return The authored id, may be empty.
+     */
+    [[nodiscard]] godot::String get_id() const;
+
+    /**
+     * @brief Returns the key this ability is registered under: its id, or its resource path if the id is empty.
+     */
+    [[nodiscard]] godot::String get_registry_key() const;
+
+    /**
+     * @brief Returns the integer id AbilityRegistry knows this ability by.
+     *
+     * The hash of get_registry_key(), so it is the same across runs and saves.
+     * An ability with neither an id nor a path falls back to its instance id.
+     */
+    [[nodiscard]] int64_t get_registry_id() const;
+
     /**
      * @brief Sets the display name of this ability.
      * @param name Ability name string.
@@ -97,6 +129,19 @@ public:
      */
     [[nodiscard]] godot::String get_description() const;
 
+    /**
+     * @brief Returns the description with its placeholders filled in.
+     *
+     * `{level}` reads @p level and other names read @p attributes. The
+     * result is memoized per attribute set until one of the values it uses
+     * changes; see AbilityDescription.
+     *
+     * @param attributes The character's attributes, or null.
+     * @param level      The character's current level of this ability.
+     * @return The rendered description.
+     */
+    godot::String format_description(const godot::Ref<Attribute::AttributeSet>& attributes, int level = 0);
+
     /**
      * @brief Sets the icon for this ability.
      * @param icon Texture displayed in the UI.
@@ -109,18 +154,6 @@ public:
      */
     [[nodiscard]] godot::Ref<godot::Texture2D> get_icon() const;
 
-    /**
-     * @brief Sets whether this ability is unlocked/active.
-     * @param enabled True if the ability is unlocked.
-     */
-    void set_enabled(bool enabled);
-
-    /**
-     * @brief Returns whether this ability is unlocked/active.
-     * @return True if enabled.
-     */
-    [[nodiscard]] bool get_enabled() const;
-
     /**
      * @brief Sets the resource cost to unlock this ability.
      * @param cost Unlock cost (clamped to >= 0).
@@ -136,44 +169,63 @@ public:
     /**
      * @brief Sets the improvements array.
      *
-     * The array must contain exactly 10 elements of type AbilityImprovement.
-     * Extra elements are ignored; if fewer than 10 are provided, the missing
-     * slots are filled with default AbilityImprovement instances.
+     * Extra elements beyond 10 are ignored. Null entries, shared defaults and
+     * improvements holding only default values become empty slots.
      *
      * @param improvements Array of AbilityImprovement resources.
      */
     void set_improvements(const godot::Array& improvements);
 
     /**
-     * @brief Returns the improvements array (always 10 elements).
-     * @return Array of Ref<AbilityImprovement>.
+     * @brief Returns all 10 improvements, unauthored tiers as shared defaults.
+     * @return Array of Ref<AbilityImprovement>; the defaults are frozen.
      */
     [[nodiscard]] godot::Array get_improvements() const;
 
     /**
-     * @brief Sets the current active upgrade level (0 = none, 1–10 = level).
-     * @param level Level clamped to [0, 10].
+     * @brief Returns the sparse storage array (null for unauthored tiers).
+     *
+     * This is what gets serialized.
      */
-    void set_current_level(int level);
+    [[nodiscard]] godot::Array get_authored_improvements() const;
 
     /**
-     * @brief Returns the current active upgrade level.
-     * @return Integer in [0, 10].
+     * @brief Returns the improvement for @p level (1–10).
+     * @return The authored improvement, the shared default, or null if out of range.
      */
-    [[nodiscard]] int get_current_level() const;
+    [[nodiscard]] godot::Ref<AbilityImprovement> get_improvement(int level) const;
 
     /**
-     * @brief Returns the AbilityImprovement active at the current level.
+     * @brief Replaces the improvement for @p level (1–10); null clears the slot.
+     */
+    void set_improvement(int level, const godot::Ref<AbilityImprovement>& improvement);
+
+    /**
+     * @brief Returns an editable improvement for @p level, allocating it if needed.
+     * @return The slot's own improvement, or null if @p level is out of range.
+     */
+    godot::Ref<AbilityImprovement> materialize_improvement(int level);
+
+    /**
+     * @brief Returns whether @p level has an authored improvement.
+     */
+    [[nodiscard]] bool has_improvement(int level) const;
+
+    /**
+     * @brief Releases the shared default improvements.
      *
-     * @return The active Ref<AbilityImprovement>, or null if current_level is 0.
+     * Called when the extension is unloaded, before the engine shuts down.
      */
-    [[nodiscard]] godot::Ref<AbilityImprovement> get_active_improvement() const;
+    static void free_shared_defaults();
+
+    static constexpr int IMPROVEMENT_COUNT = 10;
 
 private:
-    /** Ensures m_improvements always holds exactly 10 slots. */
+    /** Ensures m_improvements holds exactly 10 slots and drops default-only entries. */
     void normalize_improvements();
 
-    static constexpr int IMPROVEMENT_COUNT = 10;
+    /** Returns the frozen default for @p level, creating the set on first use. */
+    static godot::Ref<AbilityImprovement> get_shared_default(int level);
 };
 
 } // namespace Rebel::Ability
@@ -0,0 +1,90 @@
+// Copyright (c) 2026, and future.
+// Alejandro Morcillo Montejo - All Rights Reserved
+
+#pragma once
+
+#include "Rebel/Core.hpp"
+#include "Rebel/Ability/AbilityScriptContainerNode.hpp"
+#include <godot_cpp/core/gdvirtual.gen.inc>
+
+#include <cstdint>
+
+namespace Rebel::Ability {
+
+class AbilityScheduler;
+
+/**
+ * @brief An ability container whose per-frame update is driven by the AbilityScheduler.
+ *
+ * A plain AbilityScriptContainerNode gets its update from the scene tree:
+ * one process-list entry and one script VM call per active ability. An
+ * AbilityBehaviour instead registers with the AbilityScheduler while it is
+ * active and inside the tree; the scheduler keeps active behaviours grouped
+ * by class in dense arrays and calls tick() on each group in one loop.
+ *
+ * Performance-critical abilities subclass it in C++ and override tick():
+ *
+ * @code
+ * class OrbitingBlades : public AbilityBehaviour {
+ *     GDCLASS(OrbitingBlades, AbilityBehaviour);
+ * public:
+ *     void tick(double delta) override { m_angle += m_speed * delta; ... }
+ * };
+ * @endcode
+ *
+ * Abilities still written in GDScript can implement `_tick(delta)` instead
+ * of `_process(delta)`; the default tick() forwards to it. They pay for the
+ * script call but stay off the scene tree's process list.
+ *
+ * Activation and deactivation go through AbilityTree exactly like any other
+ * container; child nodes (particles, timers) keep processing as usual.
+ */
+class REBEL_FRAMEWORK AbilityBehaviour : public AbilityScriptContainerNode {
+    GDCLASS(AbilityBehaviour, AbilityScriptContainerNode);
+
+    friend class AbilityScheduler;
+
+    /** Index of this behaviour's class group in the scheduler (-1 = not scheduled). */
+    int32_t m_schedule_group{-1};
+
+    /** Index inside the class group. */
+    int32_t m_schedule_slot{-1};
+
+    /** Whether the attached script implements `_tick` (cached on scheduling). */
+    bool m_script_tick{false};
+
+protected:
+    static void _bind_methods();
+
+    void _notification(int p_what);
+
+public:
+    AbilityBehaviour() = default;
+    ~AbilityBehaviour() override;
+
+    /** @brief Activates the container and starts scheduler ticks. */
+    void on_activated() override;
+
+    /** @brief Stops scheduler ticks and deactivates the container. */
+    void on_deactivated() override;
+
+    /**
+     * @brief Per-frame update, called by the AbilityScheduler while active.
+     *
+     * The default implementation forwards to the GDScript virtual `_tick`.
+     *
+     * @param delta Seconds since the last frame.
+     */
+    virtual void tick(double delta);
+
+    /** @brief Returns whether the scheduler is currently ticking this behaviour. */
+    [[nodiscard]] bool is_scheduled() const;
+
+    GDVIRTUAL1(_tick, double)
+
+private:
+    void schedule();
+    void unschedule();
+};
+
+} // namespace Rebel::Ability
@@ -0,0 +1,120 @@
+// Copyright (c) 2026, and future.
+// Alejandro Morcillo Montejo - All Rights Reserved
+
+#pragma once
+
+#include "Rebel/Core.hpp"
+#include <godot_cpp/variant/string.hpp>
+#include <godot_cpp/variant/string_name.hpp>
+
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace Rebel::Attribute {
+class AttributeSet;
+}
+
+namespace Rebel::Ability {
+
+class AbilityBitset;
+
+/** What a compiled condition reads when it is evaluated for one character. */
+struct AbilityConditionContext {
+    const AbilityBitset* enabled{nullptr};
+    std::span<const uint8_t> levels{};
+    Attribute::AttributeSet* attributes{nullptr};
+};
+
+/**
+ * @brief An AbilityNode unlock condition compiled to a small stack bytecode.
+ *
+ * Conditions are authored as text on the node and compiled once when the
+ * tree's graph is built. Every reference is resolved to a node id at compile
+ * time, so evaluation is a tight loop over a few instructions and never
+ * touches a Variant or a Resource:
+ *
+ * @code
+ * at_least(2)                        # any 2 of the prerequisites
+ * all(#0, #1) or level("fireball") >= 3
+ * unlocked(#2) and attr(luck) >= 5
+ * @endcode
+ *
+ * Grammar (`and`/`or`/`not` may also be written `&&`/`||`/`!`):
+ *
+ *   - `all(refs)`, `any(refs)`, `at_least(n, refs)` — prerequisite counts;
+ *     omitting `refs` means every prerequisite of the node.
+ *   - `count(refs)`, `level(ref)`, `attr(name)` — numbers to compare with
+ *     `<`, `<=`, `>`, `>=`, `==`, `!=`.
+ *   - `unlocked(ref)`, `true`, `false`, parentheses.
+ *
+ * A ref names one of the node's own prerequisites, either by position (`#0`)
+ * or by its ability's id or name in quotes. Prerequisite counts over nodes
+ * whose ids share a 64-bit word of the enabled bitset compile to a single
+ * mask-and-popcount instruction.
+ */
+class REBEL_FRAMEWORK AbilityCondition {
+public:
+    enum Opcode : uint8_t {
+        OP_PUSH,            ///< Push value.
+        OP_COUNT_MASK,      ///< Push popcount(enabled word a & mask).
+        OP_COUNT_LIST,      ///< Push how many of ids[a, a + b) are enabled.
+        OP_LEVEL,           ///< Push the level of node a (0 if a < 0).
+        OP_ATTRIBUTE,       ///< Push the value of attribute names[a].
+        OP_NOT,
+        OP_AND,
+        OP_OR,
+        OP_LESS,
+        OP_LESS_EQUAL,
+        OP_GREATER,
+        OP_GREATER_EQUAL,
+        OP_EQUAL,
+        OP_NOT_EQUAL,
+    };
+
+    struct Instruction {
+        Opcode op{OP_PUSH};
+        int32_t a{0};
+        int32_t b{0};
+        float value{0.0f};
+        uint64_t mask{0};
+    };
+
+    /** One prerequisite a condition may refer to, in authored order. */
+    struct PrerequisiteRef {
+        int32_t id{-1};             ///< Node id, -1 if the prerequisite is not in the tree.
+        godot::String key{};        ///< Ability::get_registry_key().
+        godot::String name{};       ///< Ability display name.
+    };
+
+    /** Deepest operand stack a condition may need. */
+    static constexpr int MAX_STACK = 32;
+
+private:
+    std::vector<Instruction> m_code{};
+    std::vector<int32_t> m_ids{};
+    std::vector<godot::StringName> m_attributes{};
+
+public:
+    /**
+     * @brief Compiles @p source against the node's prerequisites.
+     *
+     * On failure the condition compiles to `false`, so the node stays locked.
+     *
+     * @param source        Condition text.
+     * @param prerequisites The node's prerequisites, in authored order.
+     * @param r_error       Set to a description of the first problem.
+     * @return True on success.
+     */
+    bool compile(const godot::String& source, std::span<const PrerequisiteRef> prerequisites, godot::String& r_error);
+
+    /** @brief Runs the program; true if the condition holds. */
+    [[nodiscard]] bool evaluate(const AbilityConditionContext& context) const;
+
+    /** @brief Returns whether the condition reads character attributes. */
+    [[nodiscard]] bool reads_attributes() const { return !m_attributes.empty(); }
+
+    [[nodiscard]] std::span<const Instruction> code() const { return m_code; }
+};
+
+} // namespace Rebel::Ability
@@ -0,0 +1,197 @@
+// Copyright (c) 2026, and future.
+// Alejandro Morcillo Montejo - All Rights Reserved
+
+#pragma once
+
+#include "Rebel/Core.hpp"
+#include "Rebel/Ability/Ability.hpp"
+#include "Rebel/Ability/AbilityTree.hpp"
+#include <godot_cpp/classes/resource.hpp>
+#include <godot_cpp/templates/hash_map.hpp>
+#include <godot_cpp/variant/packed_byte_array.hpp>
+#include <godot_cpp/variant/packed_int32_array.hpp>
+#include <godot_cpp/variant/string.hpp>
+
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace Rebel::Ability {
+
+/**
+ * @brief A whole ability library packed into one versioned byte blob.
+ *
+ * Large libraries authored as nested `.tres` files parse slowly and allocate
+ * one Resource per ability and improvement on load. An AbilityDatabase holds
+ * the same data as an AbilityTree — abilities, their authored improvement
+ * tiers and the node prerequisites — as flat POD records plus a string table
+ * (header, section table, sections; the same layout as RoomLayout).
+ *
+ * Loading a `.abilitydb` file is a single read followed by from_bytes(),
+ * which only validates the header and fixes up the section views. Ability
+ * resources are materialized on first access through get_ability() and
+ * cached, so a session that touches ten abilities of a thousand only ever
+ * allocates ten. Names and costs can be read without materializing anything.
+ *
+ * from_tree() packs an editor-authored tree and build_tree() materializes
+ * the full tree back, so a library round-trips between `.tres` and
+ * `.abilitydb`. Icons are stored by resource path; icons embedded in the
+ * `.tres` itself cannot be referenced and are dropped with a warning.
+ */
+class REBEL_FRAMEWORK AbilityDatabase : public godot::Resource {
+    GDCLASS(AbilityDatabase, godot::Resource);
+
+public:
+    /** Bumped whenever the blob layout below changes. */
+    static constexpr uint32_t FORMAT_VERSION = 3;
+
+    /** A slice of the string table (UTF-8, not null-terminated). */
+    struct StringRef {
+        uint32_t offset;
+        uint32_t length;
+    };
+    static_assert(sizeof(StringRef) == 8);
+
+    /** One ability; its authored improvements are a contiguous run of ImprovementRecords. */
+    struct AbilityRecord {
+        StringRef id;                ///< Registry key (Ability::get_registry_key()).
+        StringRef name;
+        StringRef description;
+        StringRef icon_path;
+        float cost;
+        uint32_t first_improvement;
+        uint32_t improvement_count;
+        uint32_t reserved;
+    };
+    static_assert(sizeof(AbilityRecord) == 48);
+
+    /** One authored improvement tier. */
+    struct ImprovementRecord {
+        StringRef description;
+        StringRef icon_path;
+        float cost;
+        int32_t level;
+    };
+    static_assert(sizeof(ImprovementRecord) == 24);
+
+    /** One tree node; its prerequisites are a run of node ids in the prerequisite section. */
+    struct NodeRecord {
+        int32_t ability;             ///< Index into the ability records, -1 for none.
+        uint32_t first_prerequisite;
+        uint32_t prerequisite_count;
+        uint32_t reserved;
+        StringRef condition;         ///< AbilityNode::get_condition(); empty for the default rule.
+    };
+    static_assert(sizeof(NodeRecord) == 24);
+
+private:
+    /** Owns the serialized bytes; every view below points into it. */
+    godot::PackedByteArray m_blob{};
+
+    std::span<const AbilityRecord> m_abilities{};
+    std::span<const ImprovementRecord> m_improvements{};
+    std::span<const NodeRecord> m_nodes{};
+    std::span<const int32_t> m_prerequisites{};
+    std::span<const char> m_strings{};
+
+    /** Materialized abilities, indexed like m_abilities (null until first access). */
+    mutable std::vector<godot::Ref<Ability>> m_materialized{};
+    mutable int m_materialized_count{0};
+
+    /** Name → ability index, built on the first find_ability(). */
+    mutable godot::HashMap<godot::String, int32_t> m_index_by_name{};
+
+protected:
+    static void _bind_methods();
+
+public:
+    AbilityDatabase() = default;
+
+    /**
+     * @brief Wraps a serialized blob, validating it and fixing up section views.
+     *
+     * @param bytes Blob previously produced by from_tree() / get_bytes().
+     * @return The database, or null if the blob is truncated, has the wrong
+     *         magic, an unsupported FORMAT_VERSION or out-of-range references.
+     */
+    static godot::Ref<AbilityDatabase> from_bytes(const godot::PackedByteArray& bytes);
+
+    /**
+     * @brief Packs every node and ability of @p tree.
+     * @return The database, or null if @p tree is null.
+     */
+    static godot::Ref<AbilityDatabase> from_tree(const godot::Ref<AbilityTree>& tree);
+
+    /** @brief Returns the serialized blob. */
+    [[nodiscard]] godot::PackedByteArray get_bytes() const;
+
+    /** @brief Returns the number of abilities in the library. */
+    [[nodiscard]] int get_ability_count() const;
+
+    /** @brief Returns the registry key of ability @p index without materializing it. */
+    [[nodiscard]] godot::String get_ability_id(int index) const;
+
+    /** @brief Returns the name of ability @p index without materializing it. */
+    [[nodiscard]] godot::String get_ability_name(int index) const;
+
+    /** @brief Returns the unlock cost of ability @p index without materializing it. */
+    [[nodiscard]] float get_ability_cost(int index) const;
+
+    /**
+     * @brief Returns ability @p index, materializing it on first access.
+     *
+     * Later calls return the same resource.
+     *
+     * @return The ability, or null if @p index is out of range.
+     */
+    [[nodiscard]] godot::Ref<Ability> get_ability(int index) const;
+
+    /** @brief Returns the index of the ability named @p name, or -1. */
+    [[nodiscard]] int find_ability(const godot::String& name) const;
+
+    /** @brief Returns how many abilities are currently materialized. */
+    [[nodiscard]] int get_materialized_count() const;
+
+    /**
+     * @brief Drops the cached resource of ability @p index.
+     *
+     * The next get_ability() builds a fresh one. Used by AbilityRegistry to
+     * evict definitions nobody references any more.
+     */
+    void release_ability(int index);
+
+    /** @brief Returns the number of tree nodes. */
+    [[nodiscard]] int get_node_count() const;
+
+    /** @brief Returns the ability index of node @p node, or -1. */
+    [[nodiscard]] int get_node_ability(int node) const;
+
+    /** @brief Returns the node ids node @p node requires. */
+    [[nodiscard]] godot::PackedInt32Array get_node_prerequisites(int node) const;
+
+    /** @brief Returns the unlock condition of node @p node (empty for the default rule). */
+    [[nodiscard]] godot::String get_node_condition(int node) const;
+
+    /**
+     * @brief Materializes the whole library back into an AbilityTree.
+     *
+     * Nodes keep their order, so node ids match the tree's compiled ids. The
+     * tree shares the cached Ability resources with this database.
+     */
+    [[nodiscard]] godot::Ref<AbilityTree> build_tree() const;
+
+    /** @brief Returns the records of every ability (empty until loaded). */
+    [[nodiscard]] std::span<const AbilityRecord> abilities_view() const;
+
+    /** @brief Returns the string for @p ref, or an empty string if out of range. */
+    [[nodiscard]] godot::String read_string(const StringRef& ref) const;
+
+private:
+    /** Validates the blob and fixes up the section views; clears it on failure. */
+    bool fix_up();
+
+    /** Builds ability @p index from its records. */
+    godot::Ref<Ability> materialize(int index) const;
+};
+
+} // namespace Rebel::Ability
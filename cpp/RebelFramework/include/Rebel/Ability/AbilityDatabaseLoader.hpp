@@ -0,0 +1,36 @@
+// Copyright (c) 2026, and future.
+// Alejandro Morcillo Montejo - All Rights Reserved
+
+#pragma once
+
+#include "Rebel/Core.hpp"
+#include <godot_cpp/classes/resource_format_loader.hpp>
+#include <godot_cpp/variant/packed_string_array.hpp>
+#include <godot_cpp/variant/string.hpp>
+#include <godot_cpp/variant/string_name.hpp>
+
+namespace Rebel::Ability {
+
+/**
+ * @brief Loads `.abilitydb` files as AbilityDatabase resources.
+ *
+ * The file is read in one call and handed to AbilityDatabase::from_bytes();
+ * no Ability is created until the database is asked for one.
+ */
+class REBEL_FRAMEWORK AbilityDatabaseLoader : public godot::ResourceFormatLoader {
+    GDCLASS(AbilityDatabaseLoader, godot::ResourceFormatLoader);
+
+protected:
+    static void _bind_methods();
+
+public:
+    /** File extension handled by the loader and saver. */
+    static constexpr const char* EXTENSION = "abilitydb";
+
+    godot::PackedStringArray _get_recognized_extensions() const override;
+    bool _handles_type(const godot::StringName& p_type) const override;
+    godot::String _get_resource_type(const godot::String& p_path) const override;
+    godot::Variant _load(const godot::String& p_path, const godot::String& p_original_path, bool p_use_sub_threads, int32_t p_cache_mode) const override;
+};
+
+} // namespace Rebel::Ability
@@ -0,0 +1,34 @@
+// Copyright (c) 2026, and future.
+// Alejandro Morcillo Montejo - All Rights Reserved
+
+#pragma once
+
+#include "Rebel/Core.hpp"
+#include <godot_cpp/classes/resource.hpp>
+#include <godot_cpp/classes/resource_format_saver.hpp>
+#include <godot_cpp/variant/packed_string_array.hpp>
+#include <godot_cpp/variant/string.hpp>
+
+namespace Rebel::Ability {
+
+/**
+ * @brief Saves AbilityDatabase resources as `.abilitydb` files.
+ *
+ * Only databases are accepted. A `.abilitydb` file always loads back as an
+ * AbilityDatabase, so saving an AbilityTree to it would break every
+ * AbilityTree-typed reference to the file. Packing a tree is an explicit
+ * step: AbilityDatabase.from_tree(tree), then save the result.
+ */
+class REBEL_FRAMEWORK AbilityDatabaseSaver : public godot::ResourceFormatSaver {
+    GDCLASS(AbilityDatabaseSaver, godot::ResourceFormatSaver);
+
+protected:
+    static void _bind_methods();
+
+public:
+    godot::Error _save(const godot::Ref<godot::Resource>& p_resource, const godot::String& p_path, uint32_t p_flags) override;
+    bool _recognize(const godot::Ref<godot::Resource>& p_resource) const override;
+    godot::PackedStringArray _get_recognized_extensions(const godot::Ref<godot::Resource>& p_resource) const override;
+};
+
+} // namespace Rebel::Ability
@@ -0,0 +1,116 @@
+// Copyright (c) 2026, and future.
+// Alejandro Morcillo Montejo - All Rights Reserved
+
+#pragma once
+
+#include "Rebel/Core.hpp"
+#include <godot_cpp/variant/string.hpp>
+#include <godot_cpp/variant/string_name.hpp>
+
+#include <cstdint>
+#include <vector>
+
+namespace Rebel::Attribute {
+class AttributeSet;
+}
+
+namespace Rebel::Ability {
+
+/**
+ * @brief A description template, parsed once and rendered on demand.
+ *
+ * Descriptions may reference live values in braces:
+ *
+ * @code
+ * Deals {damage} damage to {targets} enemies.
+ * Heals {heal:1} per second at level {level}.
+ * @endcode
+ *
+ * `{level}` is the character's current level of the ability; any other name
+ * reads that attribute from the character's AttributeSet. An optional `:N`
+ * fixes the number of decimals; otherwise whole numbers print without any and
+ * the rest with up to two. `{{` and `}}` are literal braces. A placeholder
+ * that cannot be resolved (unknown attribute, no attribute set) is printed
+ * as written, so a typo shows up in the UI instead of vanishing.
+ *
+ * The parsed form is a list of literal runs and placeholders, with names
+ * interned as StringNames. render() remembers its inputs (the level and the
+ * value of every referenced attribute) and returns the previous string while
+ * none of them changed. The Ability is shared by every character, so the memo
+ * keeps one entry per AttributeSet: the MEMO_SIZE most recently used ones.
+ * Two characters reading the same ability then each hit their own entry. A
+ * UI refresh costs a few hash lookups and float compares, and no allocation.
+ * A template without placeholders is returned as parsed, without any
+ * rendering.
+ */
+class REBEL_FRAMEWORK AbilityDescription {
+    enum SegmentKind : uint8_t {
+        SEGMENT_TEXT,       ///< Literal text.
+        SEGMENT_LEVEL,      ///< The current level.
+        SEGMENT_ATTRIBUTE,  ///< The value of attribute `name`.
+    };
+
+    struct Segment {
+        SegmentKind kind{SEGMENT_TEXT};
+        int8_t decimals{-1};  ///< -1: whole numbers bare, others up to two decimals.
+        int32_t input{-1};    ///< Index into m_inputs for placeholders.
+        godot::String text{}; ///< Literal text, or the placeholder as written.
+        godot::StringName name{};
+    };
+
+    godot::String m_source{};
+    std::vector<Segment> m_segments{};
+    bool m_parsed{false};
+
+    /** Names of the attributes read, one input each; the level is the last input. */
+    std::vector<godot::StringName> m_attributes{};
+
+    // --- Memo of recent renders ---
+
+    /** Attribute sets remembered at once; the least recently used is replaced. */
+    static constexpr size_t MEMO_SIZE = 4;
+
+    struct MemoEntry {
+        uint64_t attributes_id{0};      ///< Instance id of the AttributeSet (0 = none).
+        std::vector<uint32_t> inputs{}; ///< Bit patterns, so NaN (= missing) compares equal.
+        godot::String rendered{};
+    };
+
+    /** Most recently used first. */
+    std::vector<MemoEntry> m_memo{};
+
+    /** Inputs of the render in progress, reused between calls. */
+    std::vector<uint32_t> m_inputs{};
+
+public:
+    /** @brief Replaces the template; it is parsed on the next render(). */
+    void set_source(const godot::String& source);
+
+    /** @brief Returns the template as written. */
+    [[nodiscard]] const godot::String& get_source() const { return m_source; }
+
+    /**
+     * @brief Returns the description filled in with @p attributes and @p level.
+     *
+     * Re-renders only when the level or the value of a referenced attribute
+     * differs from the previous call with the same attribute set.
+     *
+     * @param attributes The character's attributes, or null.
+     * @param level      Value of `{level}`.
+     */
+    [[nodiscard]] godot::String render(Attribute::AttributeSet* attributes, int level);
+
+    /** @brief Returns whether the template has any placeholder (parsing it if needed). */
+    [[nodiscard]] bool has_placeholders();
+
+    /** @brief Returns the attribute names the template reads (parsing it if needed). */
+    [[nodiscard]] const std::vector<godot::StringName>& get_attributes();
+
+private:
+    void parse();
+
+    /** Formats @p value for a placeholder with @p decimals (see Segment::decimals). */
+    [[nodiscard]] static godot::String format_number(float value, int decimals);
+};
+
+} // namespace Rebel::Ability
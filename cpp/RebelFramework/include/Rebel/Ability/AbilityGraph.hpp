@@ -0,0 +1,231 @@
+// Copyright (c) 2026, and future.
+// Alejandro Morcillo Montejo - All Rights Reserved
+
+#pragma once
+
+#include "Rebel/Core.hpp"
+#include "Rebel/Ability/AbilityCondition.hpp"
+#include <godot_cpp/templates/hash_map.hpp>
+#include <godot_cpp/variant/array.hpp>
+#include <godot_cpp/variant/packed_string_array.hpp>
+
+#include <algorithm>
+#include <bit>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace Rebel::Ability {
+
+class Ability;
+class AbilityNode;
+
+/**
+ * @brief Fixed-size bitset over AbilityGraph node ids.
+ */
+class REBEL_FRAMEWORK AbilityBitset {
+    std::vector<uint64_t> m_words{};
+
+public:
+    void resize(const int32_t bits) { m_words.assign((static_cast<size_t>(bits) + 63) / 64, 0); }
+    void clear() { std::fill(m_words.begin(), m_words.end(), 0); }
+
+    [[nodiscard]] bool test(const int32_t bit) const { return (m_words[bit >> 6] >> (bit & 63)) & 1u; }
+    void set(const int32_t bit) { m_words[bit >> 6] |= uint64_t{1} << (bit & 63); }
+    void reset(const int32_t bit) { m_words[bit >> 6] &= ~(uint64_t{1} << (bit & 63)); }
+
+    /** Returns 64 bits starting at bit @p index * 64 (0 past the end). */
+    [[nodiscard]] uint64_t word(const int32_t index) const {
+        return static_cast<size_t>(index) < m_words.size() ? m_words[index] : 0;
+    }
+
+    [[nodiscard]] int32_t count() const {
+        int32_t total = 0;
+        for (const uint64_t word : m_words) {
+            total += std::popcount(word);
+        }
+        return total;
+    }
+
+    /** Calls @p fn with the index of every set bit, in ascending order. */
+    template <typename Fn>
+    void for_each(Fn&& fn) const {
+        for (size_t w = 0; w < m_words.size(); ++w) {
+            uint64_t word = m_words[w];
+            while (word != 0) {
+                fn(static_cast<int32_t>(w * 64 + std::countr_zero(word)));
+                word &= word - 1;
+            }
+        }
+    }
+};
+
+/**
+ * @brief Flat, immutable form of an AbilityTree's prerequisite graph.
+ *
+ * Every AbilityNode in the tree gets a dense integer id (its index in the
+ * node list). Prerequisite and dependent edges are stored as CSR arrays, so
+ * walking the neighbours of a node touches one contiguous range and no
+ * Variants or Refs.
+ *
+ * Prerequisites that are null or not part of the node list cannot be
+ * satisfied; they are counted in get_unresolved_count() and keep their node
+ * locked.
+ *
+ * A node with an unlock condition (AbilityNode::get_condition()) has it
+ * compiled here into an AbilityCondition, which replaces the default "every
+ * prerequisite enabled" rule for that node.
+ *
+ * build() also validates the graph and precomputes what the tree UI needs:
+ *   - errors for dangling prerequisites, duplicate nodes or abilities,
+ *     prerequisite cycles and conditions that fail to compile (see get_errors());
+ *   - the root ids (no prerequisites at all);
+ *   - a topological depth per node (roots are 0, every other node sits one
+ *     layer below its deepest prerequisite) grouped into CSR layers.
+ *     Nodes on a cycle get depth -1 and appear in no layer.
+ */
+class REBEL_FRAMEWORK AbilityGraph {
+    std::vector<int32_t> m_prerequisite_offsets{};
+    std::vector<int32_t> m_prerequisite_ids{};
+    std::vector<int32_t> m_dependent_offsets{};
+    std::vector<int32_t> m_dependent_ids{};
+    std::vector<int32_t> m_unresolved{};
+
+    /** Ids holding a real node: not null and not a repeat of an earlier entry. */
+    AbilityBitset m_valid{};
+
+    /** AbilityNode instance id → node id. */
+    godot::HashMap<uint64_t, int32_t> m_ids_by_node{};
+
+    /** Ability instance id → node id. */
+    godot::HashMap<uint64_t, int32_t> m_ids_by_ability{};
+
+    std::vector<int32_t> m_roots{};
+    std::vector<int32_t> m_depths{};
+    std::vector<int32_t> m_layer_offsets{};
+    std::vector<int32_t> m_layer_ids{};
+    godot::PackedStringArray m_errors{};
+
+    /** Compiled conditions; m_condition_index maps node id → index, -1 for none. */
+    std::vector<AbilityCondition> m_conditions{};
+    std::vector<int32_t> m_condition_index{};
+    std::vector<int32_t> m_conditional_ids{};
+    std::vector<int32_t> m_attribute_conditional_ids{};
+
+    int32_t m_size{0};
+
+public:
+    /**
+     * @brief Rebuilds the graph from an AbilityTree node list.
+     * @param nodes Array of Ref<AbilityNode>; null entries keep their id but have no edges.
+     */
+    void build(const godot::Array& nodes);
+
+    [[nodiscard]] int32_t size() const { return m_size; }
+
+    /** Returns whether @p id holds a node of its own (null and duplicate entries do not). */
+    [[nodiscard]] bool is_valid(const int32_t id) const { return m_valid.test(id); }
+
+    /** Returns the id of @p node, or -1 if it is not part of the graph. */
+    [[nodiscard]] int32_t find_node(const AbilityNode* node) const;
+
+    /** Returns the id of the node wrapping @p ability, or -1. */
+    [[nodiscard]] int32_t find_ability(const Ability* ability) const;
+
+    [[nodiscard]] std::span<const int32_t> prerequisites(const int32_t id) const {
+        return {m_prerequisite_ids.data() + m_prerequisite_offsets[id],
+                static_cast<size_t>(m_prerequisite_offsets[id + 1] - m_prerequisite_offsets[id])};
+    }
+
+    [[nodiscard]] std::span<const int32_t> dependents(const int32_t id) const {
+        return {m_dependent_ids.data() + m_dependent_offsets[id],
+                static_cast<size_t>(m_dependent_offsets[id + 1] - m_dependent_offsets[id])};
+    }
+
+    /** Number of prerequisites of @p id that can never be satisfied. */
+    [[nodiscard]] int32_t get_unresolved_count(const int32_t id) const { return m_unresolved[id]; }
+
+    /** Ids of the nodes with no prerequisites, in node-list order. */
+    [[nodiscard]] std::span<const int32_t> roots() const { return m_roots; }
+
+    /** Topological depth of @p id, or -1 if it is null or on a cycle. */
+    [[nodiscard]] int32_t get_depth(const int32_t id) const { return m_depths[id]; }
+
+    /** Number of depth layers. */
+    [[nodiscard]] int32_t get_layer_count() const { return static_cast<int32_t>(m_layer_offsets.size()) - 1; }
+
+    /** Ids of the nodes at depth @p layer, in node-list order. */
+    [[nodiscard]] std::span<const int32_t> layer(const int32_t layer) const {
+        return {m_layer_ids.data() + m_layer_offsets[layer],
+                static_cast<size_t>(m_layer_offsets[layer + 1] - m_layer_offsets[layer])};
+    }
+
+    /** Returns the compiled condition of @p id, or null if it uses the default rule. */
+    [[nodiscard]] const AbilityCondition* get_condition(const int32_t id) const {
+        const int32_t index = m_condition_index[id];
+        return index >= 0 ? &m_conditions[index] : nullptr;
+    }
+
+    /** Ids of the nodes with a condition. */
+    [[nodiscard]] std::span<const int32_t> conditional_ids() const { return m_conditional_ids; }
+
+    /** Ids of the nodes whose condition reads character attributes. */
+    [[nodiscard]] std::span<const int32_t> attribute_conditional_ids() const { return m_attribute_conditional_ids; }
+
+    /** Problems found by the last build(); empty when the graph is well-formed. */
+    [[nodiscard]] const godot::PackedStringArray& get_errors() const { return m_errors; }
+
+private:
+    /** Computes depths and layers; reports the nodes left on a cycle. */
+    void compute_layers(const godot::Array& nodes);
+
+    /** Compiles every node's condition against its prerequisites. */
+    void compile_conditions(const godot::Array& nodes);
+};
+
+/**
+ * @brief Unlock progress over an AbilityGraph, updated incrementally.
+ *
+ * Keeps an enabled bitset, the number of unmet prerequisites per node and
+ * the set of nodes that are unlockable right now (condition met, not yet
+ * enabled). enable() and disable() touch only the node and its direct
+ * dependents, found through the graph's reverse (dependents) index.
+ *
+ * Nodes without a condition are unlockable once `missing` drops to 0. Ids
+ * that are not valid in the graph (null or duplicate entries) never are.
+ * Conditional nodes are only re-evaluated by refresh() (enable() refreshes
+ * the dependents when given a context), since their result can also depend
+ * on levels and attributes the unlock state does not own.
+ */
+struct REBEL_FRAMEWORK AbilityUnlockState {
+    AbilityBitset enabled{};
+    AbilityBitset unlockable{};
+    std::vector<int32_t> missing{};
+
+    /** Resets to "nothing enabled" for @p graph; conditional nodes start locked until refreshed. */
+    void reset(const AbilityGraph& graph);
+
+    /**
+     * Marks @p id enabled and updates its dependents. No-op if already enabled.
+     * Conditional dependents are re-evaluated only if @p context is given.
+     */
+    void enable(const AbilityGraph& graph, int32_t id, const AbilityConditionContext* context = nullptr);
+
+    /**
+     * Marks @p id locked and updates its dependents. No-op if not enabled.
+     * Enabled dependents are left enabled; use holds() to find the ones that
+     * must be relocked in turn.
+     */
+    void disable(const AbilityGraph& graph, int32_t id, const AbilityConditionContext& context);
+
+    /** Returns whether the condition of @p id (by default: no missing prerequisite) holds, enabled or not. */
+    [[nodiscard]] bool holds(const AbilityGraph& graph, int32_t id, const AbilityConditionContext& context) const;
+
+    /** Recomputes whether @p id is unlockable; returns true if that changed. */
+    bool refresh(const AbilityGraph& graph, int32_t id, const AbilityConditionContext& context);
+
+    /** Refreshes every node in @p ids; returns true if any changed. */
+    bool refresh(const AbilityGraph& graph, std::span<const int32_t> ids, const AbilityConditionContext& context);
+};
+
+} // namespace Rebel::Ability
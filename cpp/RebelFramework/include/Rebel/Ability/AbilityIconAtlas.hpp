@@ -0,0 +1,105 @@
+// Copyright (c) 2026, and future.
+// Alejandro Morcillo Montejo - All Rights Reserved
+
+#pragma once
+
+#include "Rebel/Core.hpp"
+#include "Rebel/Ability/Ability.hpp"
+#include <godot_cpp/classes/atlas_texture.hpp>
+#include <godot_cpp/classes/resource.hpp>
+#include <godot_cpp/classes/texture2d.hpp>
+#include <godot_cpp/templates/hash_map.hpp>
+#include <godot_cpp/variant/array.hpp>
+#include <godot_cpp/variant/packed_int32_array.hpp>
+#include <godot_cpp/variant/packed_int64_array.hpp>
+
+#include <cstdint>
+
+namespace Rebel::Ability {
+
+/**
+ * @brief Every icon of a set of abilities packed into one texture.
+ *
+ * Produced by AbilityIconAtlasBaker. `texture` holds all the unique icons,
+ * and `icons` has one AtlasTexture per unique icon, each pointing at its
+ * region of `texture`. Every ability gets a row of Ability::IMPROVEMENT_COUNT
+ * + 1 slots: slot 0 is the ability's icon and slot N is the icon of
+ * improvement level N. The "no improvement icon → ability icon" fallback is
+ * resolved when the atlas is baked, so a lookup is a hash hit plus an array
+ * index. Every icon drawn from one atlas shares a texture, so the tree
+ * screen and the HUD can batch them.
+ *
+ * Rows are keyed by Ability::get_registry_id(), which is stable across runs,
+ * so a baked atlas stays valid as long as the ability ids do.
+ */
+class REBEL_FRAMEWORK AbilityIconAtlas : public godot::Resource {
+    GDCLASS(AbilityIconAtlas, godot::Resource);
+
+public:
+    /** Icon slots per ability: the base icon plus one per improvement level. */
+    static constexpr int SLOTS_PER_ABILITY = Ability::IMPROVEMENT_COUNT + 1;
+
+private:
+    /** The packed atlas page. */
+    godot::Ref<godot::Texture2D> m_texture{};
+
+    /** Array of Ref<AtlasTexture>, one per unique icon. */
+    godot::Array m_icons{};
+
+    /** Registry id of every row. */
+    godot::PackedInt64Array m_ids{};
+
+    /** SLOTS_PER_ABILITY indices into m_icons per row; -1 for no icon. */
+    godot::PackedInt32Array m_slots{};
+
+    /** Registry id → row, rebuilt on first lookup after a change. */
+    mutable godot::HashMap<int64_t, int32_t> m_rows{};
+    mutable bool m_rows_valid{false};
+
+protected:
+    static void _bind_methods();
+
+public:
+    AbilityIconAtlas() = default;
+
+    /**
+     * @brief Returns the icon of @p ability at improvement @p level (0 = the ability's own icon).
+     * @return The AtlasTexture, or null if the ability is not in the atlas or has no icon.
+     */
+    [[nodiscard]] godot::Ref<godot::AtlasTexture> get_icon(const godot::Ref<Ability>& ability, int level = 0) const;
+
+    /** @brief Same as get_icon() for the ability with registry id @p ability_id. */
+    [[nodiscard]] godot::Ref<godot::AtlasTexture> get_icon_by_id(int64_t ability_id, int level = 0) const;
+
+    /** @brief Returns whether the atlas has a row for @p ability_id. */
+    [[nodiscard]] bool has_ability(int64_t ability_id) const;
+
+    /** @brief Returns the number of abilities in the atlas. */
+    [[nodiscard]] int get_ability_count() const;
+
+    /** @brief Sets the packed atlas page (storage). */
+    void set_texture(const godot::Ref<godot::Texture2D>& texture);
+    /** @brief Returns the packed atlas page every icon points into. */
+    [[nodiscard]] godot::Ref<godot::Texture2D> get_texture() const;
+
+    /** @brief Sets the unique icons (storage): Array of AtlasTexture. */
+    void set_icons(const godot::Array& icons);
+    /** @brief Returns the unique icons: Array of AtlasTexture. */
+    [[nodiscard]] godot::Array get_icons() const;
+
+    /** @brief Sets the registry id of every row (storage). */
+    void set_ids(const godot::PackedInt64Array& ids);
+    /** @brief Returns the registry id of every row. */
+    [[nodiscard]] godot::PackedInt64Array get_ids() const;
+
+    /** @brief Sets the icon index of every slot, row by row (storage). */
+    void set_slots(const godot::PackedInt32Array& slots);
+    /** @brief Returns the icon index of every slot, row by row (-1 = none). */
+    [[nodiscard]] godot::PackedInt32Array get_slots() const;
+
+private:
+    /** Returns the row of @p ability_id, or -1; rebuilds m_rows if needed. */
+    [[nodiscard]] int32_t find_row(int64_t ability_id) const;
+};
+
+} // namespace Rebel::Ability
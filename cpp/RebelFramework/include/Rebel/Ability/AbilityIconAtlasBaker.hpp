@@ -0,0 +1,101 @@
+// Copyright (c) 2026, and future.
+// Alejandro Morcillo Montejo - All Rights Reserved
+
+#pragma once
+
+#include "Rebel/Core.hpp"
+#include "Rebel/Ability/AbilityIconAtlas.hpp"
+#include "Rebel/Ability/AbilityTree.hpp"
+#include <godot_cpp/classes/ref_counted.hpp>
+#include <godot_cpp/variant/array.hpp>
+#include <godot_cpp/variant/vector2i.hpp>
+
+namespace Rebel::Ability {
+
+/**
+ * @brief Packs every icon an AbilityTree references into one AbilityIconAtlas.
+ *
+ * An ability tree screen otherwise binds one texture per ability, plus one
+ * per improvement level that overrides the icon. bake() gathers the ability
+ * and improvement icons, resolves the "null improvement icon → ability icon"
+ * fallback, and packs each unique texture once into a single RGBA8 page.
+ * Packing uses shelves sorted by height, with `padding` transparent pixels
+ * around each icon so filtering never samples a neighbour. Every icon becomes
+ * an AtlasTexture region of that page.
+ *
+ * Meant to run as a bake step, e.g. from an editor tool script; save the
+ * result with ResourceSaver and assign it to AbilityTree::icon_atlas:
+ *
+ * @code
+ * var baker := AbilityIconAtlasBaker.new()
+ * tree.icon_atlas = baker.bake(tree)
+ * ResourceSaver.save(tree.icon_atlas, "res://ui/warrior_icons.tres")
+ * @endcode
+ *
+ * Compressed source textures are decompressed. If `icon_size` is set, every
+ * icon is resized to it first.
+ */
+class REBEL_FRAMEWORK AbilityIconAtlasBaker : public godot::RefCounted {
+    GDCLASS(AbilityIconAtlasBaker, godot::RefCounted);
+
+    /** Size every icon is resized to; (0, 0) keeps source sizes. */
+    godot::Vector2i m_icon_size{};
+
+    /** Transparent pixels around each icon. */
+    int m_padding{2};
+
+    /** Width at which a shelf wraps. */
+    int m_max_width{2048};
+
+    /** Whether the atlas page gets mipmaps. */
+    bool m_generate_mipmaps{false};
+
+    // --- Statistics of the last bake ---
+    int m_last_icon_count{0};
+    godot::Vector2i m_last_atlas_size{};
+
+protected:
+    static void _bind_methods();
+
+public:
+    AbilityIconAtlasBaker() = default;
+
+    /**
+     * @brief Bakes the icons of every ability in @p tree.
+     * @return The atlas, or null if @p tree is null.
+     */
+    godot::Ref<AbilityIconAtlas> bake(const godot::Ref<AbilityTree>& tree);
+
+    /**
+     * @brief Bakes the icons of @p abilities (Array of Ref<Ability>).
+     * @return The atlas; empty if no ability has an icon.
+     */
+    godot::Ref<AbilityIconAtlas> bake_abilities(const godot::Array& abilities);
+
+    /** @brief Sets the size every icon is resized to; (0, 0) keeps source sizes. */
+    void set_icon_size(const godot::Vector2i& size);
+    /** @brief Returns the size every icon is resized to. */
+    [[nodiscard]] godot::Vector2i get_icon_size() const;
+
+    /** @brief Sets the transparent border around each icon, in pixels. */
+    void set_padding(int padding);
+    /** @brief Returns the transparent border around each icon, in pixels. */
+    [[nodiscard]] int get_padding() const;
+
+    /** @brief Sets the width at which icons wrap onto a new shelf. */
+    void set_max_width(int width);
+    /** @brief Returns the width at which icons wrap onto a new shelf. */
+    [[nodiscard]] int get_max_width() const;
+
+    /** @brief Sets whether the atlas page gets mipmaps. */
+    void set_generate_mipmaps(bool enabled);
+    /** @brief Returns whether the atlas page gets mipmaps. */
+    [[nodiscard]] bool get_generate_mipmaps() const;
+
+    /** @brief Returns the number of unique icons packed by the last bake. */
+    [[nodiscard]] int get_last_icon_count() const;
+    /** @brief Returns the size of the page produced by the last bake. */
+    [[nodiscard]] godot::Vector2i get_last_atlas_size() const;
+};
+
+} // namespace Rebel::Ability
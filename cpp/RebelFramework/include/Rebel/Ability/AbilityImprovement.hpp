@@ -4,6 +4,8 @@
 #pragma once
 
 #include "Rebel/Core.hpp"
+#include "Rebel/Ability/AbilityDescription.hpp"
+#include "Rebel/Attribute/AttributeSet.hpp"
 #include <godot_cpp/classes/resource.hpp>
 #include <godot_cpp/classes/texture2d.hpp>
 #include <godot_cpp/variant/string.hpp>
@@ -19,7 +21,9 @@ namespace Rebel::Ability {
  *
  * Serializable as a .tres file and fully editable in the Godot Inspector.
  *
- * @note Intended to be stored in Ability::improvements (Array, 10 fixed slots).
+ * @note Stored sparsely in Ability::improvements. Tiers a designer never
+ *       authored are represented by shared, frozen defaults; setters on a
+ *       frozen instance are ignored with a warning.
  */
 class REBEL_FRAMEWORK AbilityImprovement : public godot::Resource {
     GDCLASS(AbilityImprovement, godot::Resource);
@@ -27,8 +31,8 @@ class REBEL_FRAMEWORK AbilityImprovement : public godot::Resource {
     /** The upgrade tier this improvement represents (1–10). */
     int m_level{1};
 
-    /** Human-readable description of what this upgrade does. */
-    godot::String m_description{};
+    /** Human-readable description of what this upgrade does; a template (see AbilityDescription). */
+    AbilityDescription m_description{};
 
     /**
      * @brief Optional icon for this upgrade level.
@@ -40,6 +44,12 @@ class REBEL_FRAMEWORK AbilityImprovement : public godot::Resource {
     /** Resource cost to activate/purchase this improvement level. */
     float m_cost{0.0f};
 
+    /** Set on shared defaults; a frozen improvement rejects every change. */
+    bool m_frozen{false};
+
+    /** Returns true (and warns) if this instance must not be modified. */
+    [[nodiscard]] bool reject_if_frozen() const;
+
 protected:
     static void _bind_methods();
 
@@ -70,6 +80,17 @@ public:
      */
     [[nodiscard]] godot::String get_description() const;
 
+    /**
+     * @brief Returns the description with its placeholders filled in.
+     *
+     * The result is memoized; see AbilityDescription.
+     *
+     * @param attributes The character's attributes, or null.
+     * @param level      Value of `{level}`; negative for this improvement's own tier.
+     * @return The rendered description.
+     */
+    godot::String format_description(const godot::Ref<Attribute::AttributeSet>& attributes, int level = -1);
+
     /**
      * @brief Sets the optional icon for this upgrade level.
      *
@@ -96,6 +117,25 @@ public:
      * @return Cost as a float.
      */
     [[nodiscard]] float get_cost() const;
+
+    /**
+     * @brief Makes this improvement read-only.
+     *
+     * Used for the shared defaults that stand in for unauthored tiers.
+     */
+    void freeze();
+
+    /**
+     * @brief Returns whether this improvement is read-only.
+     * @return True for shared defaults.
+     */
+    [[nodiscard]] bool is_frozen() const;
+
+    /**
+     * @brief Returns whether every field still holds its default value.
+     * @return True if the improvement carries no authored data.
+     */
+    [[nodiscard]] bool is_default() const;
 };
 
 } // namespace Rebel::Ability
@@ -10,6 +10,8 @@
 
 namespace Rebel::Ability {
 
+class AbilityState;
+
 /**
  * @brief One node in the ability tree, wrapping an Ability with prerequisite links.
  *
@@ -17,6 +19,11 @@ namespace Rebel::Ability {
  * AbilityNode holds a list of other AbilityNodes that must be enabled before
  * this one can be unlocked. This avoids a rigid parent/child hierarchy and
  * allows diamond-shaped dependencies (an ability that requires two others).
+ * An optional `condition` relaxes or extends that rule ("any 2 of these",
+ * "prerequisite at level 3", "luck at least 5").
+ *
+ * Emits `changed` when its ability or prerequisites are reassigned, so the
+ * owning AbilityTree knows to recompile its graph.
  *
  * Serializable as a .tres file and fully editable in the Godot Inspector.
  *
@@ -30,13 +37,21 @@ class REBEL_FRAMEWORK AbilityNode : public godot::Resource {
     godot::Ref<Ability> m_ability{};
 
     /**
-     * @brief Nodes whose wrapped abilities must be enabled before this one.
+     * @brief Nodes that must be enabled before this one.
      *
-     * Array of Ref<AbilityNode>. All elements must have their ability enabled
-     * for can_unlock() to return true.
+     * Array of Ref<AbilityNode>. All elements must be enabled in the queried
+     * AbilityState for can_unlock() to return true.
      */
     godot::Array m_prerequisites{};
 
+    /**
+     * @brief Optional unlock condition replacing "every prerequisite enabled".
+     *
+     * Compiled by the owning tree's graph; see AbilityCondition for the syntax.
+     * Empty means the default rule.
+     */
+    godot::String m_condition{};
+
 protected:
     static void _bind_methods();
 
@@ -72,16 +87,28 @@ public:
     [[nodiscard]] godot::Array get_prerequisites() const;
 
     /**
-     * @brief Checks whether all prerequisite abilities are enabled.
-     *
-     * Returns true when every element in prerequisites is a valid AbilityNode
-     * whose wrapped Ability has enabled == true.
+     * @brief Sets the unlock condition, e.g. `at_least(2)` or `level(#0) >= 3`.
+     * @param condition Condition text; empty restores the default rule.
+     */
+    void set_condition(const godot::String& condition);
+
+    /**
+     * @brief Returns the unlock condition.
+     * @return Condition text, empty for the default rule.
+     */
+    [[nodiscard]] godot::String get_condition() const;
+
+    /**
+     * @brief Checks whether this node can be unlocked for one character.
      *
-     * Returns true immediately when the prerequisites list is empty (root node).
+     * Returns true when this node is locked in @p state and its condition
+     * holds — by default, when every prerequisite is enabled. A node with no
+     * prerequisites and no condition only needs to be locked.
      *
+     * @param state The character's progress.
      * @return True if this node can be unlocked right now.
      */
-    [[nodiscard]] bool can_unlock() const;
+    [[nodiscard]] bool can_unlock(const godot::Ref<AbilityState>& state) const;
 };
 
 } // namespace Rebel::Ability
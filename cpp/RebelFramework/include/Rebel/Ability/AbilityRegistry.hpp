@@ -0,0 +1,160 @@
+// Copyright (c) 2026, and future.
+// Alejandro Morcillo Montejo - All Rights Reserved
+
+#pragma once
+
+#include "Rebel/Core.hpp"
+#include "Rebel/Ability/Ability.hpp"
+#include "Rebel/Ability/AbilityDatabase.hpp"
+#include <godot_cpp/classes/object.hpp>
+#include <godot_cpp/templates/hash_map.hpp>
+#include <godot_cpp/variant/string.hpp>
+
+#include <cstdint>
+#include <vector>
+
+namespace Rebel::Ability {
+
+/**
+ * @brief Maps stable ability ids to definitions that load on first use.
+ *
+ * Every Ability is known by a string key — its `id` property, or its resource
+ * path when the id is empty — and by make_id(key), a 64-bit hash of that key.
+ * The hash does not depend on load order or on the running process, so it can
+ * go into save files and be compared across scenes as a plain integer;
+ * nothing has to be loaded to tell two abilities apart.
+ *
+ * The registry only records where a definition comes from (a resource path or
+ * an AbilityDatabase record). get_ability() loads it the first time it is
+ * asked for and keeps it while it is used. Once more than `max_loaded`
+ * definitions are resident, the least recently used ones that nothing else
+ * references are released; call trim() to release more, e.g. on a low-memory
+ * warning. A definition that is still referenced elsewhere is never evicted,
+ * so a given id always resolves to a single live resource.
+ *
+ * Registered as the `AbilityRegistry` engine singleton.
+ */
+class REBEL_FRAMEWORK AbilityRegistry : public godot::Object {
+    GDCLASS(AbilityRegistry, godot::Object);
+
+    static AbilityRegistry* s_singleton;
+
+    /** Where one definition comes from and, while resident, the definition itself. */
+    struct Entry {
+        godot::String key{};
+        godot::String path{};
+        godot::Ref<AbilityDatabase> database{};
+        int32_t database_index{-1};
+        godot::Ref<Ability> ability{};
+        uint64_t last_use{0};
+        bool pinned{false};              ///< No source to reload from; never evicted.
+    };
+
+    std::vector<Entry> m_entries{};
+    godot::HashMap<int64_t, uint32_t> m_index_by_id{};
+
+    /** Entry slots freed by unregister(), reused by the next registration. */
+    std::vector<uint32_t> m_free_entries{};
+
+    uint64_t m_use_clock{0};
+    int m_loaded_count{0};
+    int m_max_loaded{256};
+
+protected:
+    static void _bind_methods();
+
+public:
+    AbilityRegistry();
+    ~AbilityRegistry() override;
+
+    /** @brief Returns the engine-wide instance. */
+    static AbilityRegistry* get_singleton();
+
+    /**
+     * @brief Returns the integer id for @p key.
+     *
+     * 64-bit FNV-1a over the key's UTF-8 bytes; never 0.
+     */
+    static int64_t make_id(const godot::String& key);
+
+    /**
+     * @brief Registers the definition stored at @p path under @p key without loading it.
+     * @return The ability id, or 0 if @p key or @p path is empty.
+     */
+    int64_t register_path(const godot::String& key, const godot::String& path);
+
+    /**
+     * @brief Registers an already-loaded ability under its registry key.
+     *
+     * Abilities saved to their own file can be reloaded after eviction;
+     * abilities without a file stay resident.
+     *
+     * @return The ability id, or 0 if the ability is null or has neither an id nor a path.
+     */
+    int64_t register_ability(const godot::Ref<Ability>& ability);
+
+    /**
+     * @brief Registers every ability of @p database without materializing any.
+     * @return Number of abilities registered.
+     */
+    int register_database(const godot::Ref<AbilityDatabase>& database);
+
+    /**
+     * @brief Forgets @p id; a resident definition stays alive while referenced elsewhere.
+     * @return True if it was registered.
+     */
+    bool unregister(int64_t id);
+
+    /** @brief Returns whether @p id is registered. */
+    [[nodiscard]] bool has_ability(int64_t id) const;
+
+    /** @brief Returns the key @p id was registered under, or an empty string. */
+    [[nodiscard]] godot::String get_key(int64_t id) const;
+
+    /**
+     * @brief Returns the definition for @p id, loading it if needed.
+     * @return The ability, or null if @p id is unknown or fails to load.
+     */
+    godot::Ref<Ability> get_ability(int64_t id);
+
+    /** @brief Shorthand for get_ability(make_id(key)). */
+    godot::Ref<Ability> get_ability_by_key(const godot::String& key);
+
+    /** @brief Returns whether the definition for @p id is resident. */
+    [[nodiscard]] bool is_loaded(int64_t id) const;
+
+    /**
+     * @brief Releases least recently used definitions until at most @p max_loaded are resident.
+     *
+     * Pinned definitions and definitions referenced elsewhere are skipped.
+     *
+     * @return Number of definitions released.
+     */
+    int trim(int max_loaded);
+
+    /** @brief Sets how many definitions may stay resident before eviction (>= 1). */
+    void set_max_loaded(int max_loaded);
+    /** @brief Returns how many definitions may stay resident before eviction. */
+    [[nodiscard]] int get_max_loaded() const;
+
+    /** @brief Returns the number of resident definitions. */
+    [[nodiscard]] int get_loaded_count() const;
+
+    /** @brief Returns the number of registered ids. */
+    [[nodiscard]] int get_registered_count() const;
+
+private:
+    /** Returns the entry for @p id (creating it if needed) and sets its key. */
+    Entry& acquire_entry(int64_t id, const godot::String& key);
+
+    [[nodiscard]] const Entry* find_entry(int64_t id) const;
+    [[nodiscard]] Entry* find_entry(int64_t id);
+
+    /** Drops the entry's resident definition. */
+    void release(Entry& entry);
+
+    /** Returns whether anything outside the registry (and its database) holds the definition. */
+    [[nodiscard]] static bool is_referenced_elsewhere(const Entry& entry);
+};
+
+} // namespace Rebel::Ability
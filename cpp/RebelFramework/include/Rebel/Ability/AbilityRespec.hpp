@@ -0,0 +1,123 @@
+// Copyright (c) 2026, and future.
+// Alejandro Morcillo Montejo - All Rights Reserved
+
+#pragma once
+
+#include "Rebel/Core.hpp"
+#include "Rebel/Ability/AbilityState.hpp"
+#include "Rebel/Ability/AbilityTree.hpp"
+#include <godot_cpp/classes/node.hpp>
+#include <godot_cpp/classes/ref_counted.hpp>
+#include <godot_cpp/variant/packed_int32_array.hpp>
+
+#include <cstdint>
+
+namespace Rebel::Ability {
+
+/**
+ * @brief A batch of relocks, level changes and unlocks applied to an AbilityState all at once.
+ *
+ * Created by AbilityTree::begin_respec(). Every edit goes to a private copy
+ * of the state, so the character keeps its current abilities while the
+ * player experiments, and get_preview() can be passed to
+ * AbilityTree::query_state() to draw the result. get_refund() and get_cost()
+ * compare the copy with the live state.
+ *
+ * commit() swaps the copy in as one change and updates the character's
+ * containers in a single pass: containers of abilities that ended up locked
+ * are deactivated, then containers of newly unlocked ones are activated.
+ * If the live state changed since the respec began (or the tree was
+ * rebuilt) nothing is applied and commit() returns false. rollback()
+ * discards the copy. Either call closes the respec.
+ *
+ * @code
+ * var respec := tree.begin_respec(state)
+ * respec.relock(fire_node)            # also relocks everything that needed it
+ * respec.unlock(frost_node)
+ * if gold + respec.get_refund() - respec.get_cost() >= 0 and respec.commit(self):
+ *     gold += respec.get_refund() - respec.get_cost()
+ * @endcode
+ */
+class REBEL_FRAMEWORK AbilityRespec : public godot::RefCounted {
+    GDCLASS(AbilityRespec, godot::RefCounted);
+
+    godot::Ref<AbilityTree> m_tree{};
+
+    /** The live state commit() writes to. */
+    godot::Ref<AbilityState> m_target{};
+
+    /** The copy every edit goes to. */
+    godot::Ref<AbilityState> m_working{};
+
+    /** m_target's version and the tree's graph revision when the respec began. */
+    int64_t m_base_version{0};
+    int64_t m_base_revision{0};
+
+    /** Refund / cost totals, computed lazily; m_totals_version is m_working's version they match. */
+    float m_refund{0.0f};
+    float m_cost{0.0f};
+    int64_t m_totals_version{-1};
+
+    bool m_open{false};
+
+protected:
+    static void _bind_methods();
+
+public:
+    AbilityRespec() = default;
+
+    /** Starts a respec of @p state; returns false if it cannot (null state, another tree). */
+    bool begin(const godot::Ref<AbilityTree>& tree, const godot::Ref<AbilityState>& state);
+
+    /** @brief Returns whether the respec can still be edited and committed. */
+    [[nodiscard]] bool is_open() const;
+
+    /**
+     * @brief Locks @p node and every unlocked node that depended on it (see AbilityState::relock()).
+     * @return Ids of every relocked node.
+     */
+    godot::PackedInt32Array relock(const godot::Ref<AbilityNode>& node);
+
+    /**
+     * @brief Unlocks @p node if it is unlockable after the edits so far.
+     * @return True if the node was unlocked.
+     */
+    bool unlock(const godot::Ref<AbilityNode>& node);
+
+    /** @brief Sets the upgrade level of @p node (clamped to 0–10). */
+    void set_level(const godot::Ref<AbilityNode>& node, int level);
+
+    /** @brief Returns the state as it will be after commit(). */
+    [[nodiscard]] godot::Ref<AbilityState> get_preview() const;
+
+    /** @brief Returns the ids unlocked in the live state but locked in the preview. */
+    [[nodiscard]] godot::PackedInt32Array get_relocked_ids();
+
+    /** @brief Returns the unlock and improvement costs given back by the edits. */
+    [[nodiscard]] float get_refund();
+
+    /** @brief Returns the unlock and improvement costs the edits spend. */
+    [[nodiscard]] float get_cost();
+
+    /**
+     * @brief Applies every edit to the live state and updates @p character's containers.
+     *
+     * @param character The character whose containers follow the new unlocks,
+     *                  or null to only change the state.
+     * @return True if applied; false if the respec was closed or the live
+     *         state changed since it began (the respec is rolled back).
+     */
+    bool commit(godot::Node* character);
+
+    /** @brief Discards every edit and closes the respec. */
+    void rollback();
+
+private:
+    /** Recomputes m_refund and m_cost if the preview changed. */
+    void update_totals();
+
+    /** Returns what @p ability is worth at @p level: its unlock cost plus every improvement up to @p level. */
+    [[nodiscard]] static float get_value(const Ability& ability, int level);
+};
+
+} // namespace Rebel::Ability
@@ -0,0 +1,106 @@
+// Copyright (c) 2026, and future.
+// Alejandro Morcillo Montejo - All Rights Reserved
+
+#pragma once
+
+#include "Rebel/Core.hpp"
+#include <godot_cpp/classes/object.hpp>
+#include <godot_cpp/templates/hash_map.hpp>
+#include <godot_cpp/variant/string_name.hpp>
+
+#include <cstdint>
+#include <vector>
+
+namespace godot {
+class SceneTree;
+}
+
+namespace Rebel::Ability {
+
+class AbilityBehaviour;
+
+/**
+ * @brief Drives tick() on every active AbilityBehaviour in batched, per-class loops.
+ *
+ * Behaviours are grouped by class, and each group is a dense array of
+ * pointers: adding is an append, removing is a swap with the last element.
+ * Once per frame, on the SceneTree's `process_frame`, the scheduler walks the
+ * groups in registration order and ticks every member. Consecutive calls hit
+ * the same tick() override, and none of them go through the scene tree's
+ * process list. A behaviour ticks only while it can process, as _process()
+ * would: pausing skips it unless its process_mode says otherwise, and a
+ * disabled behaviour (or one under a disabled ancestor) is unscheduled.
+ *
+ * Behaviours may activate or deactivate others (or themselves) from inside
+ * tick(). Removals during a tick leave a hole that is compacted afterwards.
+ * Additions are appended and first ticked on the next frame.
+ *
+ * Registered as the `AbilityScheduler` engine singleton.
+ */
+class REBEL_FRAMEWORK AbilityScheduler : public godot::Object {
+    GDCLASS(AbilityScheduler, godot::Object);
+
+    static AbilityScheduler* s_singleton;
+
+    /** Every active behaviour of one class. */
+    struct ClassGroup {
+        godot::StringName class_name{};
+        std::vector<AbilityBehaviour*> members{};
+        uint32_t holes{0};
+    };
+
+    std::vector<ClassGroup> m_groups{};
+    godot::HashMap<godot::StringName, int32_t> m_group_by_class{};
+
+    int m_behaviour_count{0};
+
+    /** True while tick() walks the groups; removals then leave holes. */
+    bool m_ticking{false};
+
+    /** SceneTree whose process_frame drives the scheduler. */
+    uint64_t m_tree_id{0};
+
+    /** Process frame in which the scheduler last ticked. */
+    uint64_t m_last_frame{0};
+
+protected:
+    static void _bind_methods();
+
+public:
+    AbilityScheduler();
+    ~AbilityScheduler() override;
+
+    /** @brief Returns the engine-wide instance. */
+    static AbilityScheduler* get_singleton();
+
+    /** @brief Starts ticking @p behaviour; hooks the scheduler into @p tree. */
+    void add(AbilityBehaviour* behaviour, godot::SceneTree* tree);
+
+    /** @brief Stops ticking @p behaviour. */
+    void remove(AbilityBehaviour* behaviour);
+
+    /**
+     * @brief Ticks every scheduled behaviour now.
+     *
+     * Called automatically once per frame; only call it manually when time
+     * has to move without the SceneTree (e.g. tests).
+     */
+    void tick(double delta);
+
+    /** @brief Returns the number of scheduled behaviours. */
+    [[nodiscard]] int get_behaviour_count() const;
+
+    /** @brief Returns the number of behaviour classes scheduled so far. */
+    [[nodiscard]] int get_class_count() const;
+
+private:
+    /** Drops the holes left by removals during tick(). */
+    void compact();
+
+    void connect_tree(godot::SceneTree* tree);
+
+    /** process_frame handler: ticks with the root's process delta once per frame. */
+    void process_frame();
+};
+
+} // namespace Rebel::Ability
@@ -8,6 +8,8 @@
 #include <godot_cpp/classes/node.hpp>
 #include <godot_cpp/core/gdvirtual.gen.inc>
 
+#include <cstdint>
+
 namespace Rebel::Ability {
 
 /**
@@ -38,6 +40,16 @@ namespace Rebel::Ability {
  *     print("Ability ended!")
  * @endcode
  *
+ * Cooldowns run on the TimerServer rather than in _process(), so they keep
+ * counting while the container is disabled and cost nothing per frame:
+ *
+ * @code
+ * func use() -> void:
+ *     if is_on_cooldown():
+ *         return
+ *     start_cooldown(2.5)
+ * @endcode
+ *
  * @note The character node is always accessible via get_parent() since this
  *       node is a direct child of the character scene root.
  */
@@ -48,12 +60,26 @@ class REBEL_FRAMEWORK AbilityScriptContainerNode : public godot::Node {
      * @brief The Ability resource this container corresponds to.
      *
      * Set in the Godot Inspector. AbilityTree matches containers to AbilityNodes
-     * by comparing this reference against AbilityNode::get_ability(). Must be
+     * by the ability's registry id (see Ability::get_registry_id()). Must be
      * unique per character — two containers on the same character should not
      * reference the same Ability resource.
      */
     godot::Ref<Ability> m_ability{};
 
+    /**
+     * @brief AbilityRegistry key of the ability, used instead of `ability`.
+     *
+     * Lets a character scene name its abilities without loading their
+     * definitions; resolve_ability() looks the key up in the registry.
+     */
+    godot::String m_ability_id{};
+
+    /** Whether on_activated() has run without a matching on_deactivated(). */
+    bool m_active{false};
+
+    /** TimerServer handle of the running cooldown (0 = none). */
+    int64_t m_cooldown_timer{0};
+
 protected:
     static void _bind_methods();
 
@@ -65,8 +91,14 @@ public:
      */
     AbilityScriptContainerNode();
 
+    /** @brief Cancels a running cooldown so the TimerServer never calls into a freed node. */
+    ~AbilityScriptContainerNode() override;
+
     /**
      * @brief Sets the Ability resource this container serves.
+     *
+     * Emits `ability_changed`, so AbilityTree re-indexes the character.
+     *
      * @param ability The ability resource assigned in the Inspector.
      */
     void set_ability(const godot::Ref<Ability>& ability);
@@ -77,6 +109,33 @@ public:
      */
     [[nodiscard]] godot::Ref<Ability> get_ability() const;
 
+    /**
+     * @brief Returns the served ability, loading it through AbilityRegistry if only `ability_id` is set.
+     * @return The ability, or null if none is configured or it fails to load.
+     */
+    [[nodiscard]] godot::Ref<Ability> resolve_ability() const;
+
+    /**
+     * @brief Sets the AbilityRegistry key of the ability this container serves.
+     *
+     * Emits `ability_changed`, so AbilityTree re-indexes the character.
+     *
+     * @param ability_id Registry key; takes precedence over the `ability` resource.
+     */
+    void set_ability_id(const godot::String& ability_id);
+
+    /**
+     * @brief Returns the AbilityRegistry key set in the Inspector.
+     * @return The key, may be empty.
+     */
+    [[nodiscard]] godot::String get_ability_id() const;
+
+    /**
+     * @brief Returns the integer registry id of the served ability without loading it.
+     * @return The id, or 0 if no ability is configured.
+     */
+    [[nodiscard]] int64_t get_ability_registry_id() const;
+
     /**
      * @brief Enables the node and notifies it that its ability was activated.
      *
@@ -97,8 +156,33 @@ public:
      */
     virtual void on_deactivated();
 
+    /**
+     * @brief Returns whether the container is currently activated.
+     * @return True between on_activated() and on_deactivated().
+     */
+    [[nodiscard]] bool is_active() const;
+
+    /**
+     * @brief Starts (or restarts) the cooldown; emits `cooldown_finished` when it runs out.
+     * @param seconds Cooldown length.
+     */
+    void start_cooldown(double seconds);
+
+    /** @brief Stops the cooldown without emitting `cooldown_finished`. */
+    void cancel_cooldown();
+
+    /** @brief Returns whether a cooldown is running. */
+    [[nodiscard]] bool is_on_cooldown() const;
+
+    /** @brief Returns the seconds left on the cooldown (0 when ready). */
+    [[nodiscard]] double get_cooldown_remaining() const;
+
     GDVIRTUAL0(_on_activated)
     GDVIRTUAL0(_on_deactivated)
+
+private:
+    /** TimerServer callback for the cooldown timer. */
+    static void on_cooldown_expired(void* context, int64_t handle, uint64_t payload);
 };
 
 } // namespace Rebel::Ability
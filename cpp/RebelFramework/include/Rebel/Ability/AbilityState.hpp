@@ -0,0 +1,199 @@
+// Copyright (c) 2026, and future.
+// Alejandro Morcillo Montejo - All Rights Reserved
+
+#pragma once
+
+#include "Rebel/Core.hpp"
+#include "Rebel/Ability/AbilityGraph.hpp"
+#include "Rebel/Ability/AbilityTree.hpp"
+#include "Rebel/Attribute/AttributeSet.hpp"
+#include <godot_cpp/classes/resource.hpp>
+#include <godot_cpp/variant/packed_byte_array.hpp>
+#include <godot_cpp/variant/packed_int32_array.hpp>
+
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace Rebel::Ability {
+
+/**
+ * @brief One character's progress through an AbilityTree.
+ *
+ * Ability, AbilityNode and AbilityTree are shared, read-only definitions;
+ * everything that differs between characters lives here: which nodes are
+ * unlocked and the current upgrade level of each. Internally that is the
+ * tree's AbilityUnlockState (enabled and unlockable bitsets plus a missing
+ * prerequisite count per node) and one byte per node for the level, so
+ * hundreds of enemies can share one tree definition at a few bytes each.
+ *
+ * Node conditions that read attributes are evaluated against the character's
+ * AttributeSet (set_attributes()); they are re-evaluated when an attribute
+ * changes, when a prerequisite unlocks and when a prerequisite's level
+ * changes.
+ *
+ * relock() locks a node and, through the graph's dependents index, every
+ * unlocked node whose condition no longer holds without it. To relock,
+ * refund and re-unlock several nodes as one all-or-nothing step, use an
+ * AbilityRespec (AbilityTree::begin_respec()).
+ *
+ * Node ids are the indices of AbilityTree::nodes. If the tree's node list
+ * changes, the state is re-seeded from its enabled ids on next access.
+ *
+ * Serializable as part of a save: `enabled_ids` and `levels` are the stored
+ * properties.
+ */
+class REBEL_FRAMEWORK AbilityState : public godot::Resource {
+    GDCLASS(AbilityState, godot::Resource);
+
+    /** The definition this state tracks progress through. */
+    godot::Ref<AbilityTree> m_tree{};
+
+    /** Enabled / unlockable bits and missing prerequisite counts. */
+    AbilityUnlockState m_unlock{};
+
+    /** Current upgrade level per node (0 = none, 1–10). */
+    std::vector<uint8_t> m_levels{};
+
+    /** Graph revision m_unlock was built for (-1 = must be rebuilt). */
+    int64_t m_revision{-1};
+
+    /** The character's attributes, read by node conditions (not serialized). */
+    godot::Ref<Attribute::AttributeSet> m_attributes{};
+
+    /** Enabled ids waiting to be applied once the graph is available (e.g. while loading). */
+    godot::PackedInt32Array m_pending_enabled{};
+
+    /** Bumped by every change to the progress; lets an AbilityRespec detect concurrent edits. */
+    int64_t m_version{0};
+
+protected:
+    static void _bind_methods();
+
+public:
+    AbilityState() = default;
+
+    /** @brief Sets the tree this state belongs to; progress is kept by node id. */
+    void set_tree(const godot::Ref<AbilityTree>& tree);
+    /** @brief Returns the tree this state belongs to. */
+    [[nodiscard]] godot::Ref<AbilityTree> get_tree() const;
+
+    /** @brief Sets the attributes node conditions read; conditions are re-evaluated. */
+    void set_attributes(const godot::Ref<Attribute::AttributeSet>& attributes);
+    /** @brief Returns the attributes node conditions read. */
+    [[nodiscard]] godot::Ref<Attribute::AttributeSet> get_attributes() const;
+
+    /** @brief Returns whether @p node is unlocked for this character. */
+    [[nodiscard]] bool is_enabled(const godot::Ref<AbilityNode>& node);
+
+    /** @brief Returns whether @p ability is unlocked for this character. */
+    [[nodiscard]] bool is_ability_enabled(const godot::Ref<Ability>& ability);
+
+    /** @brief Returns whether @p node is locked and its condition (by default: every prerequisite unlocked) holds. */
+    [[nodiscard]] bool is_unlockable(const godot::Ref<AbilityNode>& node);
+
+    /**
+     * @brief Unlocks @p node if it is currently unlockable.
+     * @return True if the node was unlocked by this call.
+     */
+    bool unlock(const godot::Ref<AbilityNode>& node);
+
+    /**
+     * @brief Locks @p node and every unlocked node that depended on it.
+     *
+     * Dependents are visited through the graph's dependents index; one stays
+     * unlocked if its condition still holds without the relocked nodes (e.g.
+     * an `any()` condition with another unlocked prerequisite). Relocked
+     * nodes drop to level 0. Containers are not touched; see AbilityRespec.
+     *
+     * @return Ids of every relocked node, @p node first; empty if it was not unlocked.
+     */
+    godot::PackedInt32Array relock(const godot::Ref<AbilityNode>& node);
+
+    /** @brief Returns every node that can be unlocked right now, in node-list order. */
+    [[nodiscard]] godot::Array get_unlockable_nodes();
+
+    /** @brief Returns the ids of every node that can be unlocked right now. */
+    [[nodiscard]] godot::PackedInt32Array get_unlockable_ids();
+
+    /** @brief Sets the upgrade level of @p node (clamped to 0–10); locked nodes only accept 0. */
+    void set_level(const godot::Ref<AbilityNode>& node, int level);
+    /** @brief Returns the upgrade level of @p node (0 = none). */
+    [[nodiscard]] int get_level(const godot::Ref<AbilityNode>& node);
+
+    /**
+     * @brief Returns the improvement active for @p node at its current level.
+     * @return The improvement, or null at level 0.
+     */
+    [[nodiscard]] godot::Ref<AbilityImprovement> get_active_improvement(const godot::Ref<AbilityNode>& node);
+
+    /**
+     * @brief Returns the description of @p node's ability filled in for this character.
+     *
+     * Reads this state's attributes and the node's current level. Memoized
+     * per ability and attribute set until one of the values it references
+     * changes.
+     */
+    [[nodiscard]] godot::String get_description(const godot::Ref<AbilityNode>& node);
+
+    /** @brief Returns the description of the active improvement of @p node filled in for this character; empty at level 0. */
+    [[nodiscard]] godot::String get_improvement_description(const godot::Ref<AbilityNode>& node);
+
+    /** @brief Sets the unlocked node ids (storage; replaces the current progress). */
+    void set_enabled_ids(const godot::PackedInt32Array& ids);
+    /** @brief Returns the unlocked node ids. */
+    [[nodiscard]] godot::PackedInt32Array get_enabled_ids();
+
+    /** @brief Sets the level of every node, indexed by node id (storage). */
+    void set_levels(const godot::PackedByteArray& levels);
+    /** @brief Returns the level of every node, indexed by node id. */
+    [[nodiscard]] godot::PackedByteArray get_levels() const;
+
+    /** @brief Locks every node and resets every level to 0. */
+    void reset();
+
+    // --- Native access ---
+
+    /** Returns the unlock state, re-seeded first if the tree changed; null without a tree. */
+    const AbilityUnlockState* get_unlock_state();
+
+    /** Returns the level of every node by id; valid until the next call that re-seeds the state. */
+    [[nodiscard]] std::span<const uint8_t> levels_view();
+
+    /** Returns the node id for @p node, or -1. */
+    [[nodiscard]] int32_t find_node(const AbilityNode* node);
+
+    /** Returns a counter bumped by every change to the progress. */
+    [[nodiscard]] int64_t get_version() const { return m_version; }
+
+    /** Relocks @p id and its dependents as relock() does, appending every relocked id. */
+    void relock_id(int32_t id, std::vector<int32_t>& r_relocked);
+
+    /**
+     * Returns a detached copy of the progress for the same tree. The copy
+     * reads the same attributes but does not watch them.
+     */
+    [[nodiscard]] godot::Ref<AbilityState> duplicate_progress();
+
+    /**
+     * Replaces the progress with @p source's in one change (one `changed`
+     * emission), then re-evaluates attribute conditions against this state's
+     * attributes.
+     */
+    void assign_progress(const AbilityState& source);
+
+private:
+    /** Re-seeds m_unlock when the tree's graph was rebuilt. Returns false without a tree. */
+    bool sync();
+
+    /** Bumps the version and emits `changed`. */
+    void mark_changed();
+
+    /** Returns what node conditions read for this character. */
+    [[nodiscard]] AbilityConditionContext make_context() const;
+
+    /** Re-evaluates the conditions that read attributes. */
+    void on_attributes_changed(const godot::PackedInt32Array& indices);
+};
+
+} // namespace Rebel::Ability
@@ -0,0 +1,239 @@
+// Copyright (c) 2026, and future.
+// Alejandro Morcillo Montejo - All Rights Reserved
+
+#pragma once
+
+#include "Rebel/Core.hpp"
+#include <godot_cpp/variant/array.hpp>
+#include <godot_cpp/variant/string_name.hpp>
+#include <godot_cpp/variant/variant.hpp>
+
+#include <coroutine>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+
+namespace godot {
+class AnimationMixer;
+class Object;
+}
+
+namespace Rebel::Ability {
+
+/**
+ * @brief Size-class free lists that back every AbilityTask coroutine frame.
+ *
+ * Frames up to MAX_POOLED_SIZE bytes are carved from blocks of FRAMES_PER_BLOCK
+ * and recycled on destruction, so starting the same ability coroutine every
+ * cast never reaches the system allocator after warm-up. Larger frames fall
+ * back to ::operator new. Main thread only, like the executor.
+ */
+class REBEL_FRAMEWORK AbilityTaskFramePool {
+public:
+    static constexpr size_t MIN_POOLED_SIZE = 64;
+    static constexpr size_t MAX_POOLED_SIZE = 4096;
+    static constexpr int FRAMES_PER_BLOCK = 16;
+
+    static void* allocate(size_t size);
+    static void deallocate(void* frame, size_t size);
+
+    /** Returns the bytes held by the pool, in use or free. */
+    [[nodiscard]] static size_t get_reserved_bytes();
+};
+
+/**
+ * @brief A native coroutine for ability logic that spans several frames.
+ *
+ * Sequences like "charge 0.5 s, dash, wait for landing, fire 3 projectiles
+ * 0.1 s apart" are written top to bottom instead of as a state machine in
+ * tick():
+ *
+ * @code
+ * AbilityTask Dash::run() {
+ *     co_await AbilityTask::seconds(0.5);
+ *     start_dash();
+ *     co_await AbilityTask::signal(m_body, "landed");
+ *     for (int i = 0; i < 3; ++i) {
+ *         spawn_projectile();
+ *         co_await AbilityTask::seconds(0.1);
+ *     }
+ * }
+ *
+ * void Dash::on_activated() {
+ *     AbilityBehaviour::on_activated();
+ *     m_task = run();
+ *     m_task.start();
+ * }
+ *
+ * void Dash::on_deactivated() {
+ *     m_task = {};            // cancels wherever it is suspended
+ *     AbilityBehaviour::on_deactivated();
+ * }
+ * @endcode
+ *
+ * A task is lazy: it runs up to its first suspension on start(). The
+ * AbilityTask object owns the coroutine; destroying or reassigning it cancels
+ * the coroutine and its pending wait. Do not do that from inside the task
+ * itself. Tasks can `co_await` other tasks, which start right away and
+ * resume the caller when they finish.
+ *
+ * Waits are resumed by the AbilityTaskExecutor. A suspended task costs
+ * nothing per frame: durations sit in the TimerServer wheel, signal waits
+ * are a one-off connection, and only frame waits are queued for the next
+ * frame. Frames come from AbilityTaskFramePool.
+ */
+class REBEL_FRAMEWORK AbilityTask {
+public:
+    /** No pending wait. */
+    static constexpr uint32_t NO_WAIT = UINT32_MAX;
+
+    struct promise_type {
+        /** The task awaiting this one, resumed on completion. */
+        std::coroutine_handle<> continuation{};
+
+        /** Executor wait the coroutine is suspended on, NO_WAIT otherwise. */
+        uint32_t wait{NO_WAIT};
+
+        /** Set once the coroutine first runs (start() or an awaiting task). */
+        bool started{false};
+
+        promise_type() = default;
+        promise_type(const promise_type&) = delete;
+        promise_type& operator=(const promise_type&) = delete;
+        ~promise_type();
+
+        AbilityTask get_return_object() noexcept {
+            return AbilityTask(std::coroutine_handle<promise_type>::from_promise(*this));
+        }
+
+        std::suspend_always initial_suspend() noexcept { return {}; }
+
+        struct FinalAwaiter {
+            bool await_ready() const noexcept { return false; }
+            std::coroutine_handle<> await_suspend(std::coroutine_handle<promise_type> handle) noexcept {
+                const std::coroutine_handle<> next = handle.promise().continuation;
+                return next ? next : std::noop_coroutine();
+            }
+            void await_resume() const noexcept {}
+        };
+
+        FinalAwaiter final_suspend() noexcept { return {}; }
+
+        void return_void() noexcept {}
+
+        // Built without exceptions; nothing can reach here.
+        void unhandled_exception() noexcept { std::terminate(); }
+
+        static void* operator new(const size_t size) { return AbilityTaskFramePool::allocate(size); }
+        static void operator delete(void* frame, const size_t size) { AbilityTaskFramePool::deallocate(frame, size); }
+    };
+
+    using Handle = std::coroutine_handle<promise_type>;
+
+    /** What a wait suspends on. */
+    enum class WaitKind : uint8_t {
+        Free,
+        ProcessFrame,
+        PhysicsFrame,
+        Duration,
+        Signal,
+    };
+
+    /**
+     * @brief Awaitable returned by next_frame(), next_physics_frame(), seconds(), signal() and animation().
+     *
+     * `co_await` yields the arguments of the signal that resumed the task
+     * (an empty Array for every other kind, or if nothing could be awaited).
+     */
+    struct Wait {
+        WaitKind kind{WaitKind::ProcessFrame};
+        double seconds{0.0};
+        uint64_t object_id{0};
+        godot::StringName signal_name{};
+        godot::Variant match{};
+        godot::Array result{};
+
+        bool await_ready() const noexcept { return false; }
+
+        /** Registers with the executor; returns false (resume now) if it cannot wait. */
+        bool await_suspend(Handle handle);
+
+        godot::Array await_resume() { return result; }
+    };
+
+private:
+    Handle m_handle{};
+
+    explicit AbilityTask(const Handle handle) : m_handle(handle) {}
+
+public:
+    AbilityTask() = default;
+    AbilityTask(AbilityTask&& other) noexcept : m_handle(other.m_handle) { other.m_handle = {}; }
+    AbilityTask& operator=(AbilityTask&& other) noexcept;
+    AbilityTask(const AbilityTask&) = delete;
+    AbilityTask& operator=(const AbilityTask&) = delete;
+    ~AbilityTask();
+
+    /** @brief Runs the task up to its first suspension; no-op if already started or empty. */
+    void start();
+
+    /** @brief Destroys the coroutine and cancels its pending wait. */
+    void cancel();
+
+    /** @brief Returns whether the task holds a coroutine. */
+    [[nodiscard]] bool is_valid() const { return static_cast<bool>(m_handle); }
+
+    /** @brief Returns whether the task ran to completion. */
+    [[nodiscard]] bool is_done() const { return m_handle && m_handle.done(); }
+
+    /** @brief Returns whether the task is suspended on a wait. */
+    [[nodiscard]] bool is_waiting() const { return m_handle && m_handle.promise().wait != NO_WAIT; }
+
+    // --- Awaitables ---
+
+    /** @brief Resumes on the next process frame. */
+    [[nodiscard]] static Wait next_frame();
+
+    /** @brief Resumes on the next physics frame. */
+    [[nodiscard]] static Wait next_physics_frame();
+
+    /** @brief Resumes after @p seconds of (unpaused) game time, on a TimerServer tick. */
+    [[nodiscard]] static Wait seconds(double seconds);
+
+    /**
+     * @brief Resumes when @p object emits @p signal.
+     *
+     * If @p match is not null, only an emission whose first argument equals
+     * it resumes the task. Resumes immediately, with an empty result, if
+     * @p object is null or has no such signal; if it is freed while waiting,
+     * the task stays suspended until cancelled.
+     */
+    [[nodiscard]] static Wait signal(godot::Object* object, const godot::StringName& signal, const godot::Variant& match = godot::Variant());
+
+    /**
+     * @brief Resumes when @p mixer finishes @p animation.
+     *
+     * For an event in the middle of an animation, have a method track emit a
+     * signal and await it with signal().
+     */
+    [[nodiscard]] static Wait animation(godot::AnimationMixer* mixer, const godot::StringName& animation);
+
+    // --- Nesting ---
+
+    struct Awaiter {
+        Handle handle;
+
+        bool await_ready() const noexcept { return !handle || handle.done(); }
+        std::coroutine_handle<> await_suspend(const std::coroutine_handle<> caller) noexcept {
+            handle.promise().continuation = caller;
+            handle.promise().started = true;
+            return handle;
+        }
+        void await_resume() const noexcept {}
+    };
+
+    /** Starts the task and resumes the caller when it finishes. The task must not have been started. */
+    Awaiter operator co_await() && noexcept { return Awaiter{m_handle}; }
+};
+
+} // namespace Rebel::Ability
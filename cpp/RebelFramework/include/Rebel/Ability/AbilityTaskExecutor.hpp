@@ -0,0 +1,144 @@
+// Copyright (c) 2026, and future.
+// Alejandro Morcillo Montejo - All Rights Reserved
+
+#pragma once
+
+#include "Rebel/Core.hpp"
+#include "Rebel/Ability/AbilityTask.hpp"
+#include <godot_cpp/classes/object.hpp>
+#include <godot_cpp/variant/callable.hpp>
+
+#include <coroutine>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace godot {
+class SceneTree;
+}
+
+namespace Rebel::Ability {
+
+/**
+ * @brief Resumes suspended AbilityTask coroutines.
+ *
+ * Every `co_await` on an AbilityTask::Wait becomes one record in a pooled
+ * array, addressed by index and generation like TimerServer handles, so a
+ * cancelled wait can never resume whatever reused its record:
+ *   - **Frame waits** are queued and resumed on the SceneTree's next
+ *     `process_frame` or `physics_frame`. Both queues stand still while
+ *     the tree is paused.
+ *   - **Durations** are native TimerServer timers; the wheel resumes them.
+ *   - **Signal waits** connect a small custom Callable to the emitter and
+ *     disconnect it once resumed or cancelled.
+ *
+ * Only frame waits cost anything per frame, and only for the frame they wait
+ * for. A task destroyed while suspended cancels its record from the
+ * promise's destructor.
+ *
+ * Registered as the `AbilityTaskExecutor` engine singleton.
+ */
+class REBEL_FRAMEWORK AbilityTaskExecutor : public godot::Object {
+    GDCLASS(AbilityTaskExecutor, godot::Object);
+
+    static AbilityTaskExecutor* s_singleton;
+
+    static constexpr uint32_t NIL = UINT32_MAX;
+
+    using WaitKind = AbilityTask::WaitKind;
+
+    /** One suspended coroutine. */
+    struct WaitRecord {
+        std::coroutine_handle<> handle{};
+        uint32_t* owner{nullptr};          ///< The promise's `wait` field, reset on resume.
+        godot::Array* result{nullptr};     ///< The awaiter's result, filled by signal waits.
+        int64_t timer{0};
+        uint64_t object_id{0};
+        godot::StringName signal_name{};
+        godot::Callable callable{};
+        godot::Variant match{};
+        uint32_t generation{1};
+        WaitKind kind{WaitKind::Free};
+    };
+
+    std::vector<WaitRecord> m_waits{};
+    std::vector<uint32_t> m_free_waits{};
+    int m_wait_count{0};
+
+    /** (record, generation) of the frame waits for the next process / physics frame. */
+    std::vector<std::pair<uint32_t, uint32_t>> m_process_queue{};
+    std::vector<std::pair<uint32_t, uint32_t>> m_physics_queue{};
+
+    /** Scratch swapped with a queue while it is drained. */
+    std::vector<std::pair<uint32_t, uint32_t>> m_draining{};
+
+    /** SceneTree whose frame signals drive the queues. */
+    uint64_t m_tree_id{0};
+
+    uint64_t m_last_process_frame{0};
+    uint64_t m_last_physics_frame{0};
+
+protected:
+    static void _bind_methods();
+
+public:
+    AbilityTaskExecutor();
+    ~AbilityTaskExecutor() override;
+
+    /** @brief Returns the engine-wide instance. */
+    static AbilityTaskExecutor* get_singleton();
+
+    /**
+     * Suspends @p handle on @p wait; @p owner is set to the record index.
+     * Returns false if the wait cannot be registered (resume immediately).
+     */
+    bool suspend(AbilityTask::Wait& wait, std::coroutine_handle<> handle, uint32_t* owner);
+
+    /** Cancels the wait in record @p index without resuming it. */
+    void cancel(uint32_t index);
+
+    /** Resumes record @p index with @p arguments if it is still the wait of @p generation. */
+    void resume_signal(uint32_t index, uint32_t generation, const godot::Array& arguments);
+
+    /**
+     * @brief Resumes every task waiting for a process frame now.
+     *
+     * Called automatically once per frame; only call it manually when time
+     * has to move without the SceneTree (e.g. tests).
+     */
+    void process_frames();
+
+    /** @brief Resumes every task waiting for a physics frame now; see process_frames(). */
+    void process_physics_frames();
+
+    /** @brief Returns the number of suspended tasks. */
+    [[nodiscard]] int get_wait_count() const;
+
+    /** @brief Returns the bytes reserved by the coroutine frame pool. */
+    [[nodiscard]] int64_t get_frame_pool_bytes() const;
+
+private:
+    uint32_t allocate();
+
+    /** Disconnects / cancels whatever the record waits on and frees it. */
+    void release(uint32_t index);
+
+    /** Frees the record and resumes its coroutine. */
+    void resume(uint32_t index);
+
+    /** Resumes every live entry of @p queue. */
+    void drain(std::vector<std::pair<uint32_t, uint32_t>>& queue);
+
+    /** TimerServer native callback for duration waits. */
+    static void on_timer(void* context, int64_t handle, uint64_t payload);
+
+    void connect_tree(godot::SceneTree* tree);
+
+    /** process_frame handler: drains the process queue once per frame. */
+    void process_frame();
+
+    /** physics_frame handler: drains the physics queue once per physics frame. */
+    void physics_frame();
+};
+
+} // namespace Rebel::Ability
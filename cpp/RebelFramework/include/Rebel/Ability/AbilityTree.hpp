@@ -4,14 +4,22 @@
 #pragma once
 
 #include "Rebel/Core.hpp"
+#include "Rebel/Ability/AbilityGraph.hpp"
 #include "Rebel/Ability/AbilityScriptContainerNode.hpp"
 #include "Rebel/Ability/AbilityNode.hpp"
 #include <godot_cpp/classes/node.hpp>
 #include <godot_cpp/classes/resource.hpp>
+#include <godot_cpp/templates/hash_map.hpp>
 #include <godot_cpp/variant/array.hpp>
+#include <godot_cpp/variant/dictionary.hpp>
+#include <godot_cpp/variant/packed_int32_array.hpp>
 
 namespace Rebel::Ability {
 
+class AbilityIconAtlas;
+class AbilityRespec;
+class AbilityState;
+
 /**
  * @brief The complete ability tree for a character or system.
  *
@@ -20,9 +28,25 @@ namespace Rebel::Ability {
  * relationships explicitly. This keeps the data structure simple and makes it
  * easy to serialise as a single .tres file.
  *
+ * The tree is a shared, read-only definition: per-character progress
+ * (unlocked nodes, upgrade levels) lives in an AbilityState created with
+ * create_state(). At runtime the node list is compiled into an AbilityGraph
+ * (integer ids, CSR prerequisite/dependent edges) that every state indexes
+ * into; unlocking updates the state's unlockable set incrementally, so
+ * AbilityState::get_unlockable_nodes() is a bit scan rather than a walk over
+ * every node's prerequisites.
+ *
+ * set_nodes() compiles and validates the graph immediately, reporting
+ * dangling prerequisites, duplicate nodes or abilities and prerequisite
+ * cycles, and caches the root nodes and the topological depth layers used to
+ * lay out the tree UI. Editing a node's prerequisites or ability afterwards
+ * marks the graph stale; it is rebuilt on the next query and every state
+ * re-seeds itself from its stored node ids.
+ *
  * Typical usage:
  *   1. Author the tree in the Godot editor (add nodes, assign prerequisites).
- *   2. Attach the tree to a character via a property.
+ *   2. Attach the tree to a character via a property; the character keeps
+ *      its own AbilityState.
  *   3. Call try_unlock() when the player attempts to unlock an ability.
  *   4. Call get_root_nodes() to know where to start rendering the tree UI.
  *
@@ -39,6 +63,47 @@ class REBEL_FRAMEWORK AbilityTree : public godot::Resource {
      */
     godot::Array m_nodes{};
 
+    /** Icons of every ability in the tree, baked by AbilityIconAtlasBaker (optional). */
+    godot::Ref<AbilityIconAtlas> m_icon_atlas{};
+
+    /**
+     * @brief Ability → container lookup for one character.
+     *
+     * Keyed by AbilityRegistry id, so building it never loads a container's
+     * ability; values are container instance ids so a freed container never
+     * leaves a dangling pointer behind. Lookups re-validate the hit.
+     */
+    struct ContainerIndex {
+        godot::HashMap<int64_t, uint64_t> containers_by_ability{};
+        bool valid{false};
+        bool connected{false};
+    };
+
+    /**
+     * @brief Container indices keyed by character instance id.
+     *
+     * Built on the first lookup for a character in the scene tree,
+     * invalidated when an AbilityScriptContainerNode is added to or removed
+     * from it or changes ability, and dropped when the character leaves the
+     * scene tree. Off-tree characters are scanned, not indexed.
+     */
+    godot::HashMap<uint64_t, ContainerIndex> m_container_indices{};
+
+    /** Compiled prerequisite graph of m_nodes. */
+    AbilityGraph m_graph{};
+
+    /** Bumped every time m_graph is rebuilt so states know to re-seed. */
+    int64_t m_graph_revision{0};
+
+    /** Set when m_nodes changed and m_graph must be rebuilt. */
+    bool m_graph_dirty{true};
+
+    /** Cached get_root_nodes() result. */
+    godot::Array m_root_nodes{};
+
+    /** Cached get_depth_layers() result: Array of Array of Ref<AbilityNode>. */
+    godot::Array m_depth_layers{};
+
 protected:
     static void _bind_methods();
 
@@ -57,50 +122,135 @@ public:
      */
     [[nodiscard]] godot::Array get_nodes() const;
 
+    /** @brief Sets the baked icon atlas the UI draws this tree's icons from. */
+    void set_icon_atlas(const godot::Ref<AbilityIconAtlas>& atlas);
+    /** @brief Returns the baked icon atlas, or null if the icons were never baked. */
+    [[nodiscard]] godot::Ref<AbilityIconAtlas> get_icon_atlas() const;
+
     /**
      * @brief Returns nodes that have no prerequisites (tree entry points).
      *
-     * Iterates m_nodes and collects every AbilityNode whose prerequisites
-     * array is empty. These are the valid starting points for a UI tree render.
+     * The list is computed when the graph compiles and cached until the node
+     * list changes. These are the valid starting points for a UI tree render.
      *
      * @return Array of Ref<AbilityNode> with no prerequisites.
      */
-    [[nodiscard]] godot::Array get_root_nodes() const;
+    [[nodiscard]] godot::Array get_root_nodes();
 
     /**
-     * @brief Attempts to unlock a node's ability if prerequisites are satisfied.
+     * @brief Returns the nodes grouped by topological depth.
+     *
+     * Layer 0 holds the roots; every other node sits one layer below its
+     * deepest prerequisite. Nodes on a prerequisite cycle are left out.
      *
-     * Checks can_unlock() on the provided node. If true, sets the wrapped
-     * Ability's enabled flag to true and returns true. Returns false if:
-     *   - node is null
+     * @return Array of Array of Ref<AbilityNode>, one inner array per layer.
+     */
+    [[nodiscard]] godot::Array get_depth_layers();
+
+    /**
+     * @brief Returns the topological depth of @p node, or -1 if unknown or on a cycle.
+     */
+    [[nodiscard]] int get_node_depth(const godot::Ref<AbilityNode>& node);
+
+    /**
+     * @brief Returns the problems found when the graph was last compiled.
+     * @return One message per problem; empty when the tree is well-formed.
+     */
+    [[nodiscard]] godot::PackedStringArray get_validation_errors();
+
+    /**
+     * @brief Creates an empty per-character state for this tree.
+     * @return A new AbilityState with nothing unlocked.
+     */
+    [[nodiscard]] godot::Ref<AbilityState> create_state();
+
+    /**
+     * @brief Attempts to unlock a node for one character.
+     *
+     * Checks the node against @p state's unlockable set. If it is unlockable,
+     * marks it enabled in @p state and returns true. Returns false if:
+     *   - state or node is null, or the state belongs to another tree
      *   - node's wrapped Ability is null
      *   - prerequisites are not all enabled
-     *   - the ability is already enabled
+     *   - the node is already enabled
      *
-     * @param node The AbilityNode to unlock.
+     * @param state The character's progress.
+     * @param node  The AbilityNode to unlock.
      * @return True if the ability was successfully unlocked.
      */
-    bool try_unlock(const godot::Ref<AbilityNode>& node);
+    bool try_unlock(const godot::Ref<AbilityState>& state, const godot::Ref<AbilityNode>& node);
+
+    /**
+     * @brief Starts a transactional respec of @p state.
+     *
+     * Relocks, level changes and unlocks made through the returned
+     * AbilityRespec stay private until AbilityRespec::commit(), which applies
+     * them in one step and updates the character's containers.
+     *
+     * @return The open respec, or null if @p state is null or belongs to another tree.
+     */
+    [[nodiscard]] godot::Ref<AbilityRespec> begin_respec(const godot::Ref<AbilityState>& state);
+
+    /**
+     * @brief Returns the compiled id of @p node, or -1 if it is not in the tree.
+     */
+    [[nodiscard]] int get_node_id(const godot::Ref<AbilityNode>& node);
+
+    /**
+     * @brief Returns the node with compiled id @p id, or null.
+     */
+    [[nodiscard]] godot::Ref<AbilityNode> get_node_by_id(int id) const;
+
+    /**
+     * @brief Returns the UI-facing state of every node in one call.
+     *
+     * Each column is indexed by node id (the index into `nodes`):
+     *   - `unlocked`   (PackedInt32Array) — 1 if the node is unlocked in @p state.
+     *   - `unlockable` (PackedInt32Array) — 1 if it is locked and every prerequisite is unlocked.
+     *   - `affordable` (PackedInt32Array) — 1 if the next purchase (unlock, or the
+     *                  next improvement tier once unlocked) is possible and costs
+     *                  at most @p budget.
+     *   - `level`      (PackedInt32Array) — current upgrade level (0 = none).
+     *   - `next_cost`  (PackedFloat32Array) — cost of the next purchase: the unlock
+     *                  cost while locked, the next tier's cost once unlocked,
+     *                  0 at the last tier.
+     *
+     * @param state  The character's progress.
+     * @param budget Currency available to spend.
+     * @return Dictionary of columns, empty if @p state is null or belongs to another tree.
+     */
+    [[nodiscard]] godot::Dictionary query_state(const godot::Ref<AbilityState>& state, float budget);
+
+    /**
+     * @brief Returns the compiled graph, rebuilding it first if the node list changed.
+     */
+    const AbilityGraph& get_graph();
+
+    /**
+     * @brief Returns a counter bumped every time the graph is rebuilt.
+     */
+    [[nodiscard]] int64_t get_graph_revision() const;
 
     /**
      * @brief Unlocks an ability and activates its scene-resident container node.
      *
-     * Calls try_unlock() for the prerequisite/data check. Then searches the
-     * direct children of @p character for an AbilityScriptContainerNode whose
-     * ability property matches the node's ability. If found, calls
+     * Calls try_unlock() for the prerequisite/state check. Then looks up the
+     * AbilityScriptContainerNode child of @p character whose ability property
+     * matches the node's ability (see find_container()). If found, calls
      * on_activated() on it, enabling its processing.
      *
      * If no matching container is found the ability is still unlocked in data —
      * this is valid for passive abilities whose effects are applied by reading
      * the Ability resource directly.
      *
+     * @param state     The character's progress.
      * @param node      The AbilityNode to unlock.
      * @param character The character node whose children are searched for the
      *                  matching AbilityScriptContainerNode.
      * @return The activated AbilityScriptContainerNode, or nullptr if no
      *         matching container was found or if unlock failed.
      */
-    godot::Node* try_activate(const godot::Ref<AbilityNode>& node, godot::Node* character);
+    godot::Node* try_activate(const godot::Ref<AbilityState>& state, const godot::Ref<AbilityNode>& node, godot::Node* character);
 
     /**
      * @brief Calls on_deactivated() on the container node, disabling it.
@@ -112,6 +262,58 @@ public:
      * @param behavior_node The node returned by a previous try_activate() call.
      */
     void deactivate(godot::Node* behavior_node);
+
+    /**
+     * @brief Returns the container child of @p character serving @p ability.
+     *
+     * Containers are matched by the ability's registry id, so a container that
+     * names its ability through `ability_id` matches without being loaded.
+     * Uses the character's id → container index, building it on first use
+     * with a single pass over the children. Later lookups are a hash hit.
+     *
+     * @param ability   The Ability to look up.
+     * @param character The character whose direct children hold the containers.
+     * @return The matching container, or nullptr if there is none.
+     */
+    AbilityScriptContainerNode* find_container(const godot::Ref<Ability>& ability, godot::Node* character);
+
+    /**
+     * @brief Returns the container child of @p character serving the ability with registry id @p ability_id.
+     * @return The matching container, or nullptr if there is none.
+     */
+    AbilityScriptContainerNode* find_container_by_id(int64_t ability_id, godot::Node* character);
+
+    /**
+     * @brief Activates the container of every enabled ability on @p character.
+     *
+     * Walks the abilities enabled in @p state and calls on_activated() on each
+     * one's inactive container. Use after loading a
+     * save or spawning a character with pre-unlocked abilities.
+     *
+     * @param state     The character's progress.
+     * @param character The character whose containers are activated.
+     * @return Number of containers activated.
+     */
+    int activate_all_enabled(const godot::Ref<AbilityState>& state, godot::Node* character);
+
+private:
+    /** Rebuilds m_graph and the cached layouts if the node list changed. */
+    void ensure_compiled();
+
+    /** Marks the graph stale when one of the nodes is edited. */
+    void on_node_changed();
+
+    /** Returns the up-to-date index for @p character (inside the tree), (re)building it if needed. */
+    ContainerIndex& get_container_index(godot::Node* character);
+
+    /** Marks the character's index stale when a container child comes or goes. */
+    void on_character_child_changed(godot::Node* child, uint64_t character_id);
+
+    /** Marks the character's index stale when one of its containers changes ability. */
+    void on_container_ability_changed(uint64_t character_id);
+
+    /** Drops the character's index when it leaves the scene tree. */
+    void on_character_exiting(uint64_t character_id);
 };
 
 } // namespace Rebel::Ability
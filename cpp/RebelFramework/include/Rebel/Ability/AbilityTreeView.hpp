@@ -0,0 +1,201 @@
+// Copyright (c) 2026, and future.
+// Alejandro Morcillo Montejo - All Rights Reserved
+
+#pragma once
+
+#include "Rebel/Core.hpp"
+#include "Rebel/Ability/AbilityState.hpp"
+#include "Rebel/Ability/AbilityTree.hpp"
+#include <godot_cpp/classes/control.hpp>
+#include <godot_cpp/classes/packed_scene.hpp>
+#include <godot_cpp/variant/color.hpp>
+#include <godot_cpp/variant/rect2.hpp>
+#include <godot_cpp/variant/vector2.hpp>
+
+#include <cstdint>
+#include <vector>
+
+namespace Rebel::Ability {
+
+/**
+ * @brief Draws an AbilityTree, creating widgets only for the nodes on screen.
+ *
+ * Nodes are laid out from the tree's compiled graph. Each depth layer is a
+ * row, and each node sits in its layer's node-list order, centred on the
+ * widest row. Nodes on a prerequisite cycle are not shown. The view sets
+ * its minimum size to the whole layout, so it scrolls inside a
+ * ScrollContainer like any other Control.
+ *
+ * Only the nodes that intersect the visible region (the nearest clipping
+ * ancestor, or the viewport) get a widget. Widgets come from a pool:
+ * scrolling hides the ones that leave the region and hands them to the
+ * nodes that enter it, so the number of widgets tracks the screen size,
+ * not the tree size. Finding the visible nodes is a binary search per
+ * visible row. The edges on screen are drawn in a single _draw(), as two
+ * batched multilines (unlocked and locked), with no Line2D or Control per
+ * edge. Only the rows from the highest one an on-screen edge can start in
+ * down to the last visible row are walked.
+ *
+ * Widgets are instances of `node_scene`. Without a scene, a TextureButton
+ * shows the node's icon: from the tree's `icon_atlas` when baked, otherwise
+ * the ability's icon. It is dimmed while the node is locked. Each time a
+ * widget is assigned to a node, `widget_bound` is emitted so a script can
+ * fill it in. Pressing a button widget emits `node_pressed`.
+ */
+class REBEL_FRAMEWORK AbilityTreeView : public godot::Control {
+    GDCLASS(AbilityTreeView, godot::Control);
+
+    godot::Ref<AbilityTree> m_tree{};
+    godot::Ref<AbilityState> m_state{};
+
+    /** Widget template; null for the built-in TextureButton. */
+    godot::Ref<godot::PackedScene> m_node_scene{};
+
+    godot::Vector2 m_node_size{64.0f, 64.0f};
+    godot::Vector2 m_spacing{32.0f, 64.0f};
+    godot::Color m_edge_color{0.35f, 0.35f, 0.35f, 1.0f};
+    godot::Color m_unlocked_edge_color{0.95f, 0.8f, 0.35f, 1.0f};
+    float m_edge_width{3.0f};
+
+    // --- Layout ---
+
+    /** Top-left of every node, by id; meaningless where m_laid_out is 0. */
+    std::vector<godot::Vector2> m_positions{};
+
+    /** Whether the node is part of the layout (not on a cycle, not null). */
+    std::vector<uint8_t> m_laid_out{};
+
+    /**
+     * Per layer L, the topmost layer holding a prerequisite of any node at
+     * L or below. Edges that reach a region starting at L leave from there.
+     */
+    std::vector<int32_t> m_edge_floor{};
+
+    /** Graph revision the layout was computed for (-1 = stale). */
+    int64_t m_layout_revision{-1};
+
+    // --- Widgets ---
+
+    /** Widget showing each node id, or nullptr. */
+    std::vector<godot::Control*> m_widget_by_node{};
+
+    /** Ids that currently have a widget. */
+    std::vector<int32_t> m_bound_ids{};
+
+    /** Hidden widgets waiting to be reused. */
+    std::vector<godot::Control*> m_free_widgets{};
+
+    /** Widgets instantiated so far, bound or pooled. */
+    int m_widget_count{0};
+
+    /** Region the widgets were last bound for (the visible region plus a margin), in local coordinates. */
+    godot::Rect2 m_bound_region{};
+
+    /** Set when bound widgets and edges must be rebuilt even if the region still covers the screen. */
+    bool m_dirty{true};
+
+    bool m_refresh_queued{false};
+
+protected:
+    static void _bind_methods();
+
+    void _notification(int p_what);
+
+public:
+    AbilityTreeView();
+
+    void _draw() override;
+
+    /** @brief Sets the tree to display. */
+    void set_ability_tree(const godot::Ref<AbilityTree>& tree);
+    /** @brief Returns the tree to display. */
+    [[nodiscard]] godot::Ref<AbilityTree> get_ability_tree() const;
+
+    /** @brief Sets the progress the widgets and edges reflect. */
+    void set_state(const godot::Ref<AbilityState>& state);
+    /** @brief Returns the progress the widgets and edges reflect. */
+    [[nodiscard]] godot::Ref<AbilityState> get_state() const;
+
+    /** @brief Sets the scene instanced for each visible node; null for the built-in button. */
+    void set_node_scene(const godot::Ref<godot::PackedScene>& scene);
+    /** @brief Returns the scene instanced for each visible node. */
+    [[nodiscard]] godot::Ref<godot::PackedScene> get_node_scene() const;
+
+    /** @brief Sets the size of every node widget. */
+    void set_node_size(const godot::Vector2& size);
+    /** @brief Returns the size of every node widget. */
+    [[nodiscard]] godot::Vector2 get_node_size() const;
+
+    /** @brief Sets the gap between nodes in a row (x) and between rows (y). */
+    void set_spacing(const godot::Vector2& spacing);
+    /** @brief Returns the gap between nodes in a row (x) and between rows (y). */
+    [[nodiscard]] godot::Vector2 get_spacing() const;
+
+    /** @brief Sets the colour of edges into locked nodes. */
+    void set_edge_color(const godot::Color& color);
+    /** @brief Returns the colour of edges into locked nodes. */
+    [[nodiscard]] godot::Color get_edge_color() const;
+
+    /** @brief Sets the colour of edges between two unlocked nodes. */
+    void set_unlocked_edge_color(const godot::Color& color);
+    /** @brief Returns the colour of edges between two unlocked nodes. */
+    [[nodiscard]] godot::Color get_unlocked_edge_color() const;
+
+    /** @brief Sets the edge width in pixels. */
+    void set_edge_width(float width);
+    /** @brief Returns the edge width in pixels. */
+    [[nodiscard]] float get_edge_width() const;
+
+    /**
+     * @brief Rebinds every visible widget and redraws the edges now.
+     *
+     * Happens automatically when the view scrolls, resizes, or the tree or
+     * state changes; call it after changing something the widgets show that
+     * the view cannot observe.
+     */
+    void refresh();
+
+    /** @brief Returns the widget currently showing @p node, or null if it is off screen. */
+    [[nodiscard]] godot::Control* get_widget(const godot::Ref<AbilityNode>& node) const;
+
+    /** @brief Returns the rectangle @p node occupies, in local coordinates (empty if not laid out). */
+    [[nodiscard]] godot::Rect2 get_node_rect(const godot::Ref<AbilityNode>& node);
+
+    /** @brief Returns the number of widgets instantiated so far, bound or pooled. */
+    [[nodiscard]] int get_widget_count() const;
+
+private:
+    /** Recomputes node positions from the graph layers and updates the minimum size. */
+    void update_layout();
+
+    /** Returns the part of the view that can be seen, in local coordinates. */
+    [[nodiscard]] godot::Rect2 get_visible_region() const;
+
+    /** Binds widgets to the nodes in the visible region and releases the others. */
+    void update_widgets();
+
+    /** Takes a widget from the pool or instantiates one. */
+    godot::Control* acquire_widget();
+
+    /** Hides @p widget and returns it to the pool. */
+    void release_widget(godot::Control* widget);
+
+    /** Points @p widget at node @p id and refreshes what it shows. */
+    void bind_widget(godot::Control* widget, int32_t id);
+
+    /** Releases every widget; they are re-bound on the next refresh. */
+    void release_all_widgets();
+
+    /** Schedules one refresh() at the end of the frame. */
+    void queue_refresh();
+
+    /** Marks everything dirty and queues a refresh when the tree or state changes. */
+    void on_source_changed();
+
+    void on_widget_pressed(godot::Control* widget);
+
+    /** Returns the state's unlock state if it belongs to m_tree, else null. */
+    [[nodiscard]] const AbilityUnlockState* get_unlock_state();
+};
+
+} // namespace Rebel::Ability
@@ -0,0 +1,87 @@
+// Copyright (c) 2026, and future.
+// Alejandro Morcillo Montejo - All Rights Reserved
+
+#pragma once
+
+#include "Rebel/Core.hpp"
+#include <godot_cpp/classes/resource.hpp>
+#include <godot_cpp/variant/packed_float32_array.hpp>
+#include <godot_cpp/variant/packed_string_array.hpp>
+#include <godot_cpp/variant/string_name.hpp>
+
+namespace Rebel::Attribute {
+
+/**
+ * @brief Describes one attribute of an AttributeSet and how it is derived.
+ *
+ * The value of an attribute is
+ *
+ *     clamp(base_value + sum(coefficients[i] * value(sources[i])), min_value, max_value)
+ *
+ * so a plain attribute has no sources, and a derived one (e.g. max health
+ * from vitality) lists the attributes it reads and a weight for each.
+ *
+ * Serializable as a .tres file and fully editable in the Godot Inspector.
+ */
+class REBEL_FRAMEWORK AttributeDefinition : public godot::Resource {
+    GDCLASS(AttributeDefinition, godot::Resource);
+
+    /** Unique name the attribute is looked up by. */
+    godot::StringName m_attribute_name{};
+
+    /** Value before any source contributes. */
+    float m_base_value{0.0f};
+
+    /** Names of the attributes this one is derived from. */
+    godot::PackedStringArray m_sources{};
+
+    /** Weight of each source, same length as m_sources (missing entries count as 1). */
+    godot::PackedFloat32Array m_coefficients{};
+
+    /** Lower bound of the final value. */
+    float m_min_value{-1.0e9f};
+
+    /** Upper bound of the final value. */
+    float m_max_value{1.0e9f};
+
+protected:
+    static void _bind_methods();
+
+public:
+    AttributeDefinition() = default;
+
+    /** @brief Sets the attribute name. */
+    void set_attribute_name(const godot::StringName& name);
+    /** @brief Returns the attribute name. */
+    [[nodiscard]] godot::StringName get_attribute_name() const;
+
+    /** @brief Sets the value before sources contribute. */
+    void set_base_value(float value);
+    /** @brief Returns the value before sources contribute. */
+    [[nodiscard]] float get_base_value() const;
+
+    /** @brief Sets the names of the attributes this one derives from. */
+    void set_sources(const godot::PackedStringArray& sources);
+    /** @brief Returns the names of the attributes this one derives from. */
+    [[nodiscard]] godot::PackedStringArray get_sources() const;
+
+    /** @brief Sets the weight of each source. */
+    void set_coefficients(const godot::PackedFloat32Array& coefficients);
+    /** @brief Returns the weight of each source. */
+    [[nodiscard]] godot::PackedFloat32Array get_coefficients() const;
+
+    /** @brief Returns the weight of source @p index (1 if not authored). */
+    [[nodiscard]] float get_coefficient(int index) const;
+
+    /** @brief Sets the lower bound of the final value. */
+    void set_min_value(float value);
+    /** @brief Returns the lower bound of the final value. */
+    [[nodiscard]] float get_min_value() const;
+
+    /** @brief Sets the upper bound of the final value. */
+    void set_max_value(float value);
+    /** @brief Returns the upper bound of the final value. */
+    [[nodiscard]] float get_max_value() const;
+};
+
+} // namespace Rebel::Attribute
@@ -0,0 +1,127 @@
+// Copyright (c) 2026, and future.
+// Alejandro Morcillo Montejo - All Rights Reserved
+
+#pragma once
+
+#include "Rebel/Core.hpp"
+#include "Rebel/Attribute/AttributeDefinition.hpp"
+#include <godot_cpp/classes/resource.hpp>
+#include <godot_cpp/templates/hash_map.hpp>
+#include <godot_cpp/variant/array.hpp>
+#include <godot_cpp/variant/packed_float32_array.hpp>
+#include <godot_cpp/variant/packed_int32_array.hpp>
+#include <godot_cpp/variant/packed_string_array.hpp>
+
+#include <cstdint>
+#include <vector>
+
+namespace Rebel::Attribute {
+
+/**
+ * @brief A character's permanent-progression attributes and their derivations.
+ *
+ * The designer authors a list of AttributeDefinitions; derived attributes
+ * name the attributes they read. On first use (and whenever the list or a
+ * definition changes) the set compiles that graph into flat arrays:
+ *
+ *   - a topologically ordered evaluation list,
+ *   - per attribute, its source indices and coefficients,
+ *   - per attribute, the indices of the attributes that read it (CSR).
+ *
+ * set_base_value() then re-evaluates only the changed attribute and its
+ * downstream dependents, walking the evaluation list once from the changed
+ * attribute's position. Missing sources and cycles are reported when the set
+ * compiles; the offending links are ignored.
+ *
+ * Values are exposed to GDScript as packed arrays in definition order, so the
+ * HUD can read every attribute in one call.
+ */
+class REBEL_FRAMEWORK AttributeSet : public godot::Resource {
+    GDCLASS(AttributeSet, godot::Resource);
+
+    /** Array of Ref<AttributeDefinition>, in the order values are exposed. */
+    godot::Array m_definitions{};
+
+    // --- Compiled graph ---
+    bool m_compiled{false};
+    godot::HashMap<godot::StringName, int32_t> m_index_by_name{};
+    std::vector<int32_t> m_eval_order{};
+    std::vector<int32_t> m_rank{};            ///< Position of each attribute in m_eval_order.
+    int32_t m_cycle_begin{0};                 ///< Rank of the first cycle member in m_eval_order.
+    std::vector<int32_t> m_source_offsets{};  ///< CSR offsets into m_source_ids / m_source_coefficients.
+    std::vector<int32_t> m_source_ids{};
+    std::vector<float> m_source_coefficients{};
+    std::vector<int32_t> m_dependent_offsets{}; ///< CSR offsets into m_dependent_ids.
+    std::vector<int32_t> m_dependent_ids{};
+    std::vector<float> m_min_values{};
+    std::vector<float> m_max_values{};
+
+    // --- Runtime values ---
+    std::vector<float> m_base_values{};
+    std::vector<float> m_authored_base_values{}; ///< Base values as authored, to tell runtime changes apart.
+    godot::PackedFloat32Array m_values{};
+
+    /** Scratch flags used while propagating a change. */
+    std::vector<uint8_t> m_pending{};
+
+protected:
+    static void _bind_methods();
+
+public:
+    AttributeSet() = default;
+
+    /** @brief Sets the attribute definitions (Array of AttributeDefinition). */
+    void set_definitions(const godot::Array& definitions);
+    /** @brief Returns the attribute definitions. */
+    [[nodiscard]] godot::Array get_definitions() const;
+
+    /**
+     * @brief Compiles the dependency graph and evaluates every attribute.
+     *
+     * Called automatically on first access after the definitions changed.
+     * Base values changed at runtime are carried over by attribute name;
+     * the others take their authored value. reset() discards them.
+     */
+    void compile();
+
+    /** @brief Returns the index of @p name in the value arrays, or -1. */
+    [[nodiscard]] int get_attribute_index(const godot::StringName& name);
+
+    /** @brief Returns the final value of @p name (0 if unknown). */
+    [[nodiscard]] float get_value(const godot::StringName& name);
+
+    /** @brief Returns the runtime base value of @p name (0 if unknown). */
+    [[nodiscard]] float get_base_value(const godot::StringName& name);
+
+    /**
+     * @brief Changes the runtime base value of @p name and updates its dependents.
+     *
+     * Only the attribute and the attributes downstream of it are re-evaluated.
+     * Emits `attributes_changed` with the indices whose final value changed.
+     */
+    void set_base_value(const godot::StringName& name, float value);
+
+    /** @brief Adds @p delta to the runtime base value of @p name. */
+    void add_base_value(const godot::StringName& name, float delta);
+
+    /** @brief Returns every final value, in definition order. */
+    [[nodiscard]] godot::PackedFloat32Array get_values();
+
+    /** @brief Returns every attribute name, in definition order. */
+    [[nodiscard]] godot::PackedStringArray get_attribute_names();
+
+    /** @brief Restores the authored base values and re-evaluates everything. */
+    void reset();
+
+private:
+    /** Builds the graph; @p keep_base_values carries runtime base values over by name. */
+    void compile_graph(bool keep_base_values);
+
+    void ensure_compiled();
+    void on_definition_changed();
+
+    /** Evaluates attribute @p index from its base and the current source values. */
+    [[nodiscard]] float evaluate(int32_t index) const;
+};
+
+} // namespace Rebel::Attribute
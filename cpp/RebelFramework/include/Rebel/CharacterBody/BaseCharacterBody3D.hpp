@@ -6,6 +6,11 @@
 #include "Rebel/Core.hpp"
 #include "godot_cpp/classes/character_body3d.hpp"
 
+#include <array>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
 namespace Rebel::CharacterBody {
 
 /**
@@ -15,6 +20,12 @@ namespace Rebel::CharacterBody {
  * easing curves, rotation), gravity system (custom or project-settings),
  * notification routing to virtual _internal_* methods, and property bindings.
  *
+ * Movement and combat values are stats: the exported value is the base, and
+ * modifiers (Deathy modifiers, boons, debuffs) stack additive, multiplicative
+ * and override changes on top of it. Final values are cached per stat and
+ * only re-folded when that stat's base or modifier stack changes, so the
+ * get_*() accessors used every physics frame are a flag test and a load.
+ *
  * Not instantiable from the editor. Concrete subclasses:
  *   - PlatformerCharacterBody3D (adds jump system + fall-speed clamping)
  *   - TopDownCharacterBody3D    (early-out when gravity disabled)
@@ -22,6 +33,27 @@ namespace Rebel::CharacterBody {
 class REBEL_FRAMEWORK BaseCharacterBody3D : public godot::CharacterBody3D {
     GDCLASS(BaseCharacterBody3D, godot::CharacterBody3D);
 
+public:
+    /** Stats that modifiers can target. */
+    enum Stat {
+        STAT_MOVING_SPEED,
+        STAT_ACCELERATION_TIME,
+        STAT_DECELERATION_TIME,
+        STAT_ACCELERATION_CURVE_INTENSITY,
+        STAT_DECELERATION_CURVE_INTENSITY,
+        STAT_ROTATION_SPEED,
+        STAT_ATTACK_CHARGE_TIME,
+        STAT_COUNT,
+    };
+
+    /** How a modifier combines with the base value. */
+    enum ModifierOp {
+        MODIFIER_ADD,      ///< Added to the base value.
+        MODIFIER_MULTIPLY, ///< Multiplies (base + additions).
+        MODIFIER_OVERRIDE, ///< Replaces the result; the most recent override wins.
+    };
+
+private:
     /** Movement Properties **/
 
     /** Movement speed in units per second. */
@@ -62,6 +94,47 @@ class REBEL_FRAMEWORK BaseCharacterBody3D : public godot::CharacterBody3D {
     /** Default gravity strength cached from ProjectSettings **/
     float defaultGravityStrength{9.8f};
 
+    /** Stat modifiers **/
+
+    struct StatModifier {
+        int64_t id{0};
+        ModifierOp op{MODIFIER_ADD};
+        float value{0.0f};
+        /** Modifier clock time at which the modifier expires (infinity = permanent). */
+        double expiresAt{std::numeric_limits<double>::infinity()};
+        godot::StringName source{};
+    };
+
+    /** Modifier stack per stat, in the order the modifiers were added. */
+    std::array<std::vector<StatModifier>, STAT_COUNT> statModifiers{};
+
+    /** Final value per stat, valid when the stat's dirty bit is clear. */
+    mutable std::array<float, STAT_COUNT> finalStats{};
+
+    /** One bit per stat whose final value must be re-folded. */
+    mutable uint32_t dirtyStats{(1u << STAT_COUNT) - 1u};
+
+    /** Counter used to hand out modifier ids. */
+    int64_t nextModifierId{1};
+
+    /** Physics time accumulated while timed modifiers exist. */
+    double modifierClock{0.0};
+
+    /** Earliest expiry among timed modifiers (infinity = none). */
+    double nextModifierExpiry{std::numeric_limits<double>::infinity()};
+
+    /** Returns the base value of a stat. */
+    [[nodiscard]] float get_base_value(Stat stat) const;
+
+    /** Returns the cached final value of a stat, re-folding it if dirty. */
+    [[nodiscard]] float get_final_value(Stat stat) const;
+
+    /** Applies the same limits the setters enforce on the base value. */
+    [[nodiscard]] static float clamp_stat(Stat stat, float value);
+
+    /** Removes expired modifiers; called every physics frame before movement. */
+    void tick_modifiers(double delta);
+
 protected:
     /**
      * @brief Applies gravity to the character's velocity.
@@ -134,6 +207,46 @@ protected:
     static void _bind_methods();
 
 public:
+    /**
+     * @brief Adds a modifier to a stat.
+     *
+     * @param stat     The stat to modify.
+     * @param op       How the value combines with the base.
+     * @param value    Amount added, factor multiplied, or override value.
+     * @param duration Lifetime in seconds (0 = until removed).
+     * @param source   Optional tag so every modifier of one boon/debuff can be removed at once.
+     * @return The modifier id, used by remove_modifier().
+     */
+    int64_t add_modifier(Stat stat, ModifierOp op, float value, float duration = 0.0f, const godot::StringName& source = godot::StringName());
+
+    /**
+     * @brief Removes a modifier.
+     * @param id Id returned by add_modifier().
+     * @return True if the modifier existed.
+     */
+    bool remove_modifier(int64_t id);
+
+    /**
+     * @brief Removes every modifier added with @p source.
+     * @return Number of modifiers removed.
+     */
+    int remove_modifiers_from_source(const godot::StringName& source);
+
+    /** @brief Removes every modifier from every stat. */
+    void clear_modifiers();
+
+    /** @brief Returns the number of active modifiers on @p stat. */
+    [[nodiscard]] int get_modifier_count(Stat stat) const;
+
+    /** @brief Returns the final (modified) value of @p stat. */
+    [[nodiscard]] float get_stat(Stat stat) const;
+
+    /** @brief Returns the unmodified value of @p stat. */
+    [[nodiscard]] float get_base_stat(Stat stat) const;
+
+    /** @brief Sets the unmodified value of @p stat (backs the exported properties). */
+    void set_base_stat(Stat stat, float value);
+
     /**
      * @brief Sets whether to use custom gravity for this character.
      * @param enabled If true, the character uses custom gravity instead of global gravity.
@@ -183,7 +296,7 @@ public:
     [[nodiscard]] float get_attack_charge_time() const;
 
     /**
-     * @brief Gets the movement speed of the character.
+     * @brief Gets the movement speed of the character, modifiers included.
      * @return The movement speed in units per second.
      */
     [[nodiscard]] float get_moving_speed() const;
@@ -295,3 +408,6 @@ public:
 };
 
 } // namespace Rebel::CharacterBody
+
+VARIANT_ENUM_CAST(Rebel::CharacterBody::BaseCharacterBody3D::Stat);
+VARIANT_ENUM_CAST(Rebel::CharacterBody::BaseCharacterBody3D::ModifierOp);
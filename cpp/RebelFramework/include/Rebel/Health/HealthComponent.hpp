@@ -0,0 +1,84 @@
+// Copyright (c) 2026, and future.
+// Alejandro Morcillo Montejo - All Rights Reserved
+
+#pragma once
+
+#include "Rebel/Core.hpp"
+#include <godot_cpp/classes/node.hpp>
+
+namespace Rebel::Health {
+
+/**
+ * @brief Gives its parent health, shield and hit invulnerability.
+ *
+ * The component itself is a thin handle: its values live in HealthServer,
+ * which it registers with on first entering the tree and leaves when it is
+ * freed. Outside the tree the slot is paused, so reparenting keeps its state.
+ * take_damage() and heal() only queue events — the result is visible after
+ * the server's per-frame resolve, and reported through the server's
+ * aggregated `damage_resolved` / `deaths_resolved` signals rather than one
+ * signal per hit.
+ *
+ * The exported values are the configuration used on registration; changing
+ * them at runtime writes through to the server.
+ */
+class REBEL_FRAMEWORK HealthComponent : public godot::Node {
+    GDCLASS(HealthComponent, godot::Node);
+
+    /** Slot handle in HealthServer, or 0 while not registered. */
+    int64_t m_handle{0};
+
+    float m_max_health{100.0f};
+    float m_max_shield{0.0f};
+
+    /** Invulnerability granted after taking damage, in seconds. */
+    float m_hit_invulnerability{0.0f};
+
+protected:
+    static void _bind_methods();
+
+    void _notification(int p_what);
+
+public:
+    HealthComponent() = default;
+
+    /** @brief Queues @p amount damage, optionally tagged with its @p source. */
+    void take_damage(float amount, godot::Object* source = nullptr);
+
+    /** @brief Queues @p amount healing. */
+    void heal(float amount);
+
+    /** @brief Makes the component ignore damage for @p seconds. */
+    void set_invulnerable(float seconds);
+
+    /** @brief Restores full health and shield and brings the component back to life. */
+    void revive();
+
+    /** @brief Returns the current health. */
+    [[nodiscard]] float get_health() const;
+    /** @brief Returns the current shield. */
+    [[nodiscard]] float get_shield() const;
+    /** @brief Returns whether the component has health left. */
+    [[nodiscard]] bool is_alive() const;
+    /** @brief Returns whether the component currently ignores damage. */
+    [[nodiscard]] bool is_invulnerable() const;
+    /** @brief Returns the HealthServer handle (0 while outside the tree). */
+    [[nodiscard]] int64_t get_handle() const;
+
+    /** @brief Sets the maximum health. */
+    void set_max_health(float value);
+    /** @brief Returns the maximum health. */
+    [[nodiscard]] float get_max_health() const;
+
+    /** @brief Sets the maximum shield. */
+    void set_max_shield(float value);
+    /** @brief Returns the maximum shield. */
+    [[nodiscard]] float get_max_shield() const;
+
+    /** @brief Sets the invulnerability granted after each hit, in seconds. */
+    void set_hit_invulnerability(float seconds);
+    /** @brief Returns the invulnerability granted after each hit, in seconds. */
+    [[nodiscard]] float get_hit_invulnerability() const;
+};
+
+} // namespace Rebel::Health
@@ -0,0 +1,152 @@
+// Copyright (c) 2026, and future.
+// Alejandro Morcillo Montejo - All Rights Reserved
+
+#pragma once
+
+#include "Rebel/Core.hpp"
+#include <godot_cpp/classes/object.hpp>
+
+#include <cstdint>
+#include <vector>
+
+namespace godot {
+class SceneTree;
+}
+
+namespace Rebel::Health {
+
+/**
+ * @brief Central storage and batched damage resolution for every HealthComponent.
+ *
+ * Health data lives here in structure-of-arrays form (current/max health,
+ * shield, remaining invulnerability) indexed by slot; HealthComponent nodes
+ * only hold a handle. Damage and healing from any source are appended to an
+ * event queue during the frame and resolved together once per frame, when the
+ * SceneTree emits `process_frame` — so hits landed during physics are applied
+ * before any node runs `_process`.
+ *
+ * Resolution emits at most two signals per frame, no matter how many hits
+ * landed: `damage_resolved` with every damaged component and the total damage
+ * each one took, and `deaths_resolved` with every component that reached zero.
+ * Every applied hit and kill is also fed to the TriggerEngine's `hit` / `kill`
+ * channels with its source, and those procs are resolved right after.
+ *
+ * Handles encode a slot and a generation, so events queued against a
+ * component that was freed in the meantime are dropped instead of hitting
+ * whatever reused the slot.
+ *
+ * Registered as the `HealthServer` engine singleton.
+ */
+class REBEL_FRAMEWORK HealthServer : public godot::Object {
+    GDCLASS(HealthServer, godot::Object);
+
+    static HealthServer* s_singleton;
+
+    struct DamageEvent {
+        int64_t handle{0};
+        float amount{0.0f}; ///< Negative for healing.
+        uint64_t source_id{0};
+    };
+
+    // --- Per-slot storage (SoA) ---
+    std::vector<float> m_health{};
+    std::vector<float> m_max_health{};
+    std::vector<float> m_shield{};
+    std::vector<float> m_max_shield{};
+    std::vector<float> m_invulnerable_time{};
+    std::vector<float> m_hit_invulnerability{};
+    std::vector<uint64_t> m_owner_ids{};
+    std::vector<uint32_t> m_generations{};
+    std::vector<uint8_t> m_alive{};
+    std::vector<uint8_t> m_paused{};
+    std::vector<uint32_t> m_free_slots{};
+
+    /** Hits queued since the last resolve. */
+    std::vector<DamageEvent> m_queue{};
+
+    /** Scratch: damage taken per slot during the current resolve. */
+    std::vector<float> m_batch_damage{};
+    std::vector<uint32_t> m_batch_touched{};
+
+    /** SceneTree whose process_frame drives resolution. */
+    uint64_t m_tree_id{0};
+
+    /** Process frame in which invulnerability timers were last advanced. */
+    uint64_t m_last_tick_frame{0};
+
+protected:
+    static void _bind_methods();
+
+public:
+    HealthServer();
+    ~HealthServer() override;
+
+    /** @brief Returns the engine-wide instance. */
+    static HealthServer* get_singleton();
+
+    /**
+     * @brief Allocates a slot for @p owner and hooks resolution into @p tree.
+     * @return The slot handle.
+     */
+    int64_t create_slot(godot::Object* owner, godot::SceneTree* tree, float max_health, float max_shield, float hit_invulnerability);
+
+    /** @brief Frees a slot; pending events against it are discarded at resolve. */
+    void free_slot(int64_t handle);
+
+    /**
+     * @brief Pauses or resumes a slot, keeping its values.
+     *
+     * A paused slot (its component is outside the tree) ignores damage and
+     * healing, and its invulnerability timer does not run.
+     */
+    void set_slot_paused(int64_t handle, bool paused);
+
+    /** @brief Queues @p amount damage against @p handle. */
+    void queue_damage(int64_t handle, float amount, godot::Object* source = nullptr);
+
+    /** @brief Queues @p amount healing for @p handle. */
+    void queue_heal(int64_t handle, float amount);
+
+    /**
+     * @brief Resolves every queued event now.
+     *
+     * Called automatically once per frame; only call it manually when a
+     * result is needed immediately (e.g. in tests or a cutscene).
+     */
+    void resolve();
+
+    /** @brief Returns the number of events waiting for the next resolve. */
+    [[nodiscard]] int get_pending_events() const;
+
+    /** @brief Returns the number of live slots. */
+    [[nodiscard]] int get_slot_count() const;
+
+    // --- Slot access (used by HealthComponent) ---
+
+    [[nodiscard]] bool is_valid(int64_t handle) const;
+    [[nodiscard]] float get_health(int64_t handle) const;
+    [[nodiscard]] float get_max_health(int64_t handle) const;
+    [[nodiscard]] float get_shield(int64_t handle) const;
+    [[nodiscard]] float get_max_shield(int64_t handle) const;
+    [[nodiscard]] bool is_alive(int64_t handle) const;
+    [[nodiscard]] bool is_invulnerable(int64_t handle) const;
+
+    void set_max_health(int64_t handle, float value);
+    void set_max_shield(int64_t handle, float value);
+    void set_hit_invulnerability(int64_t handle, float seconds);
+    void set_invulnerable(int64_t handle, float seconds);
+
+    /** @brief Restores full health and shield and clears the dead flag. */
+    void revive(int64_t handle);
+
+private:
+    /** Returns the slot for @p handle or -1 if it is stale. */
+    [[nodiscard]] int64_t slot_of(int64_t handle) const;
+
+    void connect_tree(godot::SceneTree* tree);
+
+    /** Advances invulnerability timers by one frame of process time. */
+    void tick_invulnerability();
+};
+
+} // namespace Rebel::Health
@@ -0,0 +1,124 @@
+// Copyright (c) 2026, and future.
+// Alejandro Morcillo Montejo - All Rights Reserved
+
+#pragma once
+
+#include "Rebel/Core.hpp"
+#include <godot_cpp/classes/a_star_grid2d.hpp>
+#include <godot_cpp/classes/grid_map.hpp>
+#include <godot_cpp/classes/navigation_mesh.hpp>
+#include <godot_cpp/classes/navigation_region3d.hpp>
+#include <godot_cpp/classes/node.hpp>
+#include <godot_cpp/templates/hash_map.hpp>
+#include <godot_cpp/variant/packed_vector3_array.hpp>
+
+namespace Rebel::Navigation {
+
+/**
+ * @brief Bakes NavigationMeshes for freshly generated rooms without stalling the frame.
+ *
+ * request_bake() parses the room's source geometry (its GridMap meshes and
+ * static colliders) on the main thread — the only part Godot requires there —
+ * and hands the actual bake to NavigationServer3D's async baker, which runs
+ * on a worker thread. The result is baked into a fresh NavigationMesh and
+ * swapped into the NavigationRegion3D in one assignment once it is done, so
+ * agents never see a half-baked mesh.
+ *
+ * Until the bake lands, find_path() answers from a coarse AStarGrid2D built
+ * from the room's GridMap floor layer (one point per cell), so enemies can
+ * keep chasing the player. Afterwards it queries the navigation map.
+ *
+ * Bake time and polygon count of the last bake are exposed as properties and
+ * as Performance custom monitors under `rebel/navigation_<instance id>/`,
+ * one category per service so several can run side by side.
+ */
+class REBEL_FRAMEWORK NavigationBakeService : public godot::Node {
+    GDCLASS(NavigationBakeService, godot::Node);
+
+    /** Per-region bookkeeping, keyed by the region's instance id. */
+    struct RegionJob {
+        godot::Ref<godot::NavigationMesh> pending_mesh{};
+        godot::Ref<godot::AStarGrid2D> fallback{};
+        uint64_t grid_map_id{0};
+        int floor_layer{0};
+        uint64_t start_usec{0};
+        uint32_t generation{0};
+        bool baking{false};
+        bool baked{false};
+    };
+
+    godot::HashMap<uint64_t, RegionJob> m_jobs{};
+
+    /** Duration of the most recent bake, from request to swap, in milliseconds. */
+    double m_last_bake_time_msec{0.0};
+
+    /** Polygon count of the most recently swapped-in NavigationMesh. */
+    int m_last_polygon_count{0};
+
+protected:
+    static void _bind_methods();
+
+    void _notification(int p_what);
+
+public:
+    NavigationBakeService() = default;
+
+    /**
+     * @brief Starts a background bake for @p region.
+     *
+     * The region's current NavigationMesh (if any) is used as the parameter
+     * template and stays active until the new one is swapped in. A request
+     * for a region that is already baking supersedes the in-flight bake.
+     *
+     * @param region      Region that will receive the baked mesh.
+     * @param source_root Root of the geometry to parse; defaults to @p region.
+     * @return True if the bake was started.
+     */
+    bool request_bake(godot::NavigationRegion3D* region, godot::Node* source_root = nullptr);
+
+    /** @brief Returns true if @p region has a bake in flight. */
+    [[nodiscard]] bool is_baking(godot::NavigationRegion3D* region) const;
+
+    /** @brief Returns true once a requested bake for @p region has been swapped in. */
+    [[nodiscard]] bool is_baked(godot::NavigationRegion3D* region) const;
+
+    /**
+     * @brief Returns a path between two world positions inside @p region.
+     *
+     * Uses the navigation map once the bake has landed, and the coarse grid
+     * fallback before that. Returns an empty array if neither is available.
+     */
+    [[nodiscard]] godot::PackedVector3Array find_path(godot::NavigationRegion3D* region,
+                                                      const godot::Vector3& from,
+                                                      const godot::Vector3& to) const;
+
+    /** @brief Forgets every tracked region (does not cancel server-side bakes). */
+    void clear();
+
+    /** @brief Returns the duration of the last completed bake in milliseconds. */
+    [[nodiscard]] double get_last_bake_time_msec() const;
+
+    /** @brief Returns the polygon count of the last swapped-in mesh. */
+    [[nodiscard]] int get_last_polygon_count() const;
+
+    /** @brief Returns the number of bakes currently in flight. */
+    [[nodiscard]] int get_active_bakes() const;
+
+private:
+    /** NavigationServer3D callback; hops to the main thread before touching the scene. */
+    void on_bake_finished(uint64_t region_id, uint32_t generation);
+
+    /** Swaps the baked mesh into its region and records metrics. */
+    void apply_bake(uint64_t region_id, uint32_t generation);
+
+    /** Builds the coarse walkability grid from @p grid_map's lowest layer. */
+    static godot::Ref<godot::AStarGrid2D> build_fallback_grid(godot::GridMap* grid_map, int& floor_layer);
+
+    /** Returns the Performance monitor id of @p metric for this service. */
+    [[nodiscard]] godot::String get_monitor_id(const char* metric) const;
+
+    void register_monitors();
+    void unregister_monitors();
+};
+
+} // namespace Rebel::Navigation
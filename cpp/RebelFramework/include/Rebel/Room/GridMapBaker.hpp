@@ -0,0 +1,85 @@
+// Copyright (c) 2026, and future.
+// Alejandro Morcillo Montejo - All Rights Reserved
+
+#pragma once
+
+#include "Rebel/Core.hpp"
+#include <godot_cpp/classes/grid_map.hpp>
+#include <godot_cpp/classes/node3d.hpp>
+#include <godot_cpp/classes/ref_counted.hpp>
+
+namespace Rebel::Room {
+
+/**
+ * @brief Collapses a generated GridMap into a few large colliders and batched meshes.
+ *
+ * A GridMap built from a meshlib registers one collision shape and one render
+ * instance per cell, so both the physics broadphase and the draw-call count
+ * grow with room size. bake() produces an equivalent static subtree:
+ *
+ *   - **Collision** — cells whose meshlib shape is a single box covering the
+ *     whole cell footprint are grouped by layer and box height, then
+ *     greedy-meshed into maximal rectangles. Full-height boxes (walls) whose
+ *     rectangles line up on consecutive layers are merged vertically as well.
+ *     Every other cell keeps its original shapes. All shapes end up on a
+ *     single StaticBody3D that copies the GridMap's collision layers.
+ *   - **Rendering** — every meshlib item gets one MultiMeshInstance3D holding
+ *     one instance per cell, so identical meshes (and their materials) draw
+ *     in a single batch.
+ *
+ * With replace_source enabled the baked subtree is added as a sibling of the
+ * GridMap, and the GridMap is hidden and removed from every collision layer.
+ * The GridMap data itself is left untouched so navigation parsing and
+ * gameplay queries keep working.
+ *
+ * Intended to run once, right after room generation.
+ */
+class REBEL_FRAMEWORK GridMapBaker : public godot::RefCounted {
+    GDCLASS(GridMapBaker, godot::RefCounted);
+
+    /** Whether bake() swaps the baked subtree in for the GridMap. */
+    bool m_replace_source{true};
+
+    /** Whether full-height boxes on consecutive layers are merged into one. */
+    bool m_merge_vertically{true};
+
+    // --- Statistics of the last bake ---
+    int m_last_cell_count{0};
+    int m_last_shape_count{0};
+    int m_last_multimesh_count{0};
+
+protected:
+    static void _bind_methods();
+
+public:
+    GridMapBaker() = default;
+
+    /**
+     * @brief Bakes @p grid_map into merged collision and batched meshes.
+     *
+     * @param grid_map A GridMap with a MeshLibrary assigned.
+     * @return The root of the baked subtree (a Node3D positioned like the
+     *         GridMap), or nullptr if the GridMap is empty. When
+     *         replace_source is false the caller owns the returned node.
+     */
+    godot::Node3D* bake(godot::GridMap* grid_map);
+
+    /** @brief Sets whether bake() swaps the result in for the GridMap. */
+    void set_replace_source(bool enabled);
+    /** @brief Returns whether bake() swaps the result in for the GridMap. */
+    [[nodiscard]] bool get_replace_source() const;
+
+    /** @brief Sets whether full-height boxes are merged across layers. */
+    void set_merge_vertically(bool enabled);
+    /** @brief Returns whether full-height boxes are merged across layers. */
+    [[nodiscard]] bool get_merge_vertically() const;
+
+    /** @brief Returns the number of GridMap cells processed by the last bake. */
+    [[nodiscard]] int get_last_cell_count() const;
+    /** @brief Returns the number of collision shapes produced by the last bake. */
+    [[nodiscard]] int get_last_shape_count() const;
+    /** @brief Returns the number of MultiMeshInstance3D nodes produced by the last bake. */
+    [[nodiscard]] int get_last_multimesh_count() const;
+};
+
+} // namespace Rebel::Room
@@ -0,0 +1,184 @@
+// Copyright (c) 2026, and future.
+// Alejandro Morcillo Montejo - All Rights Reserved
+
+#pragma once
+
+#include "Rebel/Core.hpp"
+#include <godot_cpp/classes/ref_counted.hpp>
+#include <godot_cpp/variant/array.hpp>
+#include <godot_cpp/variant/packed_byte_array.hpp>
+#include <godot_cpp/variant/packed_int32_array.hpp>
+#include <godot_cpp/variant/packed_vector3_array.hpp>
+
+#include <cstdint>
+#include <span>
+
+namespace Rebel::Room {
+
+/**
+ * @brief The output of the room generator in a compact, position-independent form.
+ *
+ * A RoomLayout holds everything needed to rebuild a room without re-running
+ * generation: GridMap cells, spawn points, prop placements and navigation
+ * triangles. It lives in one of two modes:
+ *
+ *   - **Staged** — the generator fills it through the set_* methods.
+ *   - **Packed** — the data is a single byte blob (header, section table and
+ *     POD records) and the section pointers are fixed up to point into it.
+ *
+ * pack() turns a staged layout into a packed one; from_bytes() wraps a blob
+ * read from disk and only has to validate the header and fix up the section
+ * pointers — no per-record parsing. Native consumers read records through the
+ * *_view() spans without copying; GDScript getters return packed arrays.
+ *
+ * The blob layout is little-endian and versioned by FORMAT_VERSION. The
+ * generator version and seed are part of the header so RoomLayoutCache can
+ * reject stale entries.
+ */
+class REBEL_FRAMEWORK RoomLayout : public godot::RefCounted {
+    GDCLASS(RoomLayout, godot::RefCounted);
+
+public:
+    /** Bumped whenever the blob layout below changes. */
+    static constexpr uint32_t FORMAT_VERSION = 1;
+
+    /** One occupied GridMap cell. */
+    struct CellRecord {
+        int32_t x;
+        int32_t y;
+        int32_t z;
+        int16_t item;
+        uint8_t orientation;
+        uint8_t flags;
+    };
+    static_assert(sizeof(CellRecord) == 16);
+
+    /** One placed prop: an id into the room's prop table plus a transform. */
+    struct PropRecord {
+        int32_t id;
+        float basis[9];
+        float origin[3];
+    };
+    static_assert(sizeof(PropRecord) == 52);
+
+    /** A 3-component float vector, independent of the engine's real_t. */
+    struct Vec3Record {
+        float x;
+        float y;
+        float z;
+    };
+    static_assert(sizeof(Vec3Record) == 12);
+
+private:
+    uint64_t m_seed{0};
+    uint32_t m_generator_version{0};
+
+    // --- Staged data (generator side) ---
+    godot::PackedInt32Array m_staged_cells{};
+    godot::PackedVector3Array m_staged_spawn_points{};
+    godot::PackedInt32Array m_staged_prop_ids{};
+    godot::Array m_staged_prop_transforms{};
+    godot::PackedVector3Array m_staged_nav_vertices{};
+    godot::PackedInt32Array m_staged_nav_indices{};
+
+    // --- Packed data (cache side) ---
+
+    /** Owns the serialized bytes; every view below points into it. */
+    godot::PackedByteArray m_blob{};
+
+    std::span<const CellRecord> m_cells{};
+    std::span<const Vec3Record> m_spawn_points{};
+    std::span<const PropRecord> m_props{};
+    std::span<const Vec3Record> m_nav_vertices{};
+    std::span<const int32_t> m_nav_indices{};
+
+protected:
+    static void _bind_methods();
+
+public:
+    RoomLayout() = default;
+
+    /**
+     * @brief Wraps a serialized blob, validating it and fixing up section pointers.
+     *
+     * @param bytes Blob previously produced by pack() / get_bytes().
+     * @return The packed layout, or null if the blob is truncated, has the
+     *         wrong magic or an unsupported FORMAT_VERSION.
+     */
+    static godot::Ref<RoomLayout> from_bytes(const godot::PackedByteArray& bytes);
+
+    /** @brief Sets the seed the layout was generated from. */
+    void set_seed(int64_t seed);
+    /** @brief Returns the seed the layout was generated from. */
+    [[nodiscard]] int64_t get_seed() const;
+
+    /** @brief Sets the version of the generator that produced the layout. */
+    void set_generator_version(int version);
+    /** @brief Returns the version of the generator that produced the layout. */
+    [[nodiscard]] int get_generator_version() const;
+
+    /**
+     * @brief Sets the occupied GridMap cells.
+     * @param cells Flat array with 5 ints per cell: x, y, z, item, orientation.
+     */
+    void set_cells(const godot::PackedInt32Array& cells);
+    /** @brief Returns the cells as a flat array (5 ints per cell). */
+    [[nodiscard]] godot::PackedInt32Array get_cells() const;
+
+    /** @brief Sets the enemy/player spawn points. */
+    void set_spawn_points(const godot::PackedVector3Array& points);
+    /** @brief Returns the spawn points. */
+    [[nodiscard]] godot::PackedVector3Array get_spawn_points() const;
+
+    /**
+     * @brief Sets the placed props.
+     * @param ids        Prop id per placement.
+     * @param transforms Array of Transform3D, same length as @p ids.
+     */
+    void set_props(const godot::PackedInt32Array& ids, const godot::Array& transforms);
+    /** @brief Returns the prop id of every placement. */
+    [[nodiscard]] godot::PackedInt32Array get_prop_ids() const;
+    /** @brief Returns the Transform3D of every placement. */
+    [[nodiscard]] godot::Array get_prop_transforms() const;
+
+    /**
+     * @brief Sets the navigation triangles.
+     * @param vertices Vertex positions.
+     * @param indices  Three indices per triangle into @p vertices.
+     */
+    void set_navigation(const godot::PackedVector3Array& vertices, const godot::PackedInt32Array& indices);
+    /** @brief Returns the navigation vertices. */
+    [[nodiscard]] godot::PackedVector3Array get_nav_vertices() const;
+    /** @brief Returns the navigation triangle indices. */
+    [[nodiscard]] godot::PackedInt32Array get_nav_indices() const;
+
+    /**
+     * @brief Serializes the staged data into the blob and releases the staging arrays.
+     *
+     * Does nothing if the layout is already packed.
+     */
+    void pack();
+
+    /** @brief Returns true if the layout is backed by a blob. */
+    [[nodiscard]] bool is_packed() const;
+
+    /** @brief Returns the serialized blob, packing first if needed. */
+    [[nodiscard]] godot::PackedByteArray get_bytes();
+
+    // --- Zero-copy native access (valid only while packed) ---
+
+    [[nodiscard]] std::span<const CellRecord> cells_view() const { return m_cells; }
+    [[nodiscard]] std::span<const Vec3Record> spawn_points_view() const { return m_spawn_points; }
+    [[nodiscard]] std::span<const PropRecord> props_view() const { return m_props; }
+    [[nodiscard]] std::span<const Vec3Record> nav_vertices_view() const { return m_nav_vertices; }
+    [[nodiscard]] std::span<const int32_t> nav_indices_view() const { return m_nav_indices; }
+
+private:
+    /** Points every view at its section inside m_blob. Returns false on a malformed blob. */
+    bool fix_up();
+
+    /** Drops the blob and its views (called by setters). */
+    void unpack();
+};
+
+} // namespace Rebel::Room
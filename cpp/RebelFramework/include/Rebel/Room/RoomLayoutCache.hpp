@@ -0,0 +1,71 @@
+// Copyright (c) 2026, and future.
+// Alejandro Morcillo Montejo - All Rights Reserved
+
+#pragma once
+
+#include "Rebel/Core.hpp"
+#include "Rebel/Room/RoomLayout.hpp"
+#include <godot_cpp/classes/ref_counted.hpp>
+#include <godot_cpp/variant/string.hpp>
+
+namespace Rebel::Room {
+
+/**
+ * @brief On-disk cache of generated RoomLayouts keyed by seed and generator version.
+ *
+ * Each layout is stored as its packed RoomLayout blob in its own file under
+ * cache_dir (default `user://room_cache`). Loading is a single whole-file read
+ * followed by RoomLayout::from_bytes(), which only validates the header and
+ * fixes up the section pointers — the records themselves are never parsed.
+ *
+ * Bumping the generator version naturally misses every old entry, since the
+ * version is part of both the file name and the blob header.
+ *
+ * Typical usage from the room generator:
+ * @code
+ * var layout := cache.load_layout(seed, GENERATOR_VERSION)
+ * if layout == null:
+ *     layout = generate(seed)
+ *     cache.store_layout(layout)
+ * @endcode
+ */
+class REBEL_FRAMEWORK RoomLayoutCache : public godot::RefCounted {
+    GDCLASS(RoomLayoutCache, godot::RefCounted);
+
+    /** Directory holding the cached blobs. */
+    godot::String m_cache_dir{"user://room_cache"};
+
+protected:
+    static void _bind_methods();
+
+public:
+    RoomLayoutCache() = default;
+
+    /** @brief Sets the directory holding the cached blobs. */
+    void set_cache_dir(const godot::String& path);
+    /** @brief Returns the directory holding the cached blobs. */
+    [[nodiscard]] godot::String get_cache_dir() const;
+
+    /**
+     * @brief Packs @p layout if needed and writes it under its seed and generator version.
+     * @return OK, or the FileAccess / DirAccess error.
+     */
+    godot::Error store_layout(const godot::Ref<RoomLayout>& layout);
+
+    /**
+     * @brief Loads the cached layout for @p seed / @p generator_version.
+     * @return The packed layout, or null on a miss or a corrupt/stale file.
+     */
+    [[nodiscard]] godot::Ref<RoomLayout> load_layout(int64_t seed, int generator_version) const;
+
+    /** @brief Returns true if a cache file exists for the key. */
+    [[nodiscard]] bool has_layout(int64_t seed, int generator_version) const;
+
+    /** @brief Deletes the cache file for the key, if any. */
+    godot::Error erase_layout(int64_t seed, int generator_version);
+
+private:
+    [[nodiscard]] godot::String get_layout_path(int64_t seed, int generator_version) const;
+};
+
+} // namespace Rebel::Room
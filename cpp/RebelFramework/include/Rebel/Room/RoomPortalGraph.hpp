@@ -0,0 +1,141 @@
+// Copyright (c) 2026, and future.
+// Alejandro Morcillo Montejo - All Rights Reserved
+
+#pragma once
+
+#include "Rebel/Core.hpp"
+#include <godot_cpp/classes/node.hpp>
+#include <godot_cpp/classes/node3d.hpp>
+#include <godot_cpp/variant/aabb.hpp>
+#include <godot_cpp/variant/packed_int32_array.hpp>
+
+#include <cstdint>
+#include <vector>
+
+namespace Rebel::Room {
+
+/**
+ * @brief Room/portal graph that only keeps the rooms the player can see alive.
+ *
+ * Rooms are registered with their root node and their world-space bounds
+ * (the boundaries the room generator already knows); doors are registered as
+ * portals between two rooms. Every frame the graph locates the tracked target
+ * and walks open portals outward from its room, up to max_portal_depth hops.
+ * Rooms reached that way are visible and processing; every other room root is
+ * hidden and switched to PROCESS_MODE_DISABLED, which suspends all characters
+ * and ability nodes inside it.
+ *
+ * Re-evaluation is cheap enough to run every frame: while the target stays in
+ * the same room and no portal changed state, the update is a single AABB
+ * test. Node visibility and process modes are only touched for rooms whose
+ * state actually flipped.
+ */
+class REBEL_FRAMEWORK RoomPortalGraph : public godot::Node {
+    GDCLASS(RoomPortalGraph, godot::Node);
+
+    struct RoomEntry {
+        uint64_t node_id{0};
+        godot::AABB bounds{};
+        std::vector<int32_t> portals{};
+        bool active{true};
+        bool alive{true};
+    };
+
+    struct PortalEntry {
+        int32_t room_a{-1};
+        int32_t room_b{-1};
+        bool open{true};
+    };
+
+    std::vector<RoomEntry> m_rooms{};
+    std::vector<PortalEntry> m_portals{};
+
+    /** Instance id of the node whose position decides the current room (usually the player); 0 for none. */
+    uint64_t m_target_id{0};
+
+    /** Room the target was in during the last update, or -1. */
+    int32_t m_current_room{-1};
+
+    /** Number of open-portal hops from the current room that stay active. */
+    int m_max_portal_depth{1};
+
+    /** Set whenever the graph or a portal changes, forcing a re-walk. */
+    bool m_dirty{true};
+
+    /** Scratch buffers reused by every re-walk to avoid per-frame allocations. */
+    std::vector<int32_t> m_frontier{};
+    std::vector<int32_t> m_depth{};
+
+protected:
+    static void _bind_methods();
+
+    void _notification(int p_what);
+
+public:
+    RoomPortalGraph() = default;
+
+    /**
+     * @brief Registers a room.
+     * @param room_root Root node of the room's subtree.
+     * @param bounds    World-space bounds of the room.
+     * @return The room id used by add_portal().
+     */
+    int add_room(godot::Node3D* room_root, const godot::AABB& bounds);
+
+    /**
+     * @brief Unregisters a room and closes every portal leading to it.
+     *
+     * The room's node is left as it is; ids of other rooms stay valid.
+     */
+    void remove_room(int room_id);
+
+    /**
+     * @brief Connects two rooms through a door.
+     * @return The portal id used by set_portal_open().
+     */
+    int add_portal(int room_a, int room_b, bool open = true);
+
+    /** @brief Opens or closes a portal (e.g. when its door opens or closes). */
+    void set_portal_open(int portal_id, bool open);
+
+    /** @brief Returns whether a portal is open. */
+    [[nodiscard]] bool is_portal_open(int portal_id) const;
+
+    /** @brief Removes every room and portal and re-activates all tracked rooms. */
+    void clear();
+
+    /**
+     * @brief Re-evaluates which rooms are active.
+     *
+     * Called automatically every frame; call it manually after teleporting
+     * the target to apply the new state immediately.
+     */
+    void update_rooms();
+
+    /** @brief Returns the room the target is currently in, or -1. */
+    [[nodiscard]] int get_current_room() const;
+
+    /** @brief Returns the ids of every currently active room. */
+    [[nodiscard]] godot::PackedInt32Array get_active_rooms() const;
+
+    /** @brief Sets the node whose position decides the current room. */
+    void set_target(godot::Node3D* target);
+    /** @brief Returns the node whose position decides the current room. */
+    [[nodiscard]] godot::Node3D* get_target() const;
+
+    /** @brief Sets how many open-portal hops stay active (>= 0). */
+    void set_max_portal_depth(int depth);
+    /** @brief Returns how many open-portal hops stay active. */
+    [[nodiscard]] int get_max_portal_depth() const;
+
+private:
+    /** Returns the room containing @p position, checking @p hint first. */
+    [[nodiscard]] int32_t locate(const godot::Vector3& position, int32_t hint) const;
+
+    /** Shows/enables or hides/disables a room's subtree. */
+    static void apply_room_state(RoomEntry& room, bool active);
+
+    [[nodiscard]] bool is_valid_room(int room_id) const;
+};
+
+} // namespace Rebel::Room
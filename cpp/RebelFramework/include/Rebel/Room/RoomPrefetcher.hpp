@@ -0,0 +1,176 @@
+// Copyright (c) 2026, and future.
+// Alejandro Morcillo Montejo - All Rights Reserved
+
+#pragma once
+
+#include "Rebel/Core.hpp"
+#include <godot_cpp/classes/node.hpp>
+#include <godot_cpp/classes/packed_scene.hpp>
+#include <godot_cpp/templates/hash_map.hpp>
+#include <godot_cpp/variant/packed_string_array.hpp>
+#include <godot_cpp/variant/string.hpp>
+
+#include <mutex>
+
+namespace Rebel::Room {
+
+/**
+ * @brief Warms up the scenes of the upcoming room choices before the player picks one.
+ *
+ * At a decision point the three candidate rooms are known. Calling prefetch()
+ * with their scene paths starts threaded ResourceLoader requests (including
+ * sub-resources), and once a PackedScene has finished loading it is
+ * instantiated off-tree on a WorkerThreadPool task. The resulting subtrees are
+ * kept warm until take() hands one over to the door transition, which then
+ * only has to add_child() an already-built room.
+ *
+ * Warm instances are bounded by max_warm_rooms and, optionally, by a static
+ * memory budget. When the budget is exceeded the oldest prefetched instances
+ * are freed — their PackedScene stays cached so take() still avoids the disk
+ * load and only pays for instantiation. Nothing new is instantiated until
+ * usage drops below 90% of the budget.
+ *
+ * Typical usage:
+ * @code
+ * prefetcher.prefetch(PackedStringArray([room_a, room_b, room_c]))
+ * # ... player walks through a door ...
+ * var room := prefetcher.take(room_b)
+ * level_root.add_child(room)
+ * prefetcher.clear()
+ * @endcode
+ */
+class REBEL_FRAMEWORK RoomPrefetcher : public godot::Node {
+    GDCLASS(RoomPrefetcher, godot::Node);
+
+    /** Lifecycle of one prefetched room. */
+    enum class EntryState : uint8_t {
+        Loading,       ///< Threaded ResourceLoader request in flight.
+        Loaded,        ///< PackedScene ready, waiting for an instantiation slot.
+        Instantiating, ///< Worker task building the subtree.
+        Ready,         ///< Subtree built and waiting for take().
+        Failed,        ///< Load failed — take() falls back to a synchronous load.
+    };
+
+    struct Entry {
+        godot::Ref<godot::PackedScene> scene{};
+        godot::Node* instance{nullptr};
+        int64_t task_id{-1};
+        uint64_t request_order{0};
+        EntryState state{EntryState::Loading};
+    };
+
+    /** Prefetched rooms keyed by scene path. */
+    godot::HashMap<godot::String, Entry> m_entries{};
+
+    /**
+     * @brief Subtrees produced by worker tasks, keyed by scene path.
+     *
+     * Written from the worker thread and drained on the main thread once the
+     * task reports completion; guarded by m_results_mutex.
+     */
+    godot::HashMap<godot::String, godot::Node*> m_results{};
+    std::mutex m_results_mutex{};
+
+    /** Monotonic counter used to evict the oldest warm instance first. */
+    uint64_t m_request_counter{0};
+
+    /** Maximum number of instantiated rooms kept alive at once. */
+    int m_max_warm_rooms{3};
+
+    /** Static memory ceiling in MiB above which no new instance is built (0 = unlimited). */
+    int m_memory_budget_mb{0};
+
+    /** Set once usage exceeds the budget; cleared when it drops below 90% of it. */
+    bool m_over_budget{false};
+
+    /** Whether instantiation runs on a WorkerThreadPool task or on the main thread. */
+    bool m_instantiate_on_worker{true};
+
+protected:
+    static void _bind_methods();
+
+    void _notification(int p_what);
+
+public:
+    RoomPrefetcher() = default;
+    ~RoomPrefetcher() override;
+
+    /**
+     * @brief Starts loading and instantiating the given room scenes in the background.
+     *
+     * Paths that are already prefetched are left untouched, so calling this
+     * again with an overlapping set is cheap.
+     *
+     * @param scene_paths Resource paths of the candidate room scenes.
+     */
+    void prefetch(const godot::PackedStringArray& scene_paths);
+
+    /**
+     * @brief Hands over the prefetched subtree for @p scene_path.
+     *
+     * Returns the warm instance if it is ready. If the room is still loading
+     * or instantiating, this blocks until it finishes; if it was never
+     * prefetched or the threaded load failed, it loads synchronously. The
+     * caller owns the returned node and is expected to add it to the tree.
+     *
+     * @param scene_path Resource path passed earlier to prefetch().
+     * @return The room root node, or nullptr if the scene cannot be loaded.
+     */
+    godot::Node* take(const godot::String& scene_path);
+
+    /**
+     * @brief Returns true when take() would return immediately for @p scene_path.
+     */
+    [[nodiscard]] bool is_ready(const godot::String& scene_path) const;
+
+    /**
+     * @brief Frees every prefetched room that was not taken.
+     *
+     * Call after the door transition so the unchosen rooms release their memory.
+     */
+    void clear();
+
+    /** @brief Sets the maximum number of instantiated rooms kept warm (>= 1). */
+    void set_max_warm_rooms(int count);
+    /** @brief Returns the maximum number of instantiated rooms kept warm. */
+    [[nodiscard]] int get_max_warm_rooms() const;
+
+    /** @brief Sets the static memory budget in MiB (0 = unlimited). */
+    void set_memory_budget_mb(int megabytes);
+    /** @brief Returns the static memory budget in MiB. */
+    [[nodiscard]] int get_memory_budget_mb() const;
+
+    /** @brief Sets whether instantiation happens on a worker thread. */
+    void set_instantiate_on_worker(bool enabled);
+    /** @brief Returns whether instantiation happens on a worker thread. */
+    [[nodiscard]] bool get_instantiate_on_worker() const;
+
+private:
+    /** Advances every in-flight entry; called from NOTIFICATION_PROCESS. */
+    void poll();
+
+    /**
+     * Starts instantiating entries in Loaded state while budget allows.
+     * Paths instantiated synchronously are appended to @p r_finished for the caller to signal.
+     */
+    void schedule_instantiations(godot::PackedStringArray& r_finished);
+
+    /** Worker-thread body: instantiates @p scene and publishes the result. */
+    void instantiate_task(const godot::String& scene_path, const godot::Ref<godot::PackedScene>& scene);
+
+    /** Blocks on a running worker task and moves its result into the entry. */
+    void finish_task(const godot::String& scene_path, Entry& entry);
+
+    /** Frees the oldest Ready instances until the warm count and memory fit; true if any was freed. */
+    bool enforce_budget();
+
+    [[nodiscard]] int count_warm() const;
+
+    /** Updates and returns the over-budget latch (see m_over_budget). */
+    [[nodiscard]] bool is_over_memory_budget();
+
+    /** Frees the entry's instance and waits on any running task. */
+    void release_entry(const godot::String& scene_path, Entry& entry);
+};
+
+} // namespace Rebel::Room
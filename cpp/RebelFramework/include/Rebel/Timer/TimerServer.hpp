@@ -0,0 +1,247 @@
+// Copyright (c) 2026, and future.
+// Alejandro Morcillo Montejo - All Rights Reserved
+
+#pragma once
+
+#include "Rebel/Core.hpp"
+#include <godot_cpp/classes/object.hpp>
+#include <godot_cpp/variant/array.hpp>
+#include <godot_cpp/variant/callable.hpp>
+#include <godot_cpp/variant/packed_int32_array.hpp>
+#include <godot_cpp/variant/packed_int64_array.hpp>
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+namespace godot {
+class SceneTree;
+}
+
+namespace Rebel::Timer {
+
+/**
+ * @brief Engine-wide timer service backed by a hierarchical timing wheel.
+ *
+ * Cooldowns, buff durations, damage-over-time ticks and hazard pulses are all
+ * "call me back in N seconds" — instead of a Timer node or a `_process`
+ * countdown each, they are records in one pool scheduled on a four-level
+ * wheel of 256 buckets per level. Scheduling and cancelling are O(1) (link or
+ * unlink one record); advancing one tick touches a single bucket, plus one
+ * cascade from the level above every 256 ticks. Ten thousand idle timers cost
+ * nothing per frame — only the ones that expire are visited.
+ *
+ * Time is quantized to ticks of 1 / tick_rate seconds; a timer fires on the
+ * first tick boundary at or after its delay. The wheel advances once per
+ * frame from the SceneTree's `process_frame` with the root's process delta
+ * and stands still while the tree is paused.
+ *
+ * A timer fires in one of three ways:
+ *   - **Native** — a plain function pointer with a context and payload, for
+ *     C++ callers (no Variant or Callable overhead).
+ *   - **Callable** — schedule() from GDScript; the Callable is invoked
+ *     without arguments.
+ *   - **Event** — schedule_event(); every event timer that fired during the
+ *     frame is reported in a single `timers_fired` signal, so a hundred DoT
+ *     ticks cost one emission.
+ *
+ * Handles encode a record and a generation like HealthServer's, so a stale
+ * handle never cancels whatever reused the record.
+ *
+ * Registered as the `TimerServer` engine singleton.
+ */
+class REBEL_FRAMEWORK TimerServer : public godot::Object {
+    GDCLASS(TimerServer, godot::Object);
+
+public:
+    /** Native callback: @p context and @p payload are whatever was passed to schedule_native(). */
+    using NativeCallback = void (*)(void* context, int64_t handle, uint64_t payload);
+
+    static constexpr int WHEEL_BITS = 8;
+    static constexpr uint32_t WHEEL_SIZE = 1u << WHEEL_BITS;
+    static constexpr int WHEEL_LEVELS = 4;
+
+    /** Longest delay the wheel can represent, in ticks; longer delays are clamped. */
+    static constexpr uint64_t MAX_DELAY_TICKS = (uint64_t{1} << (WHEEL_BITS * WHEEL_LEVELS)) - 1;
+
+private:
+    static TimerServer* s_singleton;
+
+    static constexpr uint32_t NIL = UINT32_MAX;
+    static constexpr uint16_t NO_BUCKET = UINT16_MAX;
+
+    enum class Kind : uint8_t {
+        Free,
+        Native,
+        Callable,
+        Event,
+    };
+
+    /** One scheduled timer; linked into exactly one bucket while pending. */
+    struct TimerRecord {
+        uint64_t expiry{0};          ///< Tick at which the timer fires.
+        uint64_t period{0};          ///< Repeat interval in ticks (0 = one-shot).
+        uint64_t payload{0};         ///< Native payload or event tag.
+        void* context{nullptr};
+        NativeCallback callback{nullptr};
+        uint64_t owner_id{0};
+        uint32_t next{NIL};
+        uint32_t prev{NIL};
+        uint32_t generation{1};
+        uint16_t bucket{NO_BUCKET};  ///< level * WHEEL_SIZE + slot, NO_BUCKET while firing.
+        Kind kind{Kind::Free};
+    };
+
+    std::vector<TimerRecord> m_timers{};
+
+    /** Script callbacks, parallel to m_timers (only set for Kind::Callable). */
+    std::vector<godot::Callable> m_callables{};
+
+    std::vector<uint32_t> m_free_timers{};
+
+    /** Head record of every bucket, all levels back to back. */
+    std::array<uint32_t, WHEEL_SIZE * WHEEL_LEVELS> m_buckets{};
+
+    /** Number of ticks elapsed since the server was created. */
+    uint64_t m_tick{0};
+
+    int m_tick_rate{60};
+    double m_tick_length{1.0 / 60.0};
+
+    /** Seconds carried over to the next tick boundary. */
+    double m_accumulator{0.0};
+
+    int m_active_count{0};
+
+    /** Scratch: (record, generation) of the timers expiring this tick. */
+    std::vector<std::pair<uint32_t, uint32_t>> m_firing{};
+
+    // --- Event batch for the current frame ---
+    godot::PackedInt64Array m_event_handles{};
+    godot::PackedInt32Array m_event_tags{};
+    godot::Array m_event_owners{};
+
+    /** SceneTree whose process_frame drives the wheel. */
+    uint64_t m_tree_id{0};
+
+    /** Process frame in which the wheel was last advanced. */
+    uint64_t m_last_frame{0};
+
+protected:
+    static void _bind_methods();
+
+public:
+    TimerServer();
+    ~TimerServer() override;
+
+    /** @brief Returns the engine-wide instance. */
+    static TimerServer* get_singleton();
+
+    /**
+     * @brief Schedules a native callback.
+     *
+     * The caller must cancel() the timer before @p context goes away.
+     *
+     * @param delay    Seconds until the first call.
+     * @param callback Function called on expiry.
+     * @param context  Passed back to @p callback.
+     * @param payload  Passed back to @p callback.
+     * @param period   Repeat interval in seconds (0 = fire once).
+     * @return The timer handle.
+     */
+    int64_t schedule_native(double delay, NativeCallback callback, void* context, uint64_t payload = 0, double period = 0.0);
+
+    /**
+     * @brief Schedules @p callback to be called after @p delay seconds.
+     *
+     * The timer is dropped if the Callable's object has been freed.
+     *
+     * @param period Repeat interval in seconds (0 = fire once).
+     * @return The timer handle.
+     */
+    int64_t schedule(double delay, const godot::Callable& callback, double period = 0.0);
+
+    /**
+     * @brief Schedules a batched event reported through `timers_fired`.
+     *
+     * @param tag    Caller-defined value reported with the event.
+     * @param owner  Optional object reported with the event; the timer is
+     *               dropped once the owner is freed.
+     * @param period Repeat interval in seconds (0 = fire once).
+     * @return The timer handle.
+     */
+    int64_t schedule_event(double delay, int tag, godot::Object* owner = nullptr, double period = 0.0);
+
+    /**
+     * @brief Cancels a pending timer.
+     * @return True if the handle referred to a live timer.
+     */
+    bool cancel(int64_t handle);
+
+    /**
+     * @brief Cancels every timer owned by @p owner (event owner or Callable target).
+     *
+     * Walks the whole pool; meant for teardown, not per-frame use.
+     *
+     * @return Number of timers cancelled.
+     */
+    int cancel_owned(godot::Object* owner);
+
+    /** @brief Returns whether @p handle refers to a pending timer. */
+    [[nodiscard]] bool is_active(int64_t handle) const;
+
+    /** @brief Returns the seconds left until @p handle fires (0 if it is not pending). */
+    [[nodiscard]] double get_remaining(int64_t handle) const;
+
+    /**
+     * @brief Advances the wheel by @p seconds and fires every timer that expires.
+     *
+     * Called automatically once per frame; only call it manually when time
+     * has to move without the SceneTree (e.g. tests or a fast-forward).
+     */
+    void advance(double seconds);
+
+    /** @brief Returns the number of pending timers. */
+    [[nodiscard]] int get_timer_count() const;
+
+    /**
+     * @brief Sets the number of ticks per second (1–1000).
+     *
+     * Pending timers keep their remaining tick count.
+     */
+    void set_tick_rate(int ticks_per_second);
+    /** @brief Returns the number of ticks per second. */
+    [[nodiscard]] int get_tick_rate() const;
+
+private:
+    /** Allocates a record and links it @p delay seconds ahead. */
+    int64_t allocate(Kind kind, double delay, double period);
+
+    [[nodiscard]] uint64_t to_ticks(double seconds) const;
+
+    /** Returns the record index for @p handle or NIL if it is stale. */
+    [[nodiscard]] uint32_t record_of(int64_t handle) const;
+
+    void link(uint32_t index);
+    void unlink(uint32_t index);
+    void release(uint32_t index);
+
+    /** Advances one tick: cascades upper levels if needed, then fires the current bucket. */
+    void run_tick();
+
+    /** Re-inserts every timer of one upper-level bucket into the levels below. */
+    void cascade(int level, uint32_t slot);
+
+    /** Invokes one expired timer and re-links or releases it. */
+    void fire(uint32_t index, uint32_t generation);
+
+    /** Emits `timers_fired` with the events collected since the last flush. */
+    void flush_events();
+
+    void connect_tree(godot::SceneTree* tree);
+
+    /** process_frame handler: advances by the root's process delta once per frame. */
+    void process_frame();
+};
+
+} // namespace Rebel::Timer
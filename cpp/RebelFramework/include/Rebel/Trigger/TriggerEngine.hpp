@@ -0,0 +1,266 @@
+// Copyright (c) 2026, and future.
+// Alejandro Morcillo Montejo - All Rights Reserved
+
+#pragma once
+
+#include "Rebel/Core.hpp"
+#include <godot_cpp/classes/object.hpp>
+#include <godot_cpp/templates/hash_map.hpp>
+#include <godot_cpp/variant/callable.hpp>
+#include <godot_cpp/variant/string_name.hpp>
+#include <godot_cpp/variant/vector2.hpp>
+#include <godot_cpp/variant/vector3.hpp>
+
+#include <cstdint>
+#include <vector>
+
+namespace godot {
+class Node;
+}
+
+namespace Rebel::Trigger {
+
+/**
+ * @brief Routes gameplay events to proc effects through flat, per-channel dispatch tables.
+ *
+ * Boons chain effects — on hit, chance to chain lightning; on kill, drop a
+ * gem. Rather than wiring those as signal connections between ability
+ * containers, effects subscribe to a typed channel here and gameplay code
+ * emits events into it. Each channel's subscribers are a dense array of POD
+ * records (handler, chance, source filter), so dispatching an event is one
+ * linear scan.
+ *
+ * Events are not dispatched when emitted: they are queued and resolved in
+ * one batch. The first event of a tick queues a deferred resolve(), which
+ * runs once the current `_physics_process()` or `_process()` step is done,
+ * so procs land in the same frame as the event that caused them.
+ * HealthServer also resolves right after it resolves damage. Events emitted
+ * by a handler join the same batch one level deeper. Two limits keep chains
+ * bounded:
+ *
+ *   - **max_depth** — events deeper than this are dropped, so A → B → A
+ *     loops stop after a few hops.
+ *   - **proc_budget** — at most this many handler calls per frame; anything
+ *     past it is dropped and counted in get_dropped_count().
+ *
+ * Built-in channels cover the player signals (`attack1_released`,
+ * `attack2_released`, `dodge_performed` — hook a character up with
+ * watch_character()) and the HealthServer results (`hit`, `kill`); `pickup`
+ * and any channel added with register_channel() are emitted by game code.
+ *
+ * Script handlers are called as `handler(source, target, amount, position)`.
+ *
+ * Registered as the `TriggerEngine` engine singleton.
+ */
+class REBEL_FRAMEWORK TriggerEngine : public godot::Object {
+    GDCLASS(TriggerEngine, godot::Object);
+
+public:
+    /** Built-in channels; register_channel() hands out ids from CHANNEL_BUILTIN_COUNT on. */
+    enum Channel {
+        CHANNEL_ATTACK1_RELEASED,
+        CHANNEL_ATTACK2_RELEASED,
+        CHANNEL_DODGE_PERFORMED,
+        CHANNEL_HIT,
+        CHANNEL_KILL,
+        CHANNEL_PICKUP,
+        CHANNEL_BUILTIN_COUNT,
+    };
+
+    /** One queued event. */
+    struct TriggerEvent {
+        int32_t channel{0};
+        int32_t depth{0};
+        uint64_t source_id{0};
+        uint64_t target_id{0};
+        float amount{0.0f};
+        godot::Vector3 position{};
+    };
+
+    /** Native handler: @p context is whatever was passed to subscribe_native(). */
+    using NativeHandler = void (*)(void* context, const TriggerEvent& event);
+
+private:
+    static TriggerEngine* s_singleton;
+
+    static constexpr uint32_t NO_CALLABLE = UINT32_MAX;
+
+    /** One entry of a channel's dispatch table. */
+    struct Subscriber {
+        int64_t id{0};                       ///< 0 = removed while resolving.
+        NativeHandler handler{nullptr};
+        void* context{nullptr};
+        uint32_t callable{NO_CALLABLE};      ///< Index into m_callables for script handlers.
+        float chance{1.0f};
+        uint64_t source_filter{0};           ///< Only events from this source (0 = any).
+        uint64_t owner_id{0};
+    };
+
+    /** Dispatch table per channel. */
+    std::vector<std::vector<Subscriber>> m_tables{};
+
+    godot::HashMap<godot::StringName, int32_t> m_channel_ids{};
+
+    /** Subscription id → (channel << 32 | index). */
+    godot::HashMap<int64_t, uint64_t> m_locations{};
+
+    std::vector<godot::Callable> m_callables{};
+    std::vector<uint32_t> m_free_callables{};
+
+    int64_t m_next_subscription{1};
+
+    /** Events waiting for resolve(); grows while resolving as handlers emit. */
+    std::vector<TriggerEvent> m_queue{};
+
+    int m_max_depth{4};
+    int m_proc_budget{256};
+
+    // --- Per-frame counters ---
+    uint64_t m_budget_frame{0};
+    int m_procs{0};
+    int m_dropped{0};
+
+    /** Depth of the event being dispatched (-1 outside resolve()). */
+    int32_t m_dispatch_depth{-1};
+
+    /** True while tables must not be reordered (resolve() is walking them). */
+    bool m_resolving{false};
+    bool m_needs_compact{false};
+
+    /** xorshift64* state for proc chance rolls. */
+    uint64_t m_rng_state{0x9E3779B97F4A7C15ull};
+
+    /** True while a deferred resolve() is queued. */
+    bool m_flush_queued{false};
+
+protected:
+    static void _bind_methods();
+
+public:
+    TriggerEngine();
+    ~TriggerEngine() override;
+
+    /** @brief Returns the engine-wide instance. */
+    static TriggerEngine* get_singleton();
+
+    /**
+     * @brief Returns the id of a named channel, creating it if needed.
+     * @param name Channel name; built-in names map to the Channel values.
+     */
+    int register_channel(const godot::StringName& name);
+
+    /** @brief Returns the id of a named channel, or -1 if it does not exist. */
+    [[nodiscard]] int get_channel(const godot::StringName& name) const;
+
+    /**
+     * @brief Subscribes a script handler to @p channel.
+     *
+     * @param channel  Channel id.
+     * @param handler  Called as handler(source, target, amount, position).
+     * @param chance   Probability (0–1) that the handler procs for a given event.
+     * @param source   Only react to events emitted by this object (null = any).
+     * @return The subscription id.
+     */
+    int64_t subscribe(int channel, const godot::Callable& handler, float chance = 1.0f, godot::Object* source = nullptr);
+
+    /**
+     * @brief Subscribes a native handler to @p channel.
+     *
+     * The caller must unsubscribe() before @p context goes away.
+     *
+     * @param source_id Only react to events from this instance id (0 = any).
+     * @return The subscription id.
+     */
+    int64_t subscribe_native(int channel, NativeHandler handler, void* context, float chance = 1.0f, uint64_t source_id = 0);
+
+    /**
+     * @brief Removes a subscription.
+     * @return True if it existed.
+     */
+    bool unsubscribe(int64_t subscription);
+
+    /**
+     * @brief Removes every script subscription whose handler targets @p owner.
+     * @return Number of subscriptions removed.
+     */
+    int unsubscribe_owned(godot::Object* owner);
+
+    /**
+     * @brief Queues an event on @p channel.
+     *
+     * Called from a handler, the event is one level deeper than the one
+     * being dispatched and resolves in the same batch.
+     */
+    void emit(int channel, godot::Object* source, godot::Object* target, float amount = 0.0f, const godot::Vector3& position = godot::Vector3());
+
+    /** @brief Native emit; depth is assigned the same way as emit(). */
+    void emit_event(const TriggerEvent& event);
+
+    /**
+     * @brief Dispatches every queued event, including the ones handlers emit meanwhile.
+     *
+     * Called automatically at the end of the step that queued the first
+     * event; safe to call again (the budget is per frame, not per call).
+     */
+    void resolve();
+
+    /**
+     * @brief Forwards @p character's attack and dodge signals to their channels.
+     *
+     * The character is the event source, the charge level the amount and the
+     * character's global position the event position.
+     */
+    void watch_character(godot::Node* character);
+
+    /** @brief Stops forwarding @p character's signals. */
+    void unwatch_character(godot::Node* character);
+
+    /** @brief Sets the deepest chain level still dispatched (>= 0). */
+    void set_max_depth(int depth);
+    /** @brief Returns the deepest chain level still dispatched. */
+    [[nodiscard]] int get_max_depth() const;
+
+    /** @brief Sets the maximum number of handler calls per frame (>= 1). */
+    void set_proc_budget(int procs);
+    /** @brief Returns the maximum number of handler calls per frame. */
+    [[nodiscard]] int get_proc_budget() const;
+
+    /** @brief Reseeds the proc chance generator. */
+    void set_seed(int64_t seed);
+
+    /** @brief Returns the number of events waiting for resolve(). */
+    [[nodiscard]] int get_pending_events() const;
+
+    /** @brief Returns the number of handler calls made this frame. */
+    [[nodiscard]] int get_proc_count() const;
+
+    /** @brief Returns the number of events or procs dropped this frame by the depth or budget limits. */
+    [[nodiscard]] int get_dropped_count() const;
+
+    /** @brief Returns the number of subscriptions on @p channel. */
+    [[nodiscard]] int get_subscriber_count(int channel) const;
+
+private:
+    int64_t add_subscriber(int channel, Subscriber subscriber);
+
+    /** Removes the entry at @p index from @p channel's table (swap-remove or tombstone). */
+    void remove_at(int channel, uint32_t index);
+
+    /** Drops tombstones left by removals during resolve(). */
+    void compact();
+
+    /** Runs every subscriber of @p event's channel. */
+    void dispatch(const TriggerEvent& event);
+
+    /** Resets the per-frame counters when a new frame starts. */
+    void begin_frame();
+
+    [[nodiscard]] float next_random();
+
+    void on_charge_released(float charge_level, int channel, godot::Object* character);
+    void on_dodge_performed(const godot::Vector2& direction, godot::Object* character);
+};
+
+} // namespace Rebel::Trigger
+
+VARIANT_ENUM_CAST(Rebel::Trigger::TriggerEngine::Channel);
@@ -3,26 +3,43 @@
 
 #include "Rebel/Ability/Ability.hpp"
 
+#include "Rebel/Ability/AbilityRegistry.hpp"
+
 #include <godot_cpp/core/class_db.hpp>
 
+#include <array>
+
 using namespace godot;
 
 namespace Rebel::Ability {
 
+namespace {
+
+/** One frozen default per level, shared by every Ability. */
+std::array<Ref<AbilityImprovement>, Ability::IMPROVEMENT_COUNT> g_shared_defaults{};
+
+constexpr auto IMPROVEMENT_PREFIX = "improvement_";
+
+/** Parses "improvement_<level>/<field>"; returns false for other names. */
+bool parse_improvement_property(const StringName& p_name, int& r_level, String& r_field) {
+    const String name = p_name;
+    if (!name.begins_with(IMPROVEMENT_PREFIX)) {
+        return false;
+    }
+    r_level = name.get_slice("/", 0).trim_prefix(IMPROVEMENT_PREFIX).to_int();
+    r_field = name.get_slice("/", 1);
+    return r_level >= 1 && r_level <= Ability::IMPROVEMENT_COUNT;
+}
+
+} // namespace
+
 // ---------------------------------------------------------------------------
 // Constructor
 // ---------------------------------------------------------------------------
 
 Ability::Ability() {
-    // Pre-populate exactly IMPROVEMENT_COUNT improvement slots so the
-    // Godot Inspector always shows a consistent, fully-formed array.
+    // All slots start empty; they read as the shared defaults until authored.
     m_improvements.resize(IMPROVEMENT_COUNT);
-    for (int i = 0; i < IMPROVEMENT_COUNT; ++i) {
-        Ref<AbilityImprovement> improvement;
-        improvement.instantiate();
-        improvement->set_level(i + 1); // Levels are 1-indexed
-        m_improvements[i] = improvement;
-    }
 }
 
 // ---------------------------------------------------------------------------
@@ -30,6 +47,12 @@ Ability::Ability() {
 // ---------------------------------------------------------------------------
 
 void Ability::_bind_methods() {
+    // --- id ---
+    ClassDB::bind_method(D_METHOD("set_id", "id"), &Ability::set_id);
+    ClassDB::bind_method(D_METHOD("get_id"), &Ability::get_id);
+    ClassDB::bind_method(D_METHOD("get_registry_key"), &Ability::get_registry_key);
+    ClassDB::bind_method(D_METHOD("get_registry_id"), &Ability::get_registry_id);
+
     // --- name ---
     ClassDB::bind_method(D_METHOD("set_name", "name"), &Ability::set_name);
     ClassDB::bind_method(D_METHOD("get_name"), &Ability::get_name);
@@ -37,15 +60,12 @@ void Ability::_bind_methods() {
     // --- description ---
     ClassDB::bind_method(D_METHOD("set_description", "description"), &Ability::set_description);
     ClassDB::bind_method(D_METHOD("get_description"), &Ability::get_description);
+    ClassDB::bind_method(D_METHOD("format_description", "attributes", "level"), &Ability::format_description, DEFVAL(0));
 
     // --- icon ---
     ClassDB::bind_method(D_METHOD("set_icon", "icon"), &Ability::set_icon);
     ClassDB::bind_method(D_METHOD("get_icon"), &Ability::get_icon);
 
-    // --- enabled ---
-    ClassDB::bind_method(D_METHOD("set_enabled", "enabled"), &Ability::set_enabled);
-    ClassDB::bind_method(D_METHOD("get_enabled"), &Ability::get_enabled);
-
     // --- cost ---
     ClassDB::bind_method(D_METHOD("set_cost", "cost"), &Ability::set_cost);
     ClassDB::bind_method(D_METHOD("get_cost"), &Ability::get_cost);
@@ -53,33 +73,51 @@ void Ability::_bind_methods() {
     // --- improvements ---
     ClassDB::bind_method(D_METHOD("set_improvements", "improvements"), &Ability::set_improvements);
     ClassDB::bind_method(D_METHOD("get_improvements"), &Ability::get_improvements);
-
-    // --- current_level ---
-    ClassDB::bind_method(D_METHOD("set_current_level", "level"), &Ability::set_current_level);
-    ClassDB::bind_method(D_METHOD("get_current_level"), &Ability::get_current_level);
-
-    // --- helper ---
-    ClassDB::bind_method(D_METHOD("get_active_improvement"), &Ability::get_active_improvement);
+    ClassDB::bind_method(D_METHOD("get_authored_improvements"), &Ability::get_authored_improvements);
+    ClassDB::bind_method(D_METHOD("get_improvement", "level"), &Ability::get_improvement);
+    ClassDB::bind_method(D_METHOD("set_improvement", "level", "improvement"), &Ability::set_improvement);
+    ClassDB::bind_method(D_METHOD("materialize_improvement", "level"), &Ability::materialize_improvement);
+    ClassDB::bind_method(D_METHOD("has_improvement", "level"), &Ability::has_improvement);
 
     ADD_GROUP("Ability", "");
+    ADD_PROPERTY(PropertyInfo(Variant::STRING, "id",            PROPERTY_HINT_NONE),                         "set_id",            "get_id");
     ADD_PROPERTY(PropertyInfo(Variant::STRING, "name",          PROPERTY_HINT_NONE),                         "set_name",          "get_name");
     ADD_PROPERTY(PropertyInfo(Variant::STRING, "description",   PROPERTY_HINT_MULTILINE_TEXT),               "set_description",   "get_description");
     ADD_PROPERTY(PropertyInfo(Variant::OBJECT, "icon",           PROPERTY_HINT_RESOURCE_TYPE, "Texture2D"),  "set_icon",          "get_icon");
-    ADD_PROPERTY(PropertyInfo(Variant::BOOL,   "enabled"),                                                   "set_enabled",       "get_enabled");
     ADD_PROPERTY(PropertyInfo(Variant::FLOAT,  "cost",          PROPERTY_HINT_RANGE, "0,99999,0.1,or_greater"), "set_cost",       "get_cost");
-    ADD_PROPERTY(PropertyInfo(Variant::INT,    "current_level", PROPERTY_HINT_RANGE, "0,10,1"),              "set_current_level", "get_current_level");
 
-    // Expose the improvements array with an element type hint so the inspector
-    // knows each slot should be an AbilityImprovement resource.
+    // The sparse array is storage-only; the Inspector edits the tiers through
+    // the improvement_N/* properties from _get_property_list().
     ADD_PROPERTY(PropertyInfo(Variant::ARRAY, "improvements",
-                              PROPERTY_HINT_ARRAY_TYPE, "AbilityImprovement"),
-                 "set_improvements", "get_improvements");
+                              PROPERTY_HINT_ARRAY_TYPE, "AbilityImprovement", PROPERTY_USAGE_STORAGE),
+                 "set_improvements", "get_authored_improvements");
 }
 
 // ---------------------------------------------------------------------------
 // Setters / getters
 // ---------------------------------------------------------------------------
 
+void Ability::set_id(const String& id) {
+    m_id = id;
+    m_registry_id = id.is_empty() ? 0 : AbilityRegistry::make_id(id);
+}
+
+String Ability::get_id() const {
+    return m_id;
+}
+
+String Ability::get_registry_key() const {
+    return m_id.is_empty() ? get_path() : m_id;
+}
+
+int64_t Ability::get_registry_id() const {
+    if (m_registry_id != 0) {
+        return m_registry_id;
+    }
+    const String path = get_path();
+    return path.is_empty() ? static_cast<int64_t>(get_instance_id()) : AbilityRegistry::make_id(path);
+}
+
 void Ability::set_name(const String& name) {
     m_name = name;
 }
@@ -89,11 +127,15 @@ String Ability::get_name() const {
 }
 
 void Ability::set_description(const String& description) {
-    m_description = description;
+    m_description.set_source(description);
 }
 
 String Ability::get_description() const {
-    return m_description;
+    return m_description.get_source();
+}
+
+String Ability::format_description(const Ref<Attribute::AttributeSet>& attributes, const int level) {
+    return m_description.render(attributes.ptr(), level);
 }
 
 void Ability::set_icon(const Ref<Texture2D>& icon) {
@@ -104,14 +146,6 @@ Ref<Texture2D> Ability::get_icon() const {
     return m_icon;
 }
 
-void Ability::set_enabled(const bool enabled) {
-    m_enabled = enabled;
-}
-
-bool Ability::get_enabled() const {
-    return m_enabled;
-}
-
 void Ability::set_cost(const float cost) {
     m_cost = Math::max(0.0f, cost);
 }
@@ -121,31 +155,119 @@ float Ability::get_cost() const {
 }
 
 void Ability::set_improvements(const Array& improvements) {
-    m_improvements = improvements;
+    m_improvements = improvements.duplicate();
     normalize_improvements();
 }
 
 Array Ability::get_improvements() const {
+    Array result{};
+    result.resize(IMPROVEMENT_COUNT);
+    for (int i = 0; i < IMPROVEMENT_COUNT; ++i) {
+        result[i] = get_improvement(i + 1);
+    }
+    return result;
+}
+
+Array Ability::get_authored_improvements() const {
     return m_improvements;
 }
 
-void Ability::set_current_level(const int level) {
-    m_current_level = Math::clamp(level, 0, IMPROVEMENT_COUNT);
+Ref<AbilityImprovement> Ability::get_improvement(const int level) const {
+    if (level < 1 || level > IMPROVEMENT_COUNT) {
+        return {};
+    }
+    const Ref<AbilityImprovement> improvement = m_improvements[level - 1];
+    return improvement.is_valid() ? improvement : get_shared_default(level);
 }
 
-int Ability::get_current_level() const {
-    return m_current_level;
+void Ability::set_improvement(const int level, const Ref<AbilityImprovement>& improvement) {
+    ERR_FAIL_COND(level < 1 || level > IMPROVEMENT_COUNT);
+    if (improvement.is_valid() && !improvement->is_frozen()) {
+        improvement->set_level(level);
+        m_improvements[level - 1] = improvement;
+    } else {
+        m_improvements[level - 1] = Variant();
+    }
+    emit_changed();
 }
 
-Ref<AbilityImprovement> Ability::get_active_improvement() const {
-    if (m_current_level <= 0) {
-        return {};
+Ref<AbilityImprovement> Ability::materialize_improvement(const int level) {
+    ERR_FAIL_COND_V(level < 1 || level > IMPROVEMENT_COUNT, {});
+    Ref<AbilityImprovement> improvement = m_improvements[level - 1];
+    if (improvement.is_null()) {
+        improvement.instantiate();
+        improvement->set_level(level);
+        m_improvements[level - 1] = improvement;
     }
-    const int index = m_current_level - 1;
-    if (index >= m_improvements.size()) {
-        return {};
+    return improvement;
+}
+
+bool Ability::has_improvement(const int level) const {
+    if (level < 1 || level > IMPROVEMENT_COUNT) {
+        return false;
+    }
+    return Ref<AbilityImprovement>(m_improvements[level - 1]).is_valid();
+}
+
+// ---------------------------------------------------------------------------
+// Inspector view of the improvement tiers
+// ---------------------------------------------------------------------------
+
+bool Ability::_set(const StringName& p_name, const Variant& p_value) {
+    int level = 0;
+    String field;
+    if (!parse_improvement_property(p_name, level, field)) {
+        return false;
+    }
+
+    const Ref<AbilityImprovement> current = get_improvement(level);
+    // Writing a default value into an unauthored tier must not allocate it.
+    if (current->is_frozen() && current->get(field) == p_value) {
+        return true;
+    }
+
+    const Ref<AbilityImprovement> improvement = materialize_improvement(level);
+    if (field == "description") {
+        improvement->set_description(p_value);
+    } else if (field == "icon") {
+        improvement->set_icon(p_value);
+    } else if (field == "cost") {
+        improvement->set_cost(p_value);
+    } else {
+        return false;
+    }
+    emit_changed();
+    return true;
+}
+
+bool Ability::_get(const StringName& p_name, Variant& r_ret) const {
+    int level = 0;
+    String field;
+    if (!parse_improvement_property(p_name, level, field)) {
+        return false;
+    }
+
+    const Ref<AbilityImprovement> improvement = get_improvement(level);
+    if (field == "description") {
+        r_ret = improvement->get_description();
+    } else if (field == "icon") {
+        r_ret = improvement->get_icon();
+    } else if (field == "cost") {
+        r_ret = improvement->get_cost();
+    } else {
+        return false;
+    }
+    return true;
+}
+
+void Ability::_get_property_list(List<PropertyInfo>* p_list) const {
+    // Editor-only: the data itself is serialized through "improvements".
+    for (int level = 1; level <= IMPROVEMENT_COUNT; ++level) {
+        const String prefix = IMPROVEMENT_PREFIX + itos(level) + "/";
+        p_list->push_back(PropertyInfo(Variant::STRING, prefix + "description", PROPERTY_HINT_MULTILINE_TEXT, "", PROPERTY_USAGE_EDITOR));
+        p_list->push_back(PropertyInfo(Variant::OBJECT, prefix + "icon", PROPERTY_HINT_RESOURCE_TYPE, "Texture2D", PROPERTY_USAGE_EDITOR));
+        p_list->push_back(PropertyInfo(Variant::FLOAT, prefix + "cost", PROPERTY_HINT_RANGE, "0,99999,0.1,or_greater", PROPERTY_USAGE_EDITOR));
     }
-    return m_improvements[index];
 }
 
 // ---------------------------------------------------------------------------
@@ -153,22 +275,35 @@ Ref<AbilityImprovement> Ability::get_active_improvement() const {
 // ---------------------------------------------------------------------------
 
 void Ability::normalize_improvements() {
-    // Ensure we always have exactly IMPROVEMENT_COUNT slots.
-    // If the incoming array was shorter, pad with default improvements.
-    const int current_size = m_improvements.size();
-    if (current_size < IMPROVEMENT_COUNT) {
-        m_improvements.resize(IMPROVEMENT_COUNT);
-        for (int i = current_size; i < IMPROVEMENT_COUNT; ++i) {
-            Ref<AbilityImprovement> improvement;
-            improvement.instantiate();
+    // Exactly IMPROVEMENT_COUNT slots: pad with empty slots, or truncate
+    // silently if the designer added more slots than the system supports.
+    m_improvements.resize(IMPROVEMENT_COUNT);
+
+    // Keep only authored data; placeholders from older files, shared
+    // defaults and untouched improvements become empty slots.
+    for (int i = 0; i < IMPROVEMENT_COUNT; ++i) {
+        const Ref<AbilityImprovement> improvement = m_improvements[i];
+        if (improvement.is_null() || improvement->is_frozen() || improvement->is_default()) {
+            m_improvements[i] = Variant();
+        } else {
             improvement->set_level(i + 1);
-            m_improvements[i] = improvement;
         }
     }
-    // If larger than IMPROVEMENT_COUNT, truncate silently — the designer
-    // added more slots than the system supports.
-    if (m_improvements.size() > IMPROVEMENT_COUNT) {
-        m_improvements.resize(IMPROVEMENT_COUNT);
+}
+
+Ref<AbilityImprovement> Ability::get_shared_default(const int level) {
+    Ref<AbilityImprovement>& improvement = g_shared_defaults[level - 1];
+    if (improvement.is_null()) {
+        improvement.instantiate();
+        improvement->set_level(level);
+        improvement->freeze();
+    }
+    return improvement;
+}
+
+void Ability::free_shared_defaults() {
+    for (Ref<AbilityImprovement>& improvement : g_shared_defaults) {
+        improvement.unref();
     }
 }
 
@@ -0,0 +1,100 @@
+// Copyright (c) 2026, and future.
+// Alejandro Morcillo Montejo - All Rights Reserved
+
+#include "Rebel/Ability/AbilityBehaviour.hpp"
+
+#include "Rebel/Ability/AbilityScheduler.hpp"
+
+#include <godot_cpp/classes/engine.hpp>
+#include <godot_cpp/core/class_db.hpp>
+
+using namespace godot;
+
+namespace Rebel::Ability {
+
+// ---------------------------------------------------------------------------
+// _bind_methods
+// ---------------------------------------------------------------------------
+
+void AbilityBehaviour::_bind_methods() {
+    ClassDB::bind_method(D_METHOD("is_scheduled"), &AbilityBehaviour::is_scheduled);
+
+    GDVIRTUAL_BIND(_tick, "delta");
+}
+
+AbilityBehaviour::~AbilityBehaviour() {
+    unschedule();
+}
+
+void AbilityBehaviour::_notification(const int p_what) {
+    switch (p_what) {
+        case NOTIFICATION_ENTER_TREE:
+            if (is_active() && can_process()) {
+                schedule();
+            }
+            break;
+        case NOTIFICATION_EXIT_TREE:
+            unschedule();
+            break;
+        // process_mode DISABLED here or on an ancestor (e.g. a culled room)
+        // takes the behaviour out of the scheduler until it is enabled again.
+        case NOTIFICATION_ENABLED:
+            if (is_active() && is_inside_tree()) {
+                schedule();
+            }
+            break;
+        case NOTIFICATION_DISABLED:
+            unschedule();
+            break;
+        default:
+            break;
+    }
+}
+
+// ---------------------------------------------------------------------------
+// Lifecycle
+// ---------------------------------------------------------------------------
+
+void AbilityBehaviour::on_activated() {
+    AbilityScriptContainerNode::on_activated();
+    if (is_inside_tree() && can_process()) {
+        schedule();
+    }
+}
+
+void AbilityBehaviour::on_deactivated() {
+    unschedule();
+    AbilityScriptContainerNode::on_deactivated();
+}
+
+void AbilityBehaviour::tick(const double delta) {
+    if (m_script_tick) {
+        GDVIRTUAL_CALL(_tick, delta);
+    }
+}
+
+bool AbilityBehaviour::is_scheduled() const {
+    return m_schedule_group >= 0;
+}
+
+// ---------------------------------------------------------------------------
+// Scheduling
+// ---------------------------------------------------------------------------
+
+void AbilityBehaviour::schedule() {
+    AbilityScheduler* scheduler = AbilityScheduler::get_singleton();
+    if (scheduler == nullptr || Engine::get_singleton()->is_editor_hint()) {
+        return;
+    }
+    // Checked once here rather than on every tick.
+    m_script_tick = has_method("_tick");
+    scheduler->add(this, get_tree());
+}
+
+void AbilityBehaviour::unschedule() {
+    if (AbilityScheduler* scheduler = AbilityScheduler::get_singleton()) {
+        scheduler->remove(this);
+    }
+}
+
+} // namespace Rebel::Ability
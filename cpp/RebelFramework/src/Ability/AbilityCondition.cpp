@@ -0,0 +1,483 @@
+// Copyright (c) 2026, and future.
+// Alejandro Morcillo Montejo - All Rights Reserved
+
+#include "Rebel/Ability/AbilityCondition.hpp"
+
+#include "Rebel/Ability/AbilityGraph.hpp"
+#include "Rebel/Attribute/AttributeSet.hpp"
+
+#include <algorithm>
+#include <bit>
+
+using namespace godot;
+
+namespace Rebel::Ability {
+
+namespace {
+
+// ---------------------------------------------------------------------------
+// Lexer
+// ---------------------------------------------------------------------------
+
+enum TokenKind {
+    TOKEN_END,
+    TOKEN_NUMBER,
+    TOKEN_IDENTIFIER,
+    TOKEN_STRING,
+    TOKEN_REF,
+    TOKEN_OPEN,
+    TOKEN_CLOSE,
+    TOKEN_COMMA,
+    TOKEN_COMPARE,
+    TOKEN_AND,
+    TOKEN_OR,
+    TOKEN_NOT,
+    TOKEN_INVALID,
+};
+
+struct Token {
+    TokenKind kind{TOKEN_END};
+    String text{};
+    float number{0.0f};
+    AbilityCondition::Opcode compare{AbilityCondition::OP_EQUAL};
+    int column{0};
+};
+
+bool is_identifier_char(const char32_t c, const bool first) {
+    return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || c == '_' || (!first && c >= '0' && c <= '9');
+}
+
+bool is_digit(const char32_t c) {
+    return c >= '0' && c <= '9';
+}
+
+/**
+ * Recursive-descent compiler: parses one token ahead and emits postfix code
+ * as it goes, tracking the operand stack depth.
+ */
+class Compiler {
+    using Instruction = AbilityCondition::Instruction;
+    using Opcode = AbilityCondition::Opcode;
+
+    const String& m_source;
+    std::span<const AbilityCondition::PrerequisiteRef> m_prerequisites;
+    std::vector<Instruction>& m_code;
+    std::vector<int32_t>& m_ids;
+    std::vector<StringName>& m_attributes;
+
+    int m_position{0};
+    Token m_token{};
+    int m_depth{0};
+
+public:
+    String error{};
+
+    Compiler(const String& source, const std::span<const AbilityCondition::PrerequisiteRef> prerequisites,
+             std::vector<Instruction>& code, std::vector<int32_t>& ids, std::vector<StringName>& attributes)
+        : m_source(source), m_prerequisites(prerequisites), m_code(code), m_ids(ids), m_attributes(attributes) {}
+
+    bool run() {
+        advance();
+        parse_or();
+        if (error.is_empty() && m_token.kind != TOKEN_END) {
+            fail("unexpected '" + m_token.text + "'");
+        }
+        return error.is_empty();
+    }
+
+private:
+    // --- Tokens ---
+
+    void advance() {
+        const int length = m_source.length();
+        while (m_position < length && m_source[m_position] <= ' ') {
+            ++m_position;
+        }
+        m_token = Token{};
+        m_token.column = m_position + 1;
+        if (m_position >= length) {
+            return;
+        }
+
+        const int start = m_position;
+        const char32_t c = m_source[m_position];
+        const char32_t next = m_position + 1 < length ? m_source[m_position + 1] : U'\0';
+        auto single = [&](const TokenKind kind, const int size) {
+            m_token.kind = kind;
+            m_position += size;
+            m_token.text = m_source.substr(start, size);
+        };
+
+        if (is_digit(c) || (c == '.' && is_digit(next))) {
+            while (m_position < length && (is_digit(m_source[m_position]) || m_source[m_position] == '.')) {
+                ++m_position;
+            }
+            m_token.kind = TOKEN_NUMBER;
+            m_token.text = m_source.substr(start, m_position - start);
+            m_token.number = static_cast<float>(m_token.text.to_float());
+        } else if (is_identifier_char(c, true)) {
+            while (m_position < length && is_identifier_char(m_source[m_position], false)) {
+                ++m_position;
+            }
+            m_token.text = m_source.substr(start, m_position - start);
+            m_token.kind = m_token.text == "and" ? TOKEN_AND
+                         : m_token.text == "or"  ? TOKEN_OR
+                         : m_token.text == "not" ? TOKEN_NOT
+                                                 : TOKEN_IDENTIFIER;
+        } else if (c == '"' || c == '\'') {
+            const int end = m_source.find_char(c, m_position + 1);
+            if (end < 0) {
+                single(TOKEN_INVALID, length - start);
+                return;
+            }
+            m_token.kind = TOKEN_STRING;
+            m_token.text = m_source.substr(start + 1, end - start - 1);
+            m_position = end + 1;
+        } else if (c == '#' && is_digit(next)) {
+            ++m_position;
+            while (m_position < length && is_digit(m_source[m_position])) {
+                ++m_position;
+            }
+            m_token.kind = TOKEN_REF;
+            m_token.text = m_source.substr(start, m_position - start);
+            m_token.number = static_cast<float>(m_token.text.substr(1).to_int());
+        } else if (c == '(') {
+            single(TOKEN_OPEN, 1);
+        } else if (c == ')') {
+            single(TOKEN_CLOSE, 1);
+        } else if (c == ',') {
+            single(TOKEN_COMMA, 1);
+        } else if (c == '&' && next == '&') {
+            single(TOKEN_AND, 2);
+        } else if (c == '|' && next == '|') {
+            single(TOKEN_OR, 2);
+        } else if ((c == '<' || c == '>' || c == '=' || c == '!') && next == '=') {
+            single(TOKEN_COMPARE, 2);
+            m_token.compare = c == '<' ? AbilityCondition::OP_LESS_EQUAL
+                            : c == '>' ? AbilityCondition::OP_GREATER_EQUAL
+                            : c == '=' ? AbilityCondition::OP_EQUAL
+                                       : AbilityCondition::OP_NOT_EQUAL;
+        } else if (c == '<' || c == '>') {
+            single(TOKEN_COMPARE, 1);
+            m_token.compare = c == '<' ? AbilityCondition::OP_LESS : AbilityCondition::OP_GREATER;
+        } else if (c == '!') {
+            single(TOKEN_NOT, 1);
+        } else {
+            single(TOKEN_INVALID, 1);
+        }
+    }
+
+    bool expect(const TokenKind kind, const char* what) {
+        if (m_token.kind != kind) {
+            fail(vformat("expected %s, found '%s'", what, m_token.kind == TOKEN_END ? String("end") : m_token.text));
+            return false;
+        }
+        advance();
+        return true;
+    }
+
+    void fail(const String& message) {
+        if (error.is_empty()) {
+            error = vformat("column %d: %s", m_token.column, message);
+        }
+        // Stop parsing: pretend the input ended.
+        m_token.kind = TOKEN_END;
+        m_position = m_source.length();
+    }
+
+    // --- Emission ---
+
+    void emit(const Instruction& instruction, const int stack_delta) {
+        m_code.push_back(instruction);
+        m_depth += stack_delta;
+        if (m_depth > AbilityCondition::MAX_STACK) {
+            fail("expression is nested too deeply");
+        }
+    }
+
+    void emit_push(const float value) {
+        emit({AbilityCondition::OP_PUSH, 0, 0, value, 0}, 1);
+    }
+
+    void emit_binary(const Opcode op) {
+        emit({op, 0, 0, 0.0f, 0}, -1);
+    }
+
+    /**
+     * Emits code pushing how many of @p refs are enabled; returns the number
+     * of distinct refs (unresolved prerequisites count but are never enabled).
+     */
+    int emit_count(const std::vector<int32_t>& refs) {
+        std::vector<int32_t> resolved{};
+        int unresolved = 0;
+        for (const int32_t id : refs) {
+            if (id < 0) {
+                ++unresolved;
+            } else {
+                resolved.push_back(id);
+            }
+        }
+        std::sort(resolved.begin(), resolved.end());
+        resolved.erase(std::unique(resolved.begin(), resolved.end()), resolved.end());
+
+        if (resolved.empty()) {
+            emit_push(0.0f);
+        } else if (resolved.front() >> 6 == resolved.back() >> 6) {
+            // Every id lives in the same bitset word: one AND + popcount.
+            uint64_t mask = 0;
+            for (const int32_t id : resolved) {
+                mask |= uint64_t{1} << (id & 63);
+            }
+            emit({AbilityCondition::OP_COUNT_MASK, resolved.front() >> 6, 0, 0.0f, mask}, 1);
+        } else {
+            const auto offset = static_cast<int32_t>(m_ids.size());
+            m_ids.insert(m_ids.end(), resolved.begin(), resolved.end());
+            emit({AbilityCondition::OP_COUNT_LIST, offset, static_cast<int32_t>(resolved.size()), 0.0f, 0}, 1);
+        }
+        return static_cast<int>(resolved.size()) + unresolved;
+    }
+
+    // --- Grammar ---
+
+    void parse_or() {
+        parse_and();
+        while (m_token.kind == TOKEN_OR) {
+            advance();
+            parse_and();
+            emit_binary(AbilityCondition::OP_OR);
+        }
+    }
+
+    void parse_and() {
+        parse_not();
+        while (m_token.kind == TOKEN_AND) {
+            advance();
+            parse_not();
+            emit_binary(AbilityCondition::OP_AND);
+        }
+    }
+
+    void parse_not() {
+        if (m_token.kind == TOKEN_NOT) {
+            advance();
+            parse_not();
+            emit({AbilityCondition::OP_NOT, 0, 0, 0.0f, 0}, 0);
+            return;
+        }
+        parse_comparison();
+    }
+
+    void parse_comparison() {
+        parse_primary();
+        if (m_token.kind == TOKEN_COMPARE) {
+            const Opcode op = m_token.compare;
+            advance();
+            parse_primary();
+            emit_binary(op);
+        }
+    }
+
+    void parse_primary() {
+        switch (m_token.kind) {
+            case TOKEN_NUMBER:
+                emit_push(m_token.number);
+                advance();
+                return;
+            case TOKEN_OPEN:
+                advance();
+                parse_or();
+                expect(TOKEN_CLOSE, "')'");
+                return;
+            case TOKEN_IDENTIFIER:
+                parse_identifier();
+                return;
+            default:
+                fail(m_token.kind == TOKEN_END ? String("unexpected end of condition")
+                                               : "unexpected '" + m_token.text + "'");
+                return;
+        }
+    }
+
+    void parse_identifier() {
+        const String name = m_token.text;
+        advance();
+        if (name == "true" || name == "false") {
+            emit_push(name == "true" ? 1.0f : 0.0f);
+            return;
+        }
+        if (!expect(TOKEN_OPEN, "'(' after function name")) {
+            return;
+        }
+
+        if (name == "all" || name == "any" || name == "count") {
+            const int total = emit_count(parse_refs());
+            if (name != "count") {
+                emit_push(name == "all" ? static_cast<float>(total) : 1.0f);
+                emit_binary(AbilityCondition::OP_GREATER_EQUAL);
+            }
+        } else if (name == "at_least") {
+            const float required = m_token.number;
+            if (!expect(TOKEN_NUMBER, "a number")) {
+                return;
+            }
+            std::vector<int32_t> refs{};
+            if (m_token.kind == TOKEN_COMMA) {
+                advance();
+                refs = parse_refs();
+            } else {
+                refs = all_prerequisites();
+            }
+            emit_count(refs);
+            emit_push(required);
+            emit_binary(AbilityCondition::OP_GREATER_EQUAL);
+        } else if (name == "unlocked") {
+            emit_count({parse_ref()});
+            emit_push(1.0f);
+            emit_binary(AbilityCondition::OP_GREATER_EQUAL);
+        } else if (name == "level") {
+            emit({AbilityCondition::OP_LEVEL, parse_ref(), 0, 0.0f, 0}, 1);
+        } else if (name == "attr") {
+            if (m_token.kind != TOKEN_IDENTIFIER && m_token.kind != TOKEN_STRING) {
+                fail("expected an attribute name");
+                return;
+            }
+            const StringName attribute = m_token.text;
+            advance();
+            auto found = std::find(m_attributes.begin(), m_attributes.end(), attribute);
+            const auto index = static_cast<int32_t>(found - m_attributes.begin());
+            if (found == m_attributes.end()) {
+                m_attributes.push_back(attribute);
+            }
+            emit({AbilityCondition::OP_ATTRIBUTE, index, 0, 0.0f, 0}, 1);
+        } else {
+            fail("unknown function '" + name + "'");
+            return;
+        }
+        expect(TOKEN_CLOSE, "')'");
+    }
+
+    /** Parses a comma-separated ref list up to (not including) ')'; empty means every prerequisite. */
+    std::vector<int32_t> parse_refs() {
+        if (m_token.kind == TOKEN_CLOSE) {
+            return all_prerequisites();
+        }
+        std::vector<int32_t> refs{parse_ref()};
+        while (m_token.kind == TOKEN_COMMA) {
+            advance();
+            refs.push_back(parse_ref());
+        }
+        return refs;
+    }
+
+    int32_t parse_ref() {
+        if (m_token.kind == TOKEN_REF) {
+            const auto index = static_cast<size_t>(m_token.number);
+            if (index >= m_prerequisites.size()) {
+                fail(vformat("%s: the node has only %d prerequisites", m_token.text, static_cast<int>(m_prerequisites.size())));
+                return -1;
+            }
+            advance();
+            return m_prerequisites[index].id;
+        }
+        if (m_token.kind == TOKEN_STRING) {
+            for (const AbilityCondition::PrerequisiteRef& prerequisite : m_prerequisites) {
+                if (prerequisite.key == m_token.text || prerequisite.name == m_token.text) {
+                    advance();
+                    return prerequisite.id;
+                }
+            }
+            fail("\"" + m_token.text + "\" is not a prerequisite of this node");
+            return -1;
+        }
+        fail("expected a prerequisite (#index or \"ability id\")");
+        return -1;
+    }
+
+    std::vector<int32_t> all_prerequisites() const {
+        std::vector<int32_t> refs{};
+        refs.reserve(m_prerequisites.size());
+        for (const AbilityCondition::PrerequisiteRef& prerequisite : m_prerequisites) {
+            refs.push_back(prerequisite.id);
+        }
+        return refs;
+    }
+};
+
+} // namespace
+
+// ---------------------------------------------------------------------------
+// AbilityCondition
+// ---------------------------------------------------------------------------
+
+bool AbilityCondition::compile(const String& source, const std::span<const PrerequisiteRef> prerequisites, String& r_error) {
+    m_code.clear();
+    m_ids.clear();
+    m_attributes.clear();
+
+    Compiler compiler(source, prerequisites, m_code, m_ids, m_attributes);
+    if (compiler.run()) {
+        return true;
+    }
+
+    r_error = compiler.error;
+    m_code.assign(1, Instruction{OP_PUSH, 0, 0, 0.0f, 0});
+    m_ids.clear();
+    m_attributes.clear();
+    return false;
+}
+
+bool AbilityCondition::evaluate(const AbilityConditionContext& context) const {
+    float stack[MAX_STACK];
+    int top = 0;
+
+    for (const Instruction& instruction : m_code) {
+        switch (instruction.op) {
+            case OP_PUSH:
+                stack[top++] = instruction.value;
+                break;
+            case OP_COUNT_MASK:
+                stack[top++] = static_cast<float>(std::popcount(context.enabled->word(instruction.a) & instruction.mask));
+                break;
+            case OP_COUNT_LIST: {
+                int count = 0;
+                for (int32_t i = 0; i < instruction.b; ++i) {
+                    count += context.enabled->test(m_ids[instruction.a + i]) ? 1 : 0;
+                }
+                stack[top++] = static_cast<float>(count);
+                break;
+            }
+            case OP_LEVEL:
+                stack[top++] = instruction.a >= 0 && static_cast<size_t>(instruction.a) < context.levels.size()
+                                   ? static_cast<float>(context.levels[instruction.a])
+                                   : 0.0f;
+                break;
+            case OP_ATTRIBUTE:
+                stack[top++] = context.attributes != nullptr ? context.attributes->get_value(m_attributes[instruction.a]) : 0.0f;
+                break;
+            case OP_NOT:
+                stack[top - 1] = stack[top - 1] != 0.0f ? 0.0f : 1.0f;
+                break;
+            default: {
+                const float rhs = stack[--top];
+                const float lhs = stack[top - 1];
+                bool result = false;
+                switch (instruction.op) {
+                    case OP_AND:           result = lhs != 0.0f && rhs != 0.0f; break;
+                    case OP_OR:            result = lhs != 0.0f || rhs != 0.0f; break;
+                    case OP_LESS:          result = lhs < rhs;  break;
+                    case OP_LESS_EQUAL:    result = lhs <= rhs; break;
+                    case OP_GREATER:       result = lhs > rhs;  break;
+                    case OP_GREATER_EQUAL: result = lhs >= rhs; break;
+                    case OP_EQUAL:         result = lhs == rhs; break;
+                    case OP_NOT_EQUAL:     result = lhs != rhs; break;
+                    default: break;
+                }
+                stack[top - 1] = result ? 1.0f : 0.0f;
+                break;
+            }
+        }
+    }
+    return top > 0 && stack[top - 1] != 0.0f;
+}
+
+} // namespace Rebel::Ability
@@ -0,0 +1,514 @@
+// Copyright (c) 2026, and future.
+// Alejandro Morcillo Montejo - All Rights Reserved
+
+#include "Rebel/Ability/AbilityDatabase.hpp"
+
+#include "Rebel/Ability/AbilityImprovement.hpp"
+#include "Rebel/Ability/AbilityNode.hpp"
+
+#include <godot_cpp/classes/resource_loader.hpp>
+#include <godot_cpp/classes/texture2d.hpp>
+#include <godot_cpp/core/class_db.hpp>
+#include <godot_cpp/variant/utility_functions.hpp>
+
+#include <cstring>
+#include <string>
+
+using namespace godot;
+
+namespace Rebel::Ability {
+
+namespace {
+
+// ---------------------------------------------------------------------------
+// Blob layout
+//
+//   Header        32 bytes
+//   SectionEntry  16 bytes x section_count
+//   Sections      each aligned to SECTION_ALIGNMENT, POD records
+//   Strings       UTF-8 bytes referenced by StringRef {offset, length}
+// ---------------------------------------------------------------------------
+
+constexpr char MAGIC[4] = {'R', 'A', 'D', 'B'};
+constexpr uint64_t SECTION_ALIGNMENT = 16;
+
+enum SectionKind : uint32_t {
+    SECTION_ABILITIES = 1,
+    SECTION_IMPROVEMENTS = 2,
+    SECTION_NODES = 3,
+    SECTION_PREREQUISITES = 4,
+    SECTION_STRINGS = 5,
+    SECTION_COUNT = 5,
+};
+
+struct Header {
+    char magic[4];
+    uint32_t format_version;
+    uint32_t section_count;
+    uint32_t reserved;
+    uint64_t reserved_64;
+    uint64_t total_size;
+};
+static_assert(sizeof(Header) == 32);
+
+struct SectionEntry {
+    uint32_t kind;
+    uint32_t count;
+    uint64_t offset;
+};
+static_assert(sizeof(SectionEntry) == 16);
+
+constexpr uint64_t align_up(const uint64_t value) {
+    return (value + SECTION_ALIGNMENT - 1) & ~(SECTION_ALIGNMENT - 1);
+}
+
+template <typename T>
+std::span<const T> view_section(const PackedByteArray& blob, const SectionEntry& entry) {
+    return {reinterpret_cast<const T*>(blob.ptr() + entry.offset), entry.count};
+}
+
+/** Accumulates the string table while packing. */
+struct StringTable {
+    std::string bytes{};
+
+    AbilityDatabase::StringRef add(const String& value) {
+        const CharString utf8 = value.utf8();
+        const AbilityDatabase::StringRef ref{static_cast<uint32_t>(bytes.size()), static_cast<uint32_t>(utf8.length())};
+        bytes.append(utf8.get_data(), utf8.length());
+        return ref;
+    }
+};
+
+/** Returns the path @p icon can be reloaded from, or an empty string if it only exists embedded. */
+String get_icon_path(const Ref<Texture2D>& icon, const String& owner) {
+    if (icon.is_null()) {
+        return {};
+    }
+    const String path = icon->get_path();
+    if (path.is_empty() || path.contains("::")) {
+        UtilityFunctions::push_warning("[AbilityDatabase] '", owner,
+                                       "' uses an embedded icon; save it as its own resource to keep it in the database.");
+        return {};
+    }
+    return path;
+}
+
+Ref<Texture2D> load_icon(const String& path) {
+    if (path.is_empty()) {
+        return {};
+    }
+    return ResourceLoader::get_singleton()->load(path, "Texture2D");
+}
+
+bool ref_in_range(const AbilityDatabase::StringRef& ref, const size_t size) {
+    return static_cast<uint64_t>(ref.offset) + ref.length <= size;
+}
+
+} // namespace
+
+// ---------------------------------------------------------------------------
+// _bind_methods
+// ---------------------------------------------------------------------------
+
+void AbilityDatabase::_bind_methods() {
+    ClassDB::bind_static_method("AbilityDatabase", D_METHOD("from_bytes", "bytes"), &AbilityDatabase::from_bytes);
+    ClassDB::bind_static_method("AbilityDatabase", D_METHOD("from_tree", "tree"), &AbilityDatabase::from_tree);
+
+    // --- abilities ---
+    ClassDB::bind_method(D_METHOD("get_ability_count"), &AbilityDatabase::get_ability_count);
+    ClassDB::bind_method(D_METHOD("get_ability_id", "index"), &AbilityDatabase::get_ability_id);
+    ClassDB::bind_method(D_METHOD("get_ability_name", "index"), &AbilityDatabase::get_ability_name);
+    ClassDB::bind_method(D_METHOD("get_ability_cost", "index"), &AbilityDatabase::get_ability_cost);
+    ClassDB::bind_method(D_METHOD("get_ability", "index"), &AbilityDatabase::get_ability);
+    ClassDB::bind_method(D_METHOD("find_ability", "name"), &AbilityDatabase::find_ability);
+    ClassDB::bind_method(D_METHOD("get_materialized_count"), &AbilityDatabase::get_materialized_count);
+    ClassDB::bind_method(D_METHOD("release_ability", "index"), &AbilityDatabase::release_ability);
+
+    // --- nodes ---
+    ClassDB::bind_method(D_METHOD("get_node_count"), &AbilityDatabase::get_node_count);
+    ClassDB::bind_method(D_METHOD("get_node_ability", "node"), &AbilityDatabase::get_node_ability);
+    ClassDB::bind_method(D_METHOD("get_node_prerequisites", "node"), &AbilityDatabase::get_node_prerequisites);
+    ClassDB::bind_method(D_METHOD("get_node_condition", "node"), &AbilityDatabase::get_node_condition);
+    ClassDB::bind_method(D_METHOD("build_tree"), &AbilityDatabase::build_tree);
+
+    // --- serialization ---
+    ClassDB::bind_method(D_METHOD("get_bytes"), &AbilityDatabase::get_bytes);
+}
+
+// ---------------------------------------------------------------------------
+// Construction
+// ---------------------------------------------------------------------------
+
+Ref<AbilityDatabase> AbilityDatabase::from_bytes(const PackedByteArray& bytes) {
+    Ref<AbilityDatabase> database;
+    database.instantiate();
+    database->m_blob = bytes;
+    if (!database->fix_up()) {
+        return {};
+    }
+    return database;
+}
+
+Ref<AbilityDatabase> AbilityDatabase::from_tree(const Ref<AbilityTree>& tree) {
+    ERR_FAIL_COND_V(tree.is_null(), {});
+
+    const Array nodes = tree->get_nodes();
+
+    // Abilities in first-seen order; nodes reference them by index.
+    std::vector<Ref<Ability>> abilities{};
+    HashMap<uint64_t, int32_t> ability_index{};
+    HashMap<uint64_t, int32_t> node_index{};
+    for (int64_t i = 0; i < nodes.size(); ++i) {
+        const Ref<AbilityNode> node = nodes[i];
+        if (node.is_null()) {
+            continue;
+        }
+        node_index.insert(node->get_instance_id(), static_cast<int32_t>(i));
+        const Ref<Ability> ability = node->get_ability();
+        if (ability.is_valid() && !ability_index.has(ability->get_instance_id())) {
+            ability_index.insert(ability->get_instance_id(), static_cast<int32_t>(abilities.size()));
+            abilities.push_back(ability);
+        }
+    }
+
+    StringTable strings{};
+    std::vector<AbilityRecord> ability_records{};
+    std::vector<ImprovementRecord> improvement_records{};
+    ability_records.reserve(abilities.size());
+    for (const Ref<Ability>& ability : abilities) {
+        AbilityRecord record{};
+        record.id = strings.add(ability->get_registry_key());
+        record.name = strings.add(ability->get_name());
+        record.description = strings.add(ability->get_description());
+        record.icon_path = strings.add(get_icon_path(ability->get_icon(), ability->get_name()));
+        record.cost = ability->get_cost();
+        record.first_improvement = static_cast<uint32_t>(improvement_records.size());
+        // Only authored tiers are stored, mirroring Ability's sparse slots.
+        for (int level = 1; level <= Ability::IMPROVEMENT_COUNT; ++level) {
+            if (!ability->has_improvement(level)) {
+                continue;
+            }
+            const Ref<AbilityImprovement> improvement = ability->get_improvement(level);
+            ImprovementRecord tier{};
+            tier.description = strings.add(improvement->get_description());
+            tier.icon_path = strings.add(get_icon_path(improvement->get_icon(), ability->get_name()));
+            tier.cost = improvement->get_cost();
+            tier.level = level;
+            improvement_records.push_back(tier);
+        }
+        record.improvement_count = static_cast<uint32_t>(improvement_records.size()) - record.first_improvement;
+        ability_records.push_back(record);
+    }
+
+    std::vector<NodeRecord> node_records(static_cast<size_t>(nodes.size()), NodeRecord{-1, 0, 0, 0, {0, 0}});
+    std::vector<int32_t> prerequisites{};
+    for (int64_t i = 0; i < nodes.size(); ++i) {
+        const Ref<AbilityNode> node = nodes[i];
+        if (node.is_null()) {
+            continue;
+        }
+        NodeRecord& record = node_records[i];
+        const Ref<Ability> ability = node->get_ability();
+        if (ability.is_valid()) {
+            record.ability = ability_index[ability->get_instance_id()];
+        }
+        record.condition = strings.add(node->get_condition());
+        record.first_prerequisite = static_cast<uint32_t>(prerequisites.size());
+        const Array node_prerequisites = node->get_prerequisites();
+        for (int64_t p = 0; p < node_prerequisites.size(); ++p) {
+            const Ref<AbilityNode> prerequisite = node_prerequisites[p];
+            // Dangling prerequisites are dropped; the tree reports them on compile.
+            if (prerequisite.is_valid()) {
+                if (const int32_t* id = node_index.getptr(prerequisite->get_instance_id())) {
+                    prerequisites.push_back(*id);
+                }
+            }
+        }
+        record.prerequisite_count = static_cast<uint32_t>(prerequisites.size()) - record.first_prerequisite;
+    }
+
+    const uint32_t counts[SECTION_COUNT] = {
+        static_cast<uint32_t>(ability_records.size()),
+        static_cast<uint32_t>(improvement_records.size()),
+        static_cast<uint32_t>(node_records.size()),
+        static_cast<uint32_t>(prerequisites.size()),
+        static_cast<uint32_t>(strings.bytes.size()),
+    };
+    const uint64_t strides[SECTION_COUNT] = {
+        sizeof(AbilityRecord), sizeof(ImprovementRecord), sizeof(NodeRecord), sizeof(int32_t), sizeof(char),
+    };
+    const void* sources[SECTION_COUNT] = {
+        ability_records.data(), improvement_records.data(), node_records.data(), prerequisites.data(), strings.bytes.data(),
+    };
+
+    SectionEntry entries[SECTION_COUNT]{};
+    uint64_t cursor = align_up(sizeof(Header) + sizeof(SectionEntry) * SECTION_COUNT);
+    for (uint32_t i = 0; i < SECTION_COUNT; ++i) {
+        entries[i] = {i + 1, counts[i], cursor};
+        cursor = align_up(cursor + strides[i] * counts[i]);
+    }
+
+    PackedByteArray blob{};
+    blob.resize(static_cast<int64_t>(cursor));
+    uint8_t* base = blob.ptrw();
+    std::memset(base, 0, cursor);
+
+    Header header{};
+    std::memcpy(header.magic, MAGIC, sizeof(MAGIC));
+    header.format_version = FORMAT_VERSION;
+    header.section_count = SECTION_COUNT;
+    header.total_size = cursor;
+    std::memcpy(base, &header, sizeof(Header));
+    std::memcpy(base + sizeof(Header), entries, sizeof(entries));
+    for (uint32_t i = 0; i < SECTION_COUNT; ++i) {
+        if (counts[i] > 0) {
+            std::memcpy(base + entries[i].offset, sources[i], strides[i] * counts[i]);
+        }
+    }
+
+    return from_bytes(blob);
+}
+
+PackedByteArray AbilityDatabase::get_bytes() const {
+    return m_blob;
+}
+
+// ---------------------------------------------------------------------------
+// Abilities
+// ---------------------------------------------------------------------------
+
+int AbilityDatabase::get_ability_count() const {
+    return static_cast<int>(m_abilities.size());
+}
+
+String AbilityDatabase::get_ability_id(const int index) const {
+    ERR_FAIL_INDEX_V(index, get_ability_count(), {});
+    return read_string(m_abilities[index].id);
+}
+
+String AbilityDatabase::get_ability_name(const int index) const {
+    ERR_FAIL_INDEX_V(index, get_ability_count(), {});
+    return read_string(m_abilities[index].name);
+}
+
+float AbilityDatabase::get_ability_cost(const int index) const {
+    ERR_FAIL_INDEX_V(index, get_ability_count(), 0.0f);
+    return m_abilities[index].cost;
+}
+
+Ref<Ability> AbilityDatabase::get_ability(const int index) const {
+    ERR_FAIL_INDEX_V(index, get_ability_count(), {});
+    Ref<Ability>& slot = m_materialized[index];
+    if (slot.is_null()) {
+        slot = materialize(index);
+        ++m_materialized_count;
+    }
+    return slot;
+}
+
+int AbilityDatabase::find_ability(const String& name) const {
+    if (m_index_by_name.is_empty() && !m_abilities.empty()) {
+        for (size_t i = 0; i < m_abilities.size(); ++i) {
+            const String ability_name = read_string(m_abilities[i].name);
+            // First match wins, like a linear search would.
+            if (!m_index_by_name.has(ability_name)) {
+                m_index_by_name.insert(ability_name, static_cast<int32_t>(i));
+            }
+        }
+    }
+    const int32_t* found = m_index_by_name.getptr(name);
+    return found != nullptr ? *found : -1;
+}
+
+int AbilityDatabase::get_materialized_count() const {
+    return m_materialized_count;
+}
+
+void AbilityDatabase::release_ability(const int index) {
+    ERR_FAIL_INDEX(index, get_ability_count());
+    if (m_materialized[index].is_valid()) {
+        m_materialized[index].unref();
+        --m_materialized_count;
+    }
+}
+
+// ---------------------------------------------------------------------------
+// Nodes
+// ---------------------------------------------------------------------------
+
+int AbilityDatabase::get_node_count() const {
+    return static_cast<int>(m_nodes.size());
+}
+
+int AbilityDatabase::get_node_ability(const int node) const {
+    ERR_FAIL_INDEX_V(node, get_node_count(), -1);
+    return m_nodes[node].ability;
+}
+
+PackedInt32Array AbilityDatabase::get_node_prerequisites(const int node) const {
+    ERR_FAIL_INDEX_V(node, get_node_count(), {});
+    const NodeRecord& record = m_nodes[node];
+    PackedInt32Array result{};
+    result.resize(record.prerequisite_count);
+    std::memcpy(result.ptrw(), m_prerequisites.data() + record.first_prerequisite,
+                sizeof(int32_t) * record.prerequisite_count);
+    return result;
+}
+
+String AbilityDatabase::get_node_condition(const int node) const {
+    ERR_FAIL_INDEX_V(node, get_node_count(), {});
+    return read_string(m_nodes[node].condition);
+}
+
+Ref<AbilityTree> AbilityDatabase::build_tree() const {
+    Array nodes{};
+    nodes.resize(get_node_count());
+    for (int i = 0; i < get_node_count(); ++i) {
+        Ref<AbilityNode> node;
+        node.instantiate();
+        if (m_nodes[i].ability >= 0) {
+            node->set_ability(get_ability(m_nodes[i].ability));
+        }
+        node->set_condition(read_string(m_nodes[i].condition));
+        nodes[i] = node;
+    }
+
+    // Second pass: every node exists now, so prerequisites can point forward.
+    for (int i = 0; i < get_node_count(); ++i) {
+        const NodeRecord& record = m_nodes[i];
+        Array prerequisites{};
+        prerequisites.resize(record.prerequisite_count);
+        for (uint32_t p = 0; p < record.prerequisite_count; ++p) {
+            prerequisites[p] = nodes[m_prerequisites[record.first_prerequisite + p]];
+        }
+        const Ref<AbilityNode> node = nodes[i];
+        node->set_prerequisites(prerequisites);
+    }
+
+    Ref<AbilityTree> tree;
+    tree.instantiate();
+    tree->set_nodes(nodes);
+    return tree;
+}
+
+std::span<const AbilityDatabase::AbilityRecord> AbilityDatabase::abilities_view() const {
+    return m_abilities;
+}
+
+String AbilityDatabase::read_string(const StringRef& ref) const {
+    if (ref.length == 0 || !ref_in_range(ref, m_strings.size())) {
+        return {};
+    }
+    return String::utf8(m_strings.data() + ref.offset, static_cast<int>(ref.length));
+}
+
+// ---------------------------------------------------------------------------
+// Private helpers
+// ---------------------------------------------------------------------------
+
+bool AbilityDatabase::fix_up() {
+    const uint64_t size = static_cast<uint64_t>(m_blob.size());
+    if (size < sizeof(Header)) {
+        m_blob.clear();
+        return false;
+    }
+
+    Header header{};
+    std::memcpy(&header, m_blob.ptr(), sizeof(Header));
+    if (std::memcmp(header.magic, MAGIC, sizeof(MAGIC)) != 0 ||
+        header.format_version != FORMAT_VERSION ||
+        header.total_size != size ||
+        sizeof(Header) + sizeof(SectionEntry) * static_cast<uint64_t>(header.section_count) > size) {
+        m_blob.clear();
+        return false;
+    }
+
+    const auto* entries = reinterpret_cast<const SectionEntry*>(m_blob.ptr() + sizeof(Header));
+    for (uint32_t i = 0; i < header.section_count; ++i) {
+        const SectionEntry& entry = entries[i];
+        uint64_t stride = 0;
+        switch (entry.kind) {
+            case SECTION_ABILITIES:     stride = sizeof(AbilityRecord);     break;
+            case SECTION_IMPROVEMENTS:  stride = sizeof(ImprovementRecord); break;
+            case SECTION_NODES:         stride = sizeof(NodeRecord);        break;
+            case SECTION_PREREQUISITES: stride = sizeof(int32_t);           break;
+            case SECTION_STRINGS:       stride = sizeof(char);              break;
+            default: continue; // Unknown sections are skipped for forward compatibility.
+        }
+        // Division form: offset and count come from disk, and the sum could wrap.
+        if (entry.offset % SECTION_ALIGNMENT != 0 || entry.offset > size || entry.count > (size - entry.offset) / stride) {
+            // Sections viewed so far point into the blob being dropped.
+            m_blob.clear();
+            m_abilities = {};
+            m_improvements = {};
+            m_nodes = {};
+            m_prerequisites = {};
+            m_strings = {};
+            return false;
+        }
+
+        switch (entry.kind) {
+            case SECTION_ABILITIES:     m_abilities = view_section<AbilityRecord>(m_blob, entry); break;
+            case SECTION_IMPROVEMENTS:  m_improvements = view_section<ImprovementRecord>(m_blob, entry); break;
+            case SECTION_NODES:         m_nodes = view_section<NodeRecord>(m_blob, entry); break;
+            case SECTION_PREREQUISITES: m_prerequisites = view_section<int32_t>(m_blob, entry); break;
+            case SECTION_STRINGS:       m_strings = view_section<char>(m_blob, entry); break;
+            default: break;
+        }
+    }
+
+    // Cross-references are checked once here so the accessors can index freely.
+    bool valid = true;
+    for (const AbilityRecord& record : m_abilities) {
+        valid = valid && static_cast<uint64_t>(record.first_improvement) + record.improvement_count <= m_improvements.size();
+    }
+    for (const ImprovementRecord& record : m_improvements) {
+        valid = valid && record.level >= 1 && record.level <= Ability::IMPROVEMENT_COUNT;
+    }
+    for (const NodeRecord& record : m_nodes) {
+        valid = valid && record.ability >= -1 && record.ability < static_cast<int32_t>(m_abilities.size()) &&
+                static_cast<uint64_t>(record.first_prerequisite) + record.prerequisite_count <= m_prerequisites.size();
+    }
+    for (const int32_t prerequisite : m_prerequisites) {
+        valid = valid && prerequisite >= 0 && prerequisite < static_cast<int32_t>(m_nodes.size());
+    }
+    if (!valid) {
+        m_blob.clear();
+        m_abilities = {};
+        m_improvements = {};
+        m_nodes = {};
+        m_prerequisites = {};
+        m_strings = {};
+        return false;
+    }
+
+    m_materialized.assign(m_abilities.size(), Ref<Ability>());
+    m_materialized_count = 0;
+    m_index_by_name.clear();
+    return true;
+}
+
+Ref<Ability> AbilityDatabase::materialize(const int index) const {
+    const AbilityRecord& record = m_abilities[index];
+
+    Ref<Ability> ability;
+    ability.instantiate();
+    ability->set_id(read_string(record.id));
+    ability->set_name(read_string(record.name));
+    ability->set_description(read_string(record.description));
+    ability->set_icon(load_icon(read_string(record.icon_path)));
+    ability->set_cost(record.cost);
+
+    for (uint32_t i = 0; i < record.improvement_count; ++i) {
+        const ImprovementRecord& tier = m_improvements[record.first_improvement + i];
+        Ref<AbilityImprovement> improvement;
+        improvement.instantiate();
+        improvement->set_description(read_string(tier.description));
+        improvement->set_icon(load_icon(read_string(tier.icon_path)));
+        improvement->set_cost(tier.cost);
+        ability->set_improvement(tier.level, improvement);
+    }
+    return ability;
+}
+
+} // namespace Rebel::Ability
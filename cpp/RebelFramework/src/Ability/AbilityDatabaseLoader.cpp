@@ -0,0 +1,51 @@
+// Copyright (c) 2026, and future.
+// Alejandro Morcillo Montejo - All Rights Reserved
+
+#include "Rebel/Ability/AbilityDatabaseLoader.hpp"
+
+#include "Rebel/Ability/AbilityDatabase.hpp"
+
+#include <godot_cpp/classes/file_access.hpp>
+#include <godot_cpp/core/class_db.hpp>
+
+using namespace godot;
+
+namespace Rebel::Ability {
+
+// ---------------------------------------------------------------------------
+// _bind_methods
+// ---------------------------------------------------------------------------
+
+void AbilityDatabaseLoader::_bind_methods() {}
+
+// ---------------------------------------------------------------------------
+// ResourceFormatLoader overrides
+// ---------------------------------------------------------------------------
+
+PackedStringArray AbilityDatabaseLoader::_get_recognized_extensions() const {
+    PackedStringArray extensions{};
+    extensions.push_back(EXTENSION);
+    return extensions;
+}
+
+bool AbilityDatabaseLoader::_handles_type(const StringName& p_type) const {
+    return p_type == StringName("AbilityDatabase") || p_type == StringName("Resource");
+}
+
+String AbilityDatabaseLoader::_get_resource_type(const String& p_path) const {
+    return p_path.get_extension().to_lower() == EXTENSION ? String("AbilityDatabase") : String();
+}
+
+Variant AbilityDatabaseLoader::_load(const String& p_path, const String& p_original_path, const bool p_use_sub_threads, const int32_t p_cache_mode) const {
+    if (!FileAccess::file_exists(p_path)) {
+        return ERR_FILE_NOT_FOUND;
+    }
+    // One read; from_bytes() only validates the header and fixes up the views.
+    const Ref<AbilityDatabase> database = AbilityDatabase::from_bytes(FileAccess::get_file_as_bytes(p_path));
+    if (database.is_null()) {
+        return ERR_FILE_CORRUPT;
+    }
+    return database;
+}
+
+} // namespace Rebel::Ability
@@ -0,0 +1,50 @@
+// Copyright (c) 2026, and future.
+// Alejandro Morcillo Montejo - All Rights Reserved
+
+#include "Rebel/Ability/AbilityDatabaseSaver.hpp"
+
+#include "Rebel/Ability/AbilityDatabase.hpp"
+#include "Rebel/Ability/AbilityDatabaseLoader.hpp"
+
+#include <godot_cpp/classes/file_access.hpp>
+#include <godot_cpp/core/class_db.hpp>
+
+using namespace godot;
+
+namespace Rebel::Ability {
+
+// ---------------------------------------------------------------------------
+// _bind_methods
+// ---------------------------------------------------------------------------
+
+void AbilityDatabaseSaver::_bind_methods() {}
+
+// ---------------------------------------------------------------------------
+// ResourceFormatSaver overrides
+// ---------------------------------------------------------------------------
+
+Error AbilityDatabaseSaver::_save(const Ref<Resource>& p_resource, const String& p_path, const uint32_t p_flags) {
+    const Ref<AbilityDatabase> database(Object::cast_to<AbilityDatabase>(p_resource.ptr()));
+    ERR_FAIL_COND_V_MSG(database.is_null(), ERR_INVALID_PARAMETER, "[AbilityDatabaseSaver] Resource is not an AbilityDatabase.");
+
+    const Ref<FileAccess> file = FileAccess::open(p_path, FileAccess::WRITE);
+    if (file.is_null()) {
+        return FileAccess::get_open_error();
+    }
+    file->store_buffer(database->get_bytes());
+    return OK;
+}
+
+bool AbilityDatabaseSaver::_recognize(const Ref<Resource>& p_resource) const {
+    return Object::cast_to<AbilityDatabase>(p_resource.ptr()) != nullptr;
+}
+
+PackedStringArray AbilityDatabaseSaver::_get_recognized_extensions(const Ref<Resource>& p_resource) const {
+    PackedStringArray extensions{};
+    if (_recognize(p_resource)) {
+        extensions.push_back(AbilityDatabaseLoader::EXTENSION);
+    }
+    return extensions;
+}
+
+} // namespace Rebel::Ability
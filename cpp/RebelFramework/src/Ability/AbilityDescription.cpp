@@ -0,0 +1,216 @@
+// Copyright (c) 2026, and future.
+// Alejandro Morcillo Montejo - All Rights Reserved
+
+#include "Rebel/Ability/AbilityDescription.hpp"
+
+#include "Rebel/Attribute/AttributeSet.hpp"
+
+#include <godot_cpp/variant/packed_float32_array.hpp>
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <limits>
+
+using namespace godot;
+
+namespace Rebel::Ability {
+
+namespace {
+
+const StringName LEVEL_NAME = "level";
+
+bool is_name_char(const char32_t c) {
+    return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') || c == '_';
+}
+
+} // namespace
+
+// ---------------------------------------------------------------------------
+// Source
+// ---------------------------------------------------------------------------
+
+void AbilityDescription::set_source(const String& source) {
+    if (source == m_source && m_parsed) {
+        return;
+    }
+    m_source = source;
+    m_parsed = false;
+    m_memo.clear();
+}
+
+bool AbilityDescription::has_placeholders() {
+    parse();
+    return std::any_of(m_segments.begin(), m_segments.end(), [](const Segment& segment) {
+        return segment.kind != SEGMENT_TEXT;
+    });
+}
+
+const std::vector<StringName>& AbilityDescription::get_attributes() {
+    parse();
+    return m_attributes;
+}
+
+// ---------------------------------------------------------------------------
+// Parse
+// ---------------------------------------------------------------------------
+
+void AbilityDescription::parse() {
+    if (m_parsed) {
+        return;
+    }
+    m_parsed = true;
+    m_segments.clear();
+    m_attributes.clear();
+
+    String literal{};
+    const auto flush_literal = [&]() {
+        if (!literal.is_empty()) {
+            m_segments.push_back({SEGMENT_TEXT, -1, -1, literal, {}});
+            literal = String();
+        }
+    };
+
+    const int64_t length = m_source.length();
+    int64_t i = 0;
+    while (i < length) {
+        const char32_t c = m_source[i];
+        if ((c == '{' || c == '}') && i + 1 < length && m_source[i + 1] == c) {
+            literal += String::chr(c);
+            i += 2;
+            continue;
+        }
+        if (c != '{') {
+            literal += String::chr(c);
+            ++i;
+            continue;
+        }
+
+        // {name} or {name:N}; anything else stays literal text.
+        int64_t end = i + 1;
+        while (end < length && is_name_char(m_source[end])) {
+            ++end;
+        }
+        const int64_t name_end = end;
+        int decimals = -1;
+        if (end < length && m_source[end] == ':' && end + 1 < length && m_source[end + 1] >= '0' && m_source[end + 1] <= '9') {
+            decimals = static_cast<int>(m_source[end + 1] - '0');
+            end += 2;
+        }
+        if (name_end == i + 1 || end >= length || m_source[end] != '}') {
+            literal += String::chr(c);
+            ++i;
+            continue;
+        }
+
+        flush_literal();
+        Segment segment{};
+        segment.text = m_source.substr(i, end + 1 - i);
+        segment.name = StringName(m_source.substr(i + 1, name_end - i - 1));
+        segment.decimals = static_cast<int8_t>(decimals);
+        if (segment.name == LEVEL_NAME) {
+            segment.kind = SEGMENT_LEVEL;
+        } else {
+            segment.kind = SEGMENT_ATTRIBUTE;
+            const auto found = std::find(m_attributes.begin(), m_attributes.end(), segment.name);
+            segment.input = static_cast<int32_t>(found - m_attributes.begin());
+            if (found == m_attributes.end()) {
+                m_attributes.push_back(segment.name);
+            }
+        }
+        m_segments.push_back(std::move(segment));
+        i = end + 1;
+    }
+    flush_literal();
+
+    // One input per attribute, plus the level.
+    m_inputs.assign(m_attributes.size() + 1, 0);
+}
+
+// ---------------------------------------------------------------------------
+// Render
+// ---------------------------------------------------------------------------
+
+String AbilityDescription::render(Attribute::AttributeSet* attributes, const int level) {
+    parse();
+    if (m_segments.empty()) {
+        return {};
+    }
+    if (m_segments.size() == 1 && m_segments[0].kind == SEGMENT_TEXT) {
+        return m_segments[0].text;
+    }
+
+    // Gather the inputs, then look for this attribute set's last render.
+    const uint64_t attributes_id = attributes != nullptr ? attributes->get_instance_id() : 0;
+    const PackedFloat32Array values = attributes != nullptr ? attributes->get_values() : PackedFloat32Array();
+    for (size_t input = 0; input < m_attributes.size(); ++input) {
+        const int index = attributes != nullptr ? attributes->get_attribute_index(m_attributes[input]) : -1;
+        const float value = index >= 0 && index < values.size() ? values[index] : std::numeric_limits<float>::quiet_NaN();
+        m_inputs[input] = std::bit_cast<uint32_t>(value);
+    }
+    m_inputs.back() = static_cast<uint32_t>(level);
+
+    auto entry = std::find_if(m_memo.begin(), m_memo.end(), [attributes_id](const MemoEntry& candidate) {
+        return candidate.attributes_id == attributes_id;
+    });
+    if (entry == m_memo.end()) {
+        if (m_memo.size() < MEMO_SIZE) {
+            m_memo.emplace_back();
+        }
+        entry = m_memo.end() - 1;
+        entry->attributes_id = attributes_id;
+        entry->inputs.clear();
+    }
+    // Move it to the front; the back is the next one replaced.
+    std::rotate(m_memo.begin(), entry, entry + 1);
+    MemoEntry& memo = m_memo.front();
+    if (memo.inputs == m_inputs) {
+        return memo.rendered;
+    }
+
+    String rendered{};
+    for (const Segment& segment : m_segments) {
+        switch (segment.kind) {
+            case SEGMENT_TEXT:
+                rendered += segment.text;
+                break;
+            case SEGMENT_LEVEL:
+                rendered += format_number(static_cast<float>(level), segment.decimals);
+                break;
+            case SEGMENT_ATTRIBUTE: {
+                const auto value = std::bit_cast<float>(m_inputs[segment.input]);
+                rendered += std::isnan(value) ? segment.text : format_number(value, segment.decimals);
+                break;
+            }
+        }
+    }
+
+    memo.inputs = m_inputs;
+    memo.rendered = rendered;
+    return memo.rendered;
+}
+
+String AbilityDescription::format_number(const float value, const int decimals) {
+    if (decimals < 0) {
+        // Only whole numbers that fit take the integer path; casting inf, NaN
+        // or anything past int64 is undefined.
+        constexpr float INT64_LIMIT = 9.2233720e18f;
+        const bool whole = std::isfinite(value) && value == std::floor(value) && std::fabs(value) < INT64_LIMIT;
+        return whole ? String::num_int64(static_cast<int64_t>(value)) : String::num(value, 2);
+    }
+    // String::num() trims trailing zeros; put them back for a fixed width.
+    String text = String::num(value, decimals);
+    if (decimals > 0 && std::isfinite(value)) {
+        const int64_t dot = text.find(".");
+        const int64_t have = dot < 0 ? 0 : text.length() - dot - 1;
+        if (dot < 0) {
+            text += ".";
+        }
+        for (int64_t pad = have; pad < decimals; ++pad) {
+            text += "0";
+        }
+    }
+    return text;
+}
+
+} // namespace Rebel::Ability
@@ -0,0 +1,298 @@
+// Copyright (c) 2026, and future.
+// Alejandro Morcillo Montejo - All Rights Reserved
+
+#include "Rebel/Ability/AbilityGraph.hpp"
+#include "Rebel/Ability/AbilityNode.hpp"
+
+using namespace godot;
+
+namespace Rebel::Ability {
+
+namespace {
+
+/** Human-readable label for error messages. */
+String describe(const Array& nodes, const int32_t id) {
+    const Ref<AbilityNode> node = nodes[id];
+    if (node.is_valid() && node->get_ability().is_valid() && !node->get_ability()->get_name().is_empty()) {
+        return vformat("'%s' (#%d)", node->get_ability()->get_name(), id);
+    }
+    return vformat("#%d", id);
+}
+
+} // namespace
+
+// ---------------------------------------------------------------------------
+// AbilityGraph
+// ---------------------------------------------------------------------------
+
+void AbilityGraph::build(const Array& nodes) {
+    m_size = static_cast<int32_t>(nodes.size());
+
+    m_errors.clear();
+    m_ids_by_node.clear();
+    m_ids_by_ability.clear();
+    m_valid.resize(m_size);
+    for (int32_t id = 0; id < m_size; ++id) {
+        const Ref<AbilityNode> node = nodes[id];
+        if (node.is_null()) {
+            // Empty slots are normal while the array is being edited.
+            continue;
+        }
+        if (const int32_t* first = m_ids_by_node.getptr(node->get_instance_id())) {
+            m_errors.push_back(vformat("Node %s is listed twice (first as #%d).", describe(nodes, id), *first));
+            continue;
+        }
+        m_ids_by_node.insert(node->get_instance_id(), id);
+        m_valid.set(id);
+
+        const Ref<Ability> ability = node->get_ability();
+        if (ability.is_null()) {
+            m_errors.push_back(vformat("Node %s has no ability.", describe(nodes, id)));
+            continue;
+        }
+        if (const int32_t* first = m_ids_by_ability.getptr(ability->get_instance_id())) {
+            m_errors.push_back(vformat("Node %s wraps the same ability as #%d.", describe(nodes, id), *first));
+            continue;
+        }
+        m_ids_by_ability.insert(ability->get_instance_id(), id);
+    }
+
+    // Prerequisites, resolved to ids.
+    m_prerequisite_offsets.assign(m_size + 1, 0);
+    m_prerequisite_ids.clear();
+    m_unresolved.assign(m_size, 0);
+    std::vector<int32_t> out_degree(m_size, 0);
+    for (int32_t id = 0; id < m_size; ++id) {
+        m_prerequisite_offsets[id] = static_cast<int32_t>(m_prerequisite_ids.size());
+        const Ref<AbilityNode> node = nodes[id];
+        if (node.is_null()) {
+            continue;
+        }
+        const Array prerequisites = node->get_prerequisites();
+        for (int i = 0; i < prerequisites.size(); ++i) {
+            const Ref<AbilityNode> prerequisite = prerequisites[i];
+            const int32_t prerequisite_id = find_node(prerequisite.ptr());
+            if (prerequisite_id < 0) {
+                ++m_unresolved[id];
+                m_errors.push_back(prerequisite.is_null()
+                    ? vformat("Node %s has a null prerequisite.", describe(nodes, id))
+                    : vformat("Node %s requires a node that is not part of the tree.", describe(nodes, id)));
+                continue;
+            }
+            m_prerequisite_ids.push_back(prerequisite_id);
+            ++out_degree[prerequisite_id];
+        }
+    }
+    m_prerequisite_offsets[m_size] = static_cast<int32_t>(m_prerequisite_ids.size());
+
+    // Dependents: the same edges, inverted.
+    m_dependent_offsets.assign(m_size + 1, 0);
+    for (int32_t id = 0; id < m_size; ++id) {
+        m_dependent_offsets[id + 1] = m_dependent_offsets[id] + out_degree[id];
+    }
+    m_dependent_ids.assign(m_prerequisite_ids.size(), 0);
+    std::vector<int32_t> cursor(m_dependent_offsets.begin(), m_dependent_offsets.end() - 1);
+    for (int32_t id = 0; id < m_size; ++id) {
+        for (const int32_t prerequisite_id : prerequisites(id)) {
+            m_dependent_ids[cursor[prerequisite_id]++] = id;
+        }
+    }
+
+    compute_layers(nodes);
+    compile_conditions(nodes);
+}
+
+void AbilityGraph::compute_layers(const Array& nodes) {
+    m_roots.clear();
+    m_depths.assign(m_size, -1);
+
+    // Kahn's algorithm over resolved edges; depth = 1 + deepest prerequisite.
+    std::vector<int32_t> pending(m_size, 0);
+    std::vector<int32_t> queue{};
+    queue.reserve(m_size);
+    for (int32_t id = 0; id < m_size; ++id) {
+        const Ref<AbilityNode> node = nodes[id];
+        if (node.is_null() || find_node(node.ptr()) != id) {
+            continue; // null or duplicate entry
+        }
+        pending[id] = static_cast<int32_t>(prerequisites(id).size());
+        if (pending[id] == 0) {
+            m_depths[id] = 0;
+            queue.push_back(id);
+            if (m_unresolved[id] == 0) {
+                m_roots.push_back(id);
+            }
+        }
+    }
+    int32_t max_depth = queue.empty() ? -1 : 0;
+    for (size_t head = 0; head < queue.size(); ++head) {
+        const int32_t current = queue[head];
+        for (const int32_t dependent : dependents(current)) {
+            m_depths[dependent] = Math::max(m_depths[dependent], m_depths[current] + 1);
+            if (--pending[dependent] == 0) {
+                max_depth = Math::max(max_depth, m_depths[dependent]);
+                queue.push_back(dependent);
+            }
+        }
+    }
+
+    // Anything still waiting on a prerequisite sits on (or behind) a cycle.
+    for (int32_t id = 0; id < m_size; ++id) {
+        if (pending[id] > 0) {
+            m_depths[id] = -1;
+            m_errors.push_back(vformat("Node %s is part of, or depends on, a prerequisite cycle.", describe(nodes, id)));
+        }
+    }
+
+    // Group by depth, keeping node-list order inside each layer.
+    m_layer_offsets.assign(max_depth + 2, 0);
+    for (int32_t id = 0; id < m_size; ++id) {
+        if (m_depths[id] >= 0) {
+            ++m_layer_offsets[m_depths[id] + 1];
+        }
+    }
+    for (int32_t layer = 0; layer <= max_depth; ++layer) {
+        m_layer_offsets[layer + 1] += m_layer_offsets[layer];
+    }
+    m_layer_ids.assign(m_layer_offsets.back(), 0);
+    std::vector<int32_t> cursor(m_layer_offsets.begin(), m_layer_offsets.end() - 1);
+    for (int32_t id = 0; id < m_size; ++id) {
+        if (m_depths[id] >= 0) {
+            m_layer_ids[cursor[m_depths[id]]++] = id;
+        }
+    }
+}
+
+void AbilityGraph::compile_conditions(const Array& nodes) {
+    m_conditions.clear();
+    m_condition_index.assign(m_size, -1);
+    m_conditional_ids.clear();
+    m_attribute_conditional_ids.clear();
+
+    std::vector<AbilityCondition::PrerequisiteRef> refs{};
+    for (int32_t id = 0; id < m_size; ++id) {
+        const Ref<AbilityNode> node = nodes[id];
+        if (node.is_null() || find_node(node.ptr()) != id || node->get_condition().strip_edges().is_empty()) {
+            continue;
+        }
+
+        // Refs follow the authored prerequisite order, unresolved ones included.
+        refs.clear();
+        const Array prerequisites = node->get_prerequisites();
+        for (int i = 0; i < prerequisites.size(); ++i) {
+            const Ref<AbilityNode> prerequisite = prerequisites[i];
+            AbilityCondition::PrerequisiteRef ref{};
+            ref.id = find_node(prerequisite.ptr());
+            if (prerequisite.is_valid() && prerequisite->get_ability().is_valid()) {
+                ref.key = prerequisite->get_ability()->get_registry_key();
+                ref.name = prerequisite->get_ability()->get_name();
+            }
+            refs.push_back(ref);
+        }
+
+        AbilityCondition condition{};
+        String error{};
+        if (!condition.compile(node->get_condition(), refs, error)) {
+            m_errors.push_back(vformat("Node %s has an invalid condition (%s).", describe(nodes, id), error));
+        }
+        m_condition_index[id] = static_cast<int32_t>(m_conditions.size());
+        m_conditional_ids.push_back(id);
+        if (condition.reads_attributes()) {
+            m_attribute_conditional_ids.push_back(id);
+        }
+        m_conditions.push_back(std::move(condition));
+    }
+}
+
+int32_t AbilityGraph::find_node(const AbilityNode* node) const {
+    if (node == nullptr) {
+        return -1;
+    }
+    const int32_t* id = m_ids_by_node.getptr(node->get_instance_id());
+    return id != nullptr ? *id : -1;
+}
+
+int32_t AbilityGraph::find_ability(const Ability* ability) const {
+    if (ability == nullptr) {
+        return -1;
+    }
+    const int32_t* id = m_ids_by_ability.getptr(ability->get_instance_id());
+    return id != nullptr ? *id : -1;
+}
+
+// ---------------------------------------------------------------------------
+// AbilityUnlockState
+// ---------------------------------------------------------------------------
+
+void AbilityUnlockState::reset(const AbilityGraph& graph) {
+    const int32_t size = graph.size();
+    enabled.resize(size);
+    unlockable.resize(size);
+    missing.assign(size, 0);
+    for (int32_t id = 0; id < size; ++id) {
+        missing[id] = static_cast<int32_t>(graph.prerequisites(id).size()) + graph.get_unresolved_count(id);
+        if (missing[id] == 0 && graph.get_condition(id) == nullptr && graph.is_valid(id)) {
+            unlockable.set(id);
+        }
+    }
+}
+
+void AbilityUnlockState::enable(const AbilityGraph& graph, const int32_t id, const AbilityConditionContext* context) {
+    if (enabled.test(id)) {
+        return;
+    }
+    enabled.set(id);
+    unlockable.reset(id);
+    for (const int32_t dependent : graph.dependents(id)) {
+        --missing[dependent];
+        if (graph.get_condition(dependent) != nullptr) {
+            if (context != nullptr) {
+                refresh(graph, dependent, *context);
+            }
+        } else if (missing[dependent] == 0 && !enabled.test(dependent) && graph.is_valid(dependent)) {
+            unlockable.set(dependent);
+        }
+    }
+}
+
+void AbilityUnlockState::disable(const AbilityGraph& graph, const int32_t id, const AbilityConditionContext& context) {
+    if (!enabled.test(id)) {
+        return;
+    }
+    enabled.reset(id);
+    for (const int32_t dependent : graph.dependents(id)) {
+        ++missing[dependent];
+        if (!enabled.test(dependent)) {
+            refresh(graph, dependent, context);
+        }
+    }
+    refresh(graph, id, context);
+}
+
+bool AbilityUnlockState::holds(const AbilityGraph& graph, const int32_t id, const AbilityConditionContext& context) const {
+    const AbilityCondition* condition = graph.get_condition(id);
+    return condition != nullptr ? condition->evaluate(context) : missing[id] == 0;
+}
+
+bool AbilityUnlockState::refresh(const AbilityGraph& graph, const int32_t id, const AbilityConditionContext& context) {
+    const bool result = !enabled.test(id) && graph.is_valid(id) && holds(graph, id, context);
+    if (result == unlockable.test(id)) {
+        return false;
+    }
+    if (result) {
+        unlockable.set(id);
+    } else {
+        unlockable.reset(id);
+    }
+    return true;
+}
+
+bool AbilityUnlockState::refresh(const AbilityGraph& graph, const std::span<const int32_t> ids, const AbilityConditionContext& context) {
+    bool changed = false;
+    for (const int32_t id : ids) {
+        changed = refresh(graph, id, context) || changed;
+    }
+    return changed;
+}
+
+} // namespace Rebel::Ability
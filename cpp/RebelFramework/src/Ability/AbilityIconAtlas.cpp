@@ -0,0 +1,124 @@
+// Copyright (c) 2026, and future.
+// Alejandro Morcillo Montejo - All Rights Reserved
+
+#include "Rebel/Ability/AbilityIconAtlas.hpp"
+
+#include <godot_cpp/core/class_db.hpp>
+
+using namespace godot;
+
+namespace Rebel::Ability {
+
+void AbilityIconAtlas::_bind_methods() {
+    // --- lookup ---
+    ClassDB::bind_method(D_METHOD("get_icon", "ability", "level"), &AbilityIconAtlas::get_icon, DEFVAL(0));
+    ClassDB::bind_method(D_METHOD("get_icon_by_id", "ability_id", "level"), &AbilityIconAtlas::get_icon_by_id, DEFVAL(0));
+    ClassDB::bind_method(D_METHOD("has_ability", "ability_id"), &AbilityIconAtlas::has_ability);
+    ClassDB::bind_method(D_METHOD("get_ability_count"), &AbilityIconAtlas::get_ability_count);
+
+    // --- storage ---
+    ClassDB::bind_method(D_METHOD("set_texture", "texture"), &AbilityIconAtlas::set_texture);
+    ClassDB::bind_method(D_METHOD("get_texture"), &AbilityIconAtlas::get_texture);
+    ClassDB::bind_method(D_METHOD("set_icons", "icons"), &AbilityIconAtlas::set_icons);
+    ClassDB::bind_method(D_METHOD("get_icons"), &AbilityIconAtlas::get_icons);
+    ClassDB::bind_method(D_METHOD("set_ids", "ids"), &AbilityIconAtlas::set_ids);
+    ClassDB::bind_method(D_METHOD("get_ids"), &AbilityIconAtlas::get_ids);
+    ClassDB::bind_method(D_METHOD("set_slots", "slots"), &AbilityIconAtlas::set_slots);
+    ClassDB::bind_method(D_METHOD("get_slots"), &AbilityIconAtlas::get_slots);
+
+    ADD_GROUP("AbilityIconAtlas", "");
+    ADD_PROPERTY(PropertyInfo(Variant::OBJECT,             "texture", PROPERTY_HINT_RESOURCE_TYPE, "Texture2D"),    "set_texture", "get_texture");
+    ADD_PROPERTY(PropertyInfo(Variant::ARRAY,              "icons",   PROPERTY_HINT_ARRAY_TYPE,    "AtlasTexture"), "set_icons",   "get_icons");
+    ADD_PROPERTY(PropertyInfo(Variant::PACKED_INT64_ARRAY, "ids"),                                                 "set_ids",     "get_ids");
+    ADD_PROPERTY(PropertyInfo(Variant::PACKED_INT32_ARRAY, "slots"),                                               "set_slots",   "get_slots");
+}
+
+// ---------------------------------------------------------------------------
+// Lookup
+// ---------------------------------------------------------------------------
+
+Ref<AtlasTexture> AbilityIconAtlas::get_icon(const Ref<Ability>& ability, const int level) const {
+    if (ability.is_null()) {
+        return {};
+    }
+    return get_icon_by_id(ability->get_registry_id(), level);
+}
+
+Ref<AtlasTexture> AbilityIconAtlas::get_icon_by_id(const int64_t ability_id, const int level) const {
+    if (level < 0 || level >= SLOTS_PER_ABILITY) {
+        return {};
+    }
+    const int32_t row = find_row(ability_id);
+    if (row < 0) {
+        return {};
+    }
+    const int64_t slot = static_cast<int64_t>(row) * SLOTS_PER_ABILITY + level;
+    if (slot >= m_slots.size()) {
+        return {};
+    }
+    const int32_t icon = m_slots[slot];
+    return icon >= 0 && icon < m_icons.size() ? Ref<AtlasTexture>(m_icons[icon]) : Ref<AtlasTexture>();
+}
+
+bool AbilityIconAtlas::has_ability(const int64_t ability_id) const {
+    return find_row(ability_id) >= 0;
+}
+
+int32_t AbilityIconAtlas::find_row(const int64_t ability_id) const {
+    if (!m_rows_valid) {
+        m_rows.clear();
+        for (int32_t row = 0; row < m_ids.size(); ++row) {
+            m_rows.insert(m_ids[row], row);
+        }
+        m_rows_valid = true;
+    }
+    const int32_t* row = m_rows.getptr(ability_id);
+    return row != nullptr ? *row : -1;
+}
+
+int AbilityIconAtlas::get_ability_count() const {
+    return static_cast<int>(m_ids.size());
+}
+
+// ---------------------------------------------------------------------------
+// Storage
+// ---------------------------------------------------------------------------
+
+void AbilityIconAtlas::set_texture(const Ref<Texture2D>& texture) {
+    m_texture = texture;
+    emit_changed();
+}
+
+Ref<Texture2D> AbilityIconAtlas::get_texture() const {
+    return m_texture;
+}
+
+void AbilityIconAtlas::set_icons(const Array& icons) {
+    m_icons = icons;
+    emit_changed();
+}
+
+Array AbilityIconAtlas::get_icons() const {
+    return m_icons;
+}
+
+void AbilityIconAtlas::set_ids(const PackedInt64Array& ids) {
+    m_ids = ids;
+    m_rows_valid = false;
+    emit_changed();
+}
+
+PackedInt64Array AbilityIconAtlas::get_ids() const {
+    return m_ids;
+}
+
+void AbilityIconAtlas::set_slots(const PackedInt32Array& slots) {
+    m_slots = slots;
+    emit_changed();
+}
+
+PackedInt32Array AbilityIconAtlas::get_slots() const {
+    return m_slots;
+}
+
+} // namespace Rebel::Ability
@@ -0,0 +1,259 @@
+// Copyright (c) 2026, and future.
+// Alejandro Morcillo Montejo - All Rights Reserved
+
+#include "Rebel/Ability/AbilityIconAtlasBaker.hpp"
+
+#include "Rebel/Ability/AbilityImprovement.hpp"
+#include "Rebel/Ability/AbilityNode.hpp"
+
+#include <godot_cpp/classes/image.hpp>
+#include <godot_cpp/classes/image_texture.hpp>
+#include <godot_cpp/core/class_db.hpp>
+#include <godot_cpp/templates/hash_map.hpp>
+#include <godot_cpp/templates/hash_set.hpp>
+#include <godot_cpp/variant/utility_functions.hpp>
+
+#include <algorithm>
+#include <vector>
+
+using namespace godot;
+
+namespace Rebel::Ability {
+
+namespace {
+
+/** One unique source texture and where it lands in the page. */
+struct PackedIcon {
+    Ref<Texture2D> texture;
+    Ref<Image> image;
+    Vector2i position;
+};
+
+} // namespace
+
+// ---------------------------------------------------------------------------
+// _bind_methods
+// ---------------------------------------------------------------------------
+
+void AbilityIconAtlasBaker::_bind_methods() {
+    ClassDB::bind_method(D_METHOD("bake", "tree"), &AbilityIconAtlasBaker::bake);
+    ClassDB::bind_method(D_METHOD("bake_abilities", "abilities"), &AbilityIconAtlasBaker::bake_abilities);
+
+    ClassDB::bind_method(D_METHOD("set_icon_size", "size"), &AbilityIconAtlasBaker::set_icon_size);
+    ClassDB::bind_method(D_METHOD("get_icon_size"), &AbilityIconAtlasBaker::get_icon_size);
+    ClassDB::bind_method(D_METHOD("set_padding", "padding"), &AbilityIconAtlasBaker::set_padding);
+    ClassDB::bind_method(D_METHOD("get_padding"), &AbilityIconAtlasBaker::get_padding);
+    ClassDB::bind_method(D_METHOD("set_max_width", "width"), &AbilityIconAtlasBaker::set_max_width);
+    ClassDB::bind_method(D_METHOD("get_max_width"), &AbilityIconAtlasBaker::get_max_width);
+    ClassDB::bind_method(D_METHOD("set_generate_mipmaps", "enabled"), &AbilityIconAtlasBaker::set_generate_mipmaps);
+    ClassDB::bind_method(D_METHOD("get_generate_mipmaps"), &AbilityIconAtlasBaker::get_generate_mipmaps);
+
+    ClassDB::bind_method(D_METHOD("get_last_icon_count"), &AbilityIconAtlasBaker::get_last_icon_count);
+    ClassDB::bind_method(D_METHOD("get_last_atlas_size"), &AbilityIconAtlasBaker::get_last_atlas_size);
+
+    ADD_PROPERTY(PropertyInfo(Variant::VECTOR2I, "icon_size"),                                         "set_icon_size",        "get_icon_size");
+    ADD_PROPERTY(PropertyInfo(Variant::INT,      "padding",   PROPERTY_HINT_RANGE, "0,16,1"),          "set_padding",          "get_padding");
+    ADD_PROPERTY(PropertyInfo(Variant::INT,      "max_width", PROPERTY_HINT_RANGE, "64,16384,1"),      "set_max_width",        "get_max_width");
+    ADD_PROPERTY(PropertyInfo(Variant::BOOL,     "generate_mipmaps"),                                  "set_generate_mipmaps", "get_generate_mipmaps");
+}
+
+// ---------------------------------------------------------------------------
+// Bake
+// ---------------------------------------------------------------------------
+
+Ref<AbilityIconAtlas> AbilityIconAtlasBaker::bake(const Ref<AbilityTree>& tree) {
+    ERR_FAIL_COND_V(tree.is_null(), Ref<AbilityIconAtlas>());
+
+    Array abilities{};
+    const Array nodes = tree->get_nodes();
+    for (int i = 0; i < nodes.size(); ++i) {
+        const Ref<AbilityNode> node = nodes[i];
+        if (node.is_valid() && node->get_ability().is_valid()) {
+            abilities.append(node->get_ability());
+        }
+    }
+    return bake_abilities(abilities);
+}
+
+Ref<AbilityIconAtlas> AbilityIconAtlasBaker::bake_abilities(const Array& abilities) {
+    m_last_icon_count = 0;
+    m_last_atlas_size = Vector2i();
+
+    Ref<AbilityIconAtlas> atlas;
+    atlas.instantiate();
+
+    // --- Resolve every slot to a unique source texture ---
+    std::vector<PackedIcon> icons{};
+    HashMap<uint64_t, int32_t> icon_by_texture{};
+    HashSet<int64_t> seen_ids{};
+    PackedInt64Array ids{};
+    PackedInt32Array slots{};
+
+    const auto icon_index = [&](const Ref<Texture2D>& texture) -> int32_t {
+        if (texture.is_null()) {
+            return -1;
+        }
+        if (const int32_t* found = icon_by_texture.getptr(texture->get_instance_id())) {
+            return *found;
+        }
+        const auto index = static_cast<int32_t>(icons.size());
+        icons.push_back({texture, {}, {}});
+        icon_by_texture.insert(texture->get_instance_id(), index);
+        return index;
+    };
+
+    for (int i = 0; i < abilities.size(); ++i) {
+        const Ref<Ability> ability = abilities[i];
+        if (ability.is_null() || seen_ids.has(ability->get_registry_id())) {
+            continue;
+        }
+        if (ability->get_registry_key().is_empty()) {
+            UtilityFunctions::push_warning("[AbilityIconAtlasBaker] '", ability->get_name(),
+                                           "' has neither an id nor a path; its row will not match after a reload.");
+        }
+        seen_ids.insert(ability->get_registry_id());
+        ids.push_back(ability->get_registry_id());
+
+        const int32_t base = icon_index(ability->get_icon());
+        slots.push_back(base);
+        for (int level = 1; level < AbilityIconAtlas::SLOTS_PER_ABILITY; ++level) {
+            const Ref<AbilityImprovement> improvement = ability->get_improvement(level);
+            const Ref<Texture2D> icon = improvement.is_valid() ? improvement->get_icon() : Ref<Texture2D>();
+            // The fallback is resolved here, once, instead of on every UI lookup.
+            slots.push_back(icon.is_valid() ? icon_index(icon) : base);
+        }
+    }
+
+    // --- Fetch pixels ---
+    std::vector<int32_t> remap(icons.size(), -1);
+    std::vector<PackedIcon> packed{};
+    for (size_t i = 0; i < icons.size(); ++i) {
+        Ref<Image> image = icons[i].texture->get_image();
+        if (image.is_null() || image->is_empty()) {
+            UtilityFunctions::push_warning("[AbilityIconAtlasBaker] Skipping an icon without image data: ", icons[i].texture->get_path());
+            continue;
+        }
+        if (image->is_compressed() && image->decompress() != OK) {
+            UtilityFunctions::push_warning("[AbilityIconAtlasBaker] Skipping an icon that cannot be decompressed: ", icons[i].texture->get_path());
+            continue;
+        }
+        image->convert(Image::FORMAT_RGBA8);
+        if (m_icon_size.x > 0 && m_icon_size.y > 0 && image->get_size() != m_icon_size) {
+            image->resize(m_icon_size.x, m_icon_size.y, Image::INTERPOLATE_LANCZOS);
+        }
+        remap[i] = static_cast<int32_t>(packed.size());
+        packed.push_back({icons[i].texture, image, {}});
+    }
+    for (int64_t i = 0; i < slots.size(); ++i) {
+        if (slots[i] >= 0) {
+            slots.set(i, remap[slots[i]]);
+        }
+    }
+
+    atlas->set_ids(ids);
+    atlas->set_slots(slots);
+    if (packed.empty()) {
+        return atlas;
+    }
+
+    // --- Shelf packing, tallest first ---
+    std::vector<int32_t> order(packed.size());
+    for (size_t i = 0; i < order.size(); ++i) {
+        order[i] = static_cast<int32_t>(i);
+    }
+    std::sort(order.begin(), order.end(), [&](const int32_t a, const int32_t b) {
+        return packed[a].image->get_height() > packed[b].image->get_height();
+    });
+
+    int32_t cursor_x = 0;
+    int32_t shelf_y = 0;
+    int32_t shelf_height = 0;
+    int32_t page_width = 0;
+    for (const int32_t index : order) {
+        const int32_t width = packed[index].image->get_width() + m_padding * 2;
+        const int32_t height = packed[index].image->get_height() + m_padding * 2;
+        if (cursor_x > 0 && cursor_x + width > m_max_width) {
+            shelf_y += shelf_height;
+            cursor_x = 0;
+            shelf_height = 0;
+        }
+        packed[index].position = Vector2i(cursor_x + m_padding, shelf_y + m_padding);
+        cursor_x += width;
+        shelf_height = Math::max(shelf_height, height);
+        page_width = Math::max(page_width, cursor_x);
+    }
+    const Vector2i page_size(page_width, shelf_y + shelf_height);
+
+    // --- Blit and build the regions ---
+    Ref<Image> page = Image::create_empty(page_size.x, page_size.y, false, Image::FORMAT_RGBA8);
+    for (const PackedIcon& icon : packed) {
+        page->blit_rect(icon.image, Rect2i(Vector2i(), icon.image->get_size()), icon.position);
+    }
+    if (m_generate_mipmaps) {
+        page->generate_mipmaps();
+    }
+    const Ref<ImageTexture> texture = ImageTexture::create_from_image(page);
+
+    Array regions{};
+    for (const PackedIcon& icon : packed) {
+        Ref<AtlasTexture> region;
+        region.instantiate();
+        region->set_atlas(texture);
+        region->set_region(Rect2(icon.position, icon.image->get_size()));
+        region->set_filter_clip(true);
+        regions.append(region);
+    }
+
+    atlas->set_texture(texture);
+    atlas->set_icons(regions);
+
+    m_last_icon_count = static_cast<int>(packed.size());
+    m_last_atlas_size = page_size;
+    return atlas;
+}
+
+// ---------------------------------------------------------------------------
+// Settings
+// ---------------------------------------------------------------------------
+
+void AbilityIconAtlasBaker::set_icon_size(const Vector2i& size) {
+    m_icon_size = Vector2i(Math::max(0, size.x), Math::max(0, size.y));
+}
+
+Vector2i AbilityIconAtlasBaker::get_icon_size() const {
+    return m_icon_size;
+}
+
+void AbilityIconAtlasBaker::set_padding(const int padding) {
+    m_padding = Math::max(0, padding);
+}
+
+int AbilityIconAtlasBaker::get_padding() const {
+    return m_padding;
+}
+
+void AbilityIconAtlasBaker::set_max_width(const int width) {
+    m_max_width = Math::max(1, width);
+}
+
+int AbilityIconAtlasBaker::get_max_width() const {
+    return m_max_width;
+}
+
+void AbilityIconAtlasBaker::set_generate_mipmaps(const bool enabled) {
+    m_generate_mipmaps = enabled;
+}
+
+bool AbilityIconAtlasBaker::get_generate_mipmaps() const {
+    return m_generate_mipmaps;
+}
+
+int AbilityIconAtlasBaker::get_last_icon_count() const {
+    return m_last_icon_count;
+}
+
+Vector2i AbilityIconAtlasBaker::get_last_atlas_size() const {
+    return m_last_atlas_size;
+}
+
+} // namespace Rebel::Ability
@@ -18,6 +18,7 @@ void AbilityImprovement::_bind_methods() {
     // --- description ---
     ClassDB::bind_method(D_METHOD("set_description", "description"), &AbilityImprovement::set_description);
     ClassDB::bind_method(D_METHOD("get_description"), &AbilityImprovement::get_description);
+    ClassDB::bind_method(D_METHOD("format_description", "attributes", "level"), &AbilityImprovement::format_description, DEFVAL(-1));
 
     // --- icon ---
     ClassDB::bind_method(D_METHOD("set_icon", "icon"), &AbilityImprovement::set_icon);
@@ -27,6 +28,10 @@ void AbilityImprovement::_bind_methods() {
     ClassDB::bind_method(D_METHOD("set_cost", "cost"), &AbilityImprovement::set_cost);
     ClassDB::bind_method(D_METHOD("get_cost"), &AbilityImprovement::get_cost);
 
+    // --- state ---
+    ClassDB::bind_method(D_METHOD("is_frozen"), &AbilityImprovement::is_frozen);
+    ClassDB::bind_method(D_METHOD("is_default"), &AbilityImprovement::is_default);
+
     ADD_GROUP("Improvement", "");
     ADD_PROPERTY(PropertyInfo(Variant::INT,    "level",       PROPERTY_HINT_RANGE, "1,10,1"),           "set_level",       "get_level");
     ADD_PROPERTY(PropertyInfo(Variant::STRING, "description", PROPERTY_HINT_MULTILINE_TEXT),            "set_description", "get_description");
@@ -37,6 +42,9 @@ void AbilityImprovement::_bind_methods() {
 // --- level ---
 
 void AbilityImprovement::set_level(const int level) {
+    if (reject_if_frozen()) {
+        return;
+    }
     m_level = Math::clamp(level, 1, 10);
 }
 
@@ -47,16 +55,26 @@ int AbilityImprovement::get_level() const {
 // --- description ---
 
 void AbilityImprovement::set_description(const String& description) {
-    m_description = description;
+    if (reject_if_frozen()) {
+        return;
+    }
+    m_description.set_source(description);
 }
 
 String AbilityImprovement::get_description() const {
-    return m_description;
+    return m_description.get_source();
+}
+
+String AbilityImprovement::format_description(const Ref<Attribute::AttributeSet>& attributes, const int level) {
+    return m_description.render(attributes.ptr(), level < 0 ? m_level : level);
 }
 
 // --- icon ---
 
 void AbilityImprovement::set_icon(const Ref<Texture2D>& icon) {
+    if (reject_if_frozen()) {
+        return;
+    }
     m_icon = icon;
 }
 
@@ -67,6 +85,9 @@ Ref<Texture2D> AbilityImprovement::get_icon() const {
 // --- cost ---
 
 void AbilityImprovement::set_cost(const float cost) {
+    if (reject_if_frozen()) {
+        return;
+    }
     m_cost = Math::max(0.0f, cost);
 }
 
@@ -74,4 +95,26 @@ float AbilityImprovement::get_cost() const {
     return m_cost;
 }
 
+// --- state ---
+
+void AbilityImprovement::freeze() {
+    m_frozen = true;
+}
+
+bool AbilityImprovement::is_frozen() const {
+    return m_frozen;
+}
+
+bool AbilityImprovement::is_default() const {
+    return m_description.get_source().is_empty() && m_icon.is_null() && m_cost == 0.0f;
+}
+
+bool AbilityImprovement::reject_if_frozen() const {
+    if (m_frozen) {
+        UtilityFunctions::push_warning("[AbilityImprovement] Shared default for level ", m_level,
+                                       " is read-only; edit it through Ability.set_improvement() or the Inspector.");
+    }
+    return m_frozen;
+}
+
 } // namespace Rebel::Ability
@@ -2,6 +2,7 @@
 // Alejandro Morcillo Montejo - All Rights Reserved
 
 #include "Rebel/Ability/AbilityNode.hpp"
+#include "Rebel/Ability/AbilityState.hpp"
 
 #include <godot_cpp/core/class_db.hpp>
 
@@ -18,8 +19,12 @@ void AbilityNode::_bind_methods() {
     ClassDB::bind_method(D_METHOD("set_prerequisites", "prerequisites"), &AbilityNode::set_prerequisites);
     ClassDB::bind_method(D_METHOD("get_prerequisites"), &AbilityNode::get_prerequisites);
 
+    // --- condition ---
+    ClassDB::bind_method(D_METHOD("set_condition", "condition"), &AbilityNode::set_condition);
+    ClassDB::bind_method(D_METHOD("get_condition"), &AbilityNode::get_condition);
+
     // --- helper ---
-    ClassDB::bind_method(D_METHOD("can_unlock"), &AbilityNode::can_unlock);
+    ClassDB::bind_method(D_METHOD("can_unlock", "state"), &AbilityNode::can_unlock);
 
     ADD_GROUP("AbilityNode", "");
     ADD_PROPERTY(PropertyInfo(Variant::OBJECT, "ability",
@@ -28,6 +33,9 @@ void AbilityNode::_bind_methods() {
     ADD_PROPERTY(PropertyInfo(Variant::ARRAY, "prerequisites",
                               PROPERTY_HINT_ARRAY_TYPE, "AbilityNode"),
                  "set_prerequisites", "get_prerequisites");
+    ADD_PROPERTY(PropertyInfo(Variant::STRING, "condition",
+                              PROPERTY_HINT_PLACEHOLDER_TEXT, "all()  e.g. at_least(2) or level(#0) >= 3"),
+                 "set_condition", "get_condition");
 }
 
 // ---------------------------------------------------------------------------
@@ -36,6 +44,7 @@ void AbilityNode::_bind_methods() {
 
 void AbilityNode::set_ability(const Ref<Ability>& ability) {
     m_ability = ability;
+    emit_changed();
 }
 
 Ref<Ability> AbilityNode::get_ability() const {
@@ -44,40 +53,33 @@ Ref<Ability> AbilityNode::get_ability() const {
 
 void AbilityNode::set_prerequisites(const Array& prerequisites) {
     m_prerequisites = prerequisites;
+    emit_changed();
 }
 
 Array AbilityNode::get_prerequisites() const {
     return m_prerequisites;
 }
 
+void AbilityNode::set_condition(const String& condition) {
+    m_condition = condition;
+    emit_changed();
+}
+
+String AbilityNode::get_condition() const {
+    return m_condition;
+}
+
 // ---------------------------------------------------------------------------
 // can_unlock
 // ---------------------------------------------------------------------------
 
-bool AbilityNode::can_unlock() const {
-    // A node with no prerequisites is always unlockable (root node).
-    if (m_prerequisites.is_empty()) {
-        return true;
-    }
-
-    for (int i = 0; i < m_prerequisites.size(); ++i) {
-        // Cast each prerequisite element to an AbilityNode.
-        // Non-AbilityNode elements are treated as unsatisfied prerequisites.
-        const Ref<AbilityNode> prereq_node = m_prerequisites[i];
-        if (prereq_node.is_null()) {
-            return false;
-        }
-
-        const Ref<Ability> prereq_ability = prereq_node->get_ability();
-        if (prereq_ability.is_null()) {
-            return false;
-        }
-
-        if (!prereq_ability->get_enabled()) {
-            return false;
-        }
+bool AbilityNode::can_unlock(const Ref<AbilityState>& state) const {
+    if (state.is_null()) {
+        return false;
     }
-    return true;
+    // The state answers from its incrementally maintained unlockable set.
+    const int32_t id = state->find_node(this);
+    return id >= 0 && state->get_unlock_state()->unlockable.test(id);
 }
 
 } // namespace Rebel::Ability
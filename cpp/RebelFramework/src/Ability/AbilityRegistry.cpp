@@ -0,0 +1,311 @@
+// Copyright (c) 2026, and future.
+// Alejandro Morcillo Montejo - All Rights Reserved
+
+#include "Rebel/Ability/AbilityRegistry.hpp"
+
+#include <godot_cpp/classes/resource_loader.hpp>
+#include <godot_cpp/core/class_db.hpp>
+#include <godot_cpp/variant/utility_functions.hpp>
+
+#include <algorithm>
+
+using namespace godot;
+
+namespace Rebel::Ability {
+
+AbilityRegistry* AbilityRegistry::s_singleton = nullptr;
+
+// ---------------------------------------------------------------------------
+// _bind_methods
+// ---------------------------------------------------------------------------
+
+void AbilityRegistry::_bind_methods() {
+    ClassDB::bind_static_method("AbilityRegistry", D_METHOD("make_id", "key"), &AbilityRegistry::make_id);
+
+    // --- registration ---
+    ClassDB::bind_method(D_METHOD("register_path", "key", "path"), &AbilityRegistry::register_path);
+    ClassDB::bind_method(D_METHOD("register_ability", "ability"), &AbilityRegistry::register_ability);
+    ClassDB::bind_method(D_METHOD("register_database", "database"), &AbilityRegistry::register_database);
+    ClassDB::bind_method(D_METHOD("unregister", "id"), &AbilityRegistry::unregister);
+    ClassDB::bind_method(D_METHOD("has_ability", "id"), &AbilityRegistry::has_ability);
+    ClassDB::bind_method(D_METHOD("get_key", "id"), &AbilityRegistry::get_key);
+
+    // --- lookup ---
+    ClassDB::bind_method(D_METHOD("get_ability", "id"), &AbilityRegistry::get_ability);
+    ClassDB::bind_method(D_METHOD("get_ability_by_key", "key"), &AbilityRegistry::get_ability_by_key);
+    ClassDB::bind_method(D_METHOD("is_loaded", "id"), &AbilityRegistry::is_loaded);
+
+    // --- residency ---
+    ClassDB::bind_method(D_METHOD("trim", "max_loaded"), &AbilityRegistry::trim);
+    ClassDB::bind_method(D_METHOD("set_max_loaded", "max_loaded"), &AbilityRegistry::set_max_loaded);
+    ClassDB::bind_method(D_METHOD("get_max_loaded"), &AbilityRegistry::get_max_loaded);
+    ClassDB::bind_method(D_METHOD("get_loaded_count"), &AbilityRegistry::get_loaded_count);
+    ClassDB::bind_method(D_METHOD("get_registered_count"), &AbilityRegistry::get_registered_count);
+
+    ADD_PROPERTY(PropertyInfo(Variant::INT, "max_loaded", PROPERTY_HINT_RANGE, "1,4096,1,or_greater"),
+                 "set_max_loaded", "get_max_loaded");
+}
+
+AbilityRegistry::AbilityRegistry() {
+    s_singleton = this;
+}
+
+AbilityRegistry::~AbilityRegistry() {
+    if (s_singleton == this) {
+        s_singleton = nullptr;
+    }
+}
+
+AbilityRegistry* AbilityRegistry::get_singleton() {
+    return s_singleton;
+}
+
+int64_t AbilityRegistry::make_id(const String& key) {
+    // FNV-1a: stable across runs and platforms, unlike String::hash().
+    const CharString utf8 = key.utf8();
+    uint64_t hash = 0xcbf29ce484222325ull;
+    for (int i = 0; i < utf8.length(); ++i) {
+        hash ^= static_cast<uint8_t>(utf8.get_data()[i]);
+        hash *= 0x100000001b3ull;
+    }
+    return hash == 0 ? 1 : static_cast<int64_t>(hash);
+}
+
+// ---------------------------------------------------------------------------
+// Registration
+// ---------------------------------------------------------------------------
+
+int64_t AbilityRegistry::register_path(const String& key, const String& path) {
+    ERR_FAIL_COND_V_MSG(key.is_empty() || path.is_empty(), 0, "[AbilityRegistry] register_path: empty key or path.");
+
+    const int64_t id = make_id(key);
+    Entry& entry = acquire_entry(id, key);
+    if (entry.path != path) {
+        // A new source: whatever is resident came from the old one.
+        release(entry);
+    }
+    entry.path = path;
+    entry.database.unref();
+    entry.database_index = -1;
+    entry.pinned = false;
+    return id;
+}
+
+int64_t AbilityRegistry::register_ability(const Ref<Ability>& ability) {
+    ERR_FAIL_COND_V(ability.is_null(), 0);
+    const String key = ability->get_registry_key();
+    ERR_FAIL_COND_V_MSG(key.is_empty(), 0, "[AbilityRegistry] register_ability: the ability has neither an id nor a resource path.");
+
+    const int64_t id = make_id(key);
+    Entry& entry = acquire_entry(id, key);
+    if (entry.ability.is_null()) {
+        ++m_loaded_count;
+    }
+    entry.ability = ability;
+    entry.last_use = ++m_use_clock;
+
+    const String path = ability->get_path();
+    const bool reloadable = !path.is_empty() && !path.contains("::");
+    if (reloadable) {
+        entry.path = path;
+    }
+    entry.pinned = !reloadable && entry.path.is_empty() && entry.database.is_null();
+    return id;
+}
+
+int AbilityRegistry::register_database(const Ref<AbilityDatabase>& database) {
+    ERR_FAIL_COND_V(database.is_null(), 0);
+
+    int registered = 0;
+    for (int i = 0; i < database->get_ability_count(); ++i) {
+        String key = database->get_ability_id(i);
+        if (key.is_empty()) {
+            key = database->get_ability_name(i);
+        }
+        if (key.is_empty()) {
+            UtilityFunctions::push_warning("[AbilityRegistry] register_database: ability ", i, " has no id or name; skipped.");
+            continue;
+        }
+        Entry& entry = acquire_entry(make_id(key), key);
+        if (entry.database != database) {
+            release(entry);
+        }
+        entry.path = String();
+        entry.database = database;
+        entry.database_index = i;
+        entry.pinned = false;
+        ++registered;
+    }
+    return registered;
+}
+
+bool AbilityRegistry::unregister(const int64_t id) {
+    const uint32_t* index = m_index_by_id.getptr(id);
+    if (index == nullptr) {
+        return false;
+    }
+    const uint32_t slot = *index;
+    release(m_entries[slot]);
+    m_entries[slot] = Entry{};
+    m_free_entries.push_back(slot);
+    m_index_by_id.erase(id);
+    return true;
+}
+
+bool AbilityRegistry::has_ability(const int64_t id) const {
+    return m_index_by_id.has(id);
+}
+
+String AbilityRegistry::get_key(const int64_t id) const {
+    const Entry* entry = find_entry(id);
+    return entry != nullptr ? entry->key : String();
+}
+
+// ---------------------------------------------------------------------------
+// Lookup
+// ---------------------------------------------------------------------------
+
+Ref<Ability> AbilityRegistry::get_ability(const int64_t id) {
+    Entry* entry = find_entry(id);
+    if (entry == nullptr) {
+        return {};
+    }
+    entry->last_use = ++m_use_clock;
+    if (entry->ability.is_valid()) {
+        return entry->ability;
+    }
+
+    // Make room first, so the definition about to load cannot be chosen.
+    if (m_loaded_count >= m_max_loaded) {
+        trim(m_max_loaded - 1);
+        entry = find_entry(id);
+    }
+
+    Ref<Ability> ability;
+    if (entry->database.is_valid()) {
+        ability = entry->database->get_ability(entry->database_index);
+    } else if (!entry->path.is_empty()) {
+        ability = ResourceLoader::get_singleton()->load(entry->path, "Ability");
+    }
+    if (ability.is_null()) {
+        UtilityFunctions::push_error("[AbilityRegistry] Failed to load ability '", entry->key, "'.");
+        return {};
+    }
+
+    entry->ability = ability;
+    ++m_loaded_count;
+    return ability;
+}
+
+Ref<Ability> AbilityRegistry::get_ability_by_key(const String& key) {
+    return get_ability(make_id(key));
+}
+
+bool AbilityRegistry::is_loaded(const int64_t id) const {
+    const Entry* entry = find_entry(id);
+    return entry != nullptr && entry->ability.is_valid();
+}
+
+// ---------------------------------------------------------------------------
+// Residency
+// ---------------------------------------------------------------------------
+
+int AbilityRegistry::trim(const int max_loaded) {
+    const int target = Math::max(0, max_loaded);
+    if (m_loaded_count <= target) {
+        return 0;
+    }
+
+    std::vector<uint32_t> candidates{};
+    for (uint32_t i = 0; i < m_entries.size(); ++i) {
+        const Entry& entry = m_entries[i];
+        if (entry.ability.is_valid() && !entry.pinned && !is_referenced_elsewhere(entry)) {
+            candidates.push_back(i);
+        }
+    }
+    std::sort(candidates.begin(), candidates.end(), [this](const uint32_t a, const uint32_t b) {
+        return m_entries[a].last_use < m_entries[b].last_use;
+    });
+
+    int released = 0;
+    for (const uint32_t index : candidates) {
+        if (m_loaded_count <= target) {
+            break;
+        }
+        release(m_entries[index]);
+        ++released;
+    }
+    return released;
+}
+
+void AbilityRegistry::set_max_loaded(const int max_loaded) {
+    m_max_loaded = Math::max(1, max_loaded);
+    trim(m_max_loaded);
+}
+
+int AbilityRegistry::get_max_loaded() const {
+    return m_max_loaded;
+}
+
+int AbilityRegistry::get_loaded_count() const {
+    return m_loaded_count;
+}
+
+int AbilityRegistry::get_registered_count() const {
+    return static_cast<int>(m_index_by_id.size());
+}
+
+// ---------------------------------------------------------------------------
+// Private helpers
+// ---------------------------------------------------------------------------
+
+AbilityRegistry::Entry& AbilityRegistry::acquire_entry(const int64_t id, const String& key) {
+    if (const uint32_t* index = m_index_by_id.getptr(id)) {
+        Entry& entry = m_entries[*index];
+        if (entry.key != key) {
+            UtilityFunctions::push_error("[AbilityRegistry] Ids of '", entry.key, "' and '", key, "' collide; rename one of them.");
+        }
+        return entry;
+    }
+
+    uint32_t slot;
+    if (!m_free_entries.empty()) {
+        slot = m_free_entries.back();
+        m_free_entries.pop_back();
+    } else {
+        slot = static_cast<uint32_t>(m_entries.size());
+        m_entries.emplace_back();
+    }
+    m_index_by_id.insert(id, slot);
+    m_entries[slot].key = key;
+    return m_entries[slot];
+}
+
+const AbilityRegistry::Entry* AbilityRegistry::find_entry(const int64_t id) const {
+    const uint32_t* index = m_index_by_id.getptr(id);
+    return index != nullptr ? &m_entries[*index] : nullptr;
+}
+
+AbilityRegistry::Entry* AbilityRegistry::find_entry(const int64_t id) {
+    const uint32_t* index = m_index_by_id.getptr(id);
+    return index != nullptr ? &m_entries[*index] : nullptr;
+}
+
+void AbilityRegistry::release(Entry& entry) {
+    if (entry.ability.is_null()) {
+        return;
+    }
+    entry.ability.unref();
+    --m_loaded_count;
+    if (entry.database.is_valid()) {
+        entry.database->release_ability(entry.database_index);
+    }
+}
+
+bool AbilityRegistry::is_referenced_elsewhere(const Entry& entry) {
+    // One reference is ours; a database-backed definition is also cached by its database.
+    const int owned = entry.database.is_valid() ? 2 : 1;
+    return entry.ability->get_reference_count() > owned;
+}
+
+} // namespace Rebel::Ability
@@ -0,0 +1,211 @@
+// Copyright (c) 2026, and future.
+// Alejandro Morcillo Montejo - All Rights Reserved
+
+#include "Rebel/Ability/AbilityRespec.hpp"
+
+#include <godot_cpp/core/class_db.hpp>
+#include <godot_cpp/variant/utility_functions.hpp>
+
+#include <vector>
+
+using namespace godot;
+
+namespace Rebel::Ability {
+
+void AbilityRespec::_bind_methods() {
+    // --- edits ---
+    ClassDB::bind_method(D_METHOD("relock", "node"), &AbilityRespec::relock);
+    ClassDB::bind_method(D_METHOD("unlock", "node"), &AbilityRespec::unlock);
+    ClassDB::bind_method(D_METHOD("set_level", "node", "level"), &AbilityRespec::set_level);
+
+    // --- preview ---
+    ClassDB::bind_method(D_METHOD("get_preview"), &AbilityRespec::get_preview);
+    ClassDB::bind_method(D_METHOD("get_relocked_ids"), &AbilityRespec::get_relocked_ids);
+    ClassDB::bind_method(D_METHOD("get_refund"), &AbilityRespec::get_refund);
+    ClassDB::bind_method(D_METHOD("get_cost"), &AbilityRespec::get_cost);
+
+    // --- transaction ---
+    ClassDB::bind_method(D_METHOD("is_open"), &AbilityRespec::is_open);
+    ClassDB::bind_method(D_METHOD("commit", "character"), &AbilityRespec::commit);
+    ClassDB::bind_method(D_METHOD("rollback"), &AbilityRespec::rollback);
+}
+
+bool AbilityRespec::begin(const Ref<AbilityTree>& tree, const Ref<AbilityState>& state) {
+    ERR_FAIL_COND_V(tree.is_null() || state.is_null(), false);
+    ERR_FAIL_COND_V_MSG(state->get_tree() != tree, false, "[AbilityRespec] begin: the state belongs to a different tree.");
+    // Seed the state first so the copy and the live state share a revision.
+    ERR_FAIL_NULL_V(state->get_unlock_state(), false);
+
+    m_tree = tree;
+    m_target = state;
+    m_working = state->duplicate_progress();
+    m_base_version = state->get_version();
+    m_base_revision = tree->get_graph_revision();
+    m_totals_version = -1;
+    m_open = true;
+    return true;
+}
+
+bool AbilityRespec::is_open() const {
+    return m_open;
+}
+
+// ---------------------------------------------------------------------------
+// Edits
+// ---------------------------------------------------------------------------
+
+PackedInt32Array AbilityRespec::relock(const Ref<AbilityNode>& node) {
+    ERR_FAIL_COND_V_MSG(!m_open, PackedInt32Array(), "[AbilityRespec] relock: the respec is closed.");
+    return m_working->relock(node);
+}
+
+bool AbilityRespec::unlock(const Ref<AbilityNode>& node) {
+    ERR_FAIL_COND_V_MSG(!m_open, false, "[AbilityRespec] unlock: the respec is closed.");
+    return m_working->unlock(node);
+}
+
+void AbilityRespec::set_level(const Ref<AbilityNode>& node, const int level) {
+    ERR_FAIL_COND_MSG(!m_open, "[AbilityRespec] set_level: the respec is closed.");
+    m_working->set_level(node, level);
+}
+
+// ---------------------------------------------------------------------------
+// Preview
+// ---------------------------------------------------------------------------
+
+Ref<AbilityState> AbilityRespec::get_preview() const {
+    return m_working;
+}
+
+PackedInt32Array AbilityRespec::get_relocked_ids() {
+    PackedInt32Array result{};
+    if (!m_open) {
+        return result;
+    }
+    const AbilityUnlockState* before = m_target->get_unlock_state();
+    const AbilityUnlockState* after = m_working->get_unlock_state();
+    if (before == nullptr || after == nullptr) {
+        return result;
+    }
+    before->enabled.for_each([&](const int32_t id) {
+        if (!after->enabled.test(id)) {
+            result.push_back(id);
+        }
+    });
+    return result;
+}
+
+float AbilityRespec::get_refund() {
+    update_totals();
+    return m_refund;
+}
+
+float AbilityRespec::get_cost() {
+    update_totals();
+    return m_cost;
+}
+
+void AbilityRespec::update_totals() {
+    if (!m_open || m_totals_version == m_working->get_version()) {
+        return;
+    }
+    m_refund = 0.0f;
+    m_cost = 0.0f;
+    m_totals_version = m_working->get_version();
+
+    const AbilityUnlockState* before = m_target->get_unlock_state();
+    const AbilityUnlockState* after = m_working->get_unlock_state();
+    if (before == nullptr || after == nullptr) {
+        return;
+    }
+    const std::span<const uint8_t> levels_before = m_target->levels_view();
+    const std::span<const uint8_t> levels_after = m_working->levels_view();
+    const Array nodes = m_tree->get_nodes();
+
+    for (int32_t id = 0; id < m_tree->get_graph().size(); ++id) {
+        const bool was_enabled = before->enabled.test(id);
+        const bool is_enabled = after->enabled.test(id);
+        if (!was_enabled && !is_enabled) {
+            continue;
+        }
+        const Ref<AbilityNode> node = nodes[id];
+        const Ref<Ability> ability = node.is_valid() ? node->get_ability() : Ref<Ability>();
+        if (ability.is_null()) {
+            continue;
+        }
+        const float value_before = was_enabled ? get_value(*ability.ptr(), levels_before[id]) : 0.0f;
+        const float value_after = is_enabled ? get_value(*ability.ptr(), levels_after[id]) : 0.0f;
+        if (value_after > value_before) {
+            m_cost += value_after - value_before;
+        } else {
+            m_refund += value_before - value_after;
+        }
+    }
+}
+
+float AbilityRespec::get_value(const Ability& ability, const int level) {
+    float value = ability.get_cost();
+    for (int i = 1; i <= level; ++i) {
+        const Ref<AbilityImprovement> improvement = ability.get_improvement(i);
+        if (improvement.is_valid()) {
+            value += improvement->get_cost();
+        }
+    }
+    return value;
+}
+
+// ---------------------------------------------------------------------------
+// Transaction
+// ---------------------------------------------------------------------------
+
+bool AbilityRespec::commit(Node* character) {
+    ERR_FAIL_COND_V_MSG(!m_open, false, "[AbilityRespec] commit: the respec was already committed or rolled back.");
+    if (m_target->get_version() != m_base_version || m_tree->get_graph_revision() != m_base_revision) {
+        UtilityFunctions::push_warning("[AbilityRespec] commit: the state changed since the respec began; nothing was applied.");
+        rollback();
+        return false;
+    }
+
+    // Diff before the swap, so the container pass knows both sides.
+    std::vector<int32_t> locked{};
+    std::vector<int32_t> unlocked{};
+    const AbilityUnlockState* before = m_target->get_unlock_state();
+    const AbilityUnlockState* after = m_working->get_unlock_state();
+    for (int32_t id = 0; id < m_tree->get_graph().size(); ++id) {
+        const bool was_enabled = before->enabled.test(id);
+        if (was_enabled != after->enabled.test(id)) {
+            (was_enabled ? locked : unlocked).push_back(id);
+        }
+    }
+
+    m_target->assign_progress(*m_working.ptr());
+
+    if (character != nullptr) {
+        // One pass each way; containers are found through the character's index.
+        for (const int32_t id : locked) {
+            const Ref<AbilityNode> node = m_tree->get_node_by_id(id);
+            AbilityScriptContainerNode* container = node.is_valid() ? m_tree->find_container(node->get_ability(), character) : nullptr;
+            if (container != nullptr && container->is_active()) {
+                container->on_deactivated();
+            }
+        }
+        for (const int32_t id : unlocked) {
+            const Ref<AbilityNode> node = m_tree->get_node_by_id(id);
+            AbilityScriptContainerNode* container = node.is_valid() ? m_tree->find_container(node->get_ability(), character) : nullptr;
+            if (container != nullptr && !container->is_active()) {
+                container->on_activated();
+            }
+        }
+    }
+
+    m_open = false;
+    m_working.unref();
+    return true;
+}
+
+void AbilityRespec::rollback() {
+    m_open = false;
+    m_working.unref();
+}
+
+} // namespace Rebel::Ability
@@ -0,0 +1,174 @@
+// Copyright (c) 2026, and future.
+// Alejandro Morcillo Montejo - All Rights Reserved
+
+#include "Rebel/Ability/AbilityScheduler.hpp"
+
+#include "Rebel/Ability/AbilityBehaviour.hpp"
+
+#include <godot_cpp/classes/engine.hpp>
+#include <godot_cpp/classes/scene_tree.hpp>
+#include <godot_cpp/classes/window.hpp>
+#include <godot_cpp/core/class_db.hpp>
+#include <godot_cpp/variant/callable_method_pointer.hpp>
+
+#include <algorithm>
+
+using namespace godot;
+
+namespace Rebel::Ability {
+
+AbilityScheduler* AbilityScheduler::s_singleton = nullptr;
+
+// ---------------------------------------------------------------------------
+// _bind_methods
+// ---------------------------------------------------------------------------
+
+void AbilityScheduler::_bind_methods() {
+    ClassDB::bind_method(D_METHOD("tick", "delta"), &AbilityScheduler::tick);
+    ClassDB::bind_method(D_METHOD("get_behaviour_count"), &AbilityScheduler::get_behaviour_count);
+    ClassDB::bind_method(D_METHOD("get_class_count"), &AbilityScheduler::get_class_count);
+}
+
+AbilityScheduler::AbilityScheduler() {
+    s_singleton = this;
+}
+
+AbilityScheduler::~AbilityScheduler() {
+    if (s_singleton == this) {
+        s_singleton = nullptr;
+    }
+}
+
+AbilityScheduler* AbilityScheduler::get_singleton() {
+    return s_singleton;
+}
+
+// ---------------------------------------------------------------------------
+// Registration
+// ---------------------------------------------------------------------------
+
+void AbilityScheduler::add(AbilityBehaviour* behaviour, SceneTree* tree) {
+    ERR_FAIL_NULL(behaviour);
+    if (behaviour->m_schedule_group >= 0) {
+        return;
+    }
+
+    const StringName class_name = behaviour->get_class();
+    int32_t group_index;
+    if (const int32_t* found = m_group_by_class.getptr(class_name)) {
+        group_index = *found;
+    } else {
+        group_index = static_cast<int32_t>(m_groups.size());
+        m_groups.push_back({class_name, {}, 0});
+        m_group_by_class.insert(class_name, group_index);
+    }
+
+    ClassGroup& group = m_groups[group_index];
+    behaviour->m_schedule_group = group_index;
+    behaviour->m_schedule_slot = static_cast<int32_t>(group.members.size());
+    group.members.push_back(behaviour);
+    ++m_behaviour_count;
+
+    connect_tree(tree);
+}
+
+void AbilityScheduler::remove(AbilityBehaviour* behaviour) {
+    if (behaviour == nullptr || behaviour->m_schedule_group < 0) {
+        return;
+    }
+
+    ClassGroup& group = m_groups[behaviour->m_schedule_group];
+    const int32_t slot = behaviour->m_schedule_slot;
+    behaviour->m_schedule_group = -1;
+    behaviour->m_schedule_slot = -1;
+    --m_behaviour_count;
+
+    if (m_ticking) {
+        // Don't move members under the running loop; compact() fills the hole.
+        group.members[slot] = nullptr;
+        ++group.holes;
+        return;
+    }
+
+    AbilityBehaviour* last = group.members.back();
+    group.members[slot] = last;
+    last->m_schedule_slot = slot;
+    group.members.pop_back();
+}
+
+void AbilityScheduler::compact() {
+    for (ClassGroup& group : m_groups) {
+        if (group.holes == 0) {
+            continue;
+        }
+        std::erase(group.members, nullptr);
+        for (size_t slot = 0; slot < group.members.size(); ++slot) {
+            group.members[slot]->m_schedule_slot = static_cast<int32_t>(slot);
+        }
+        group.holes = 0;
+    }
+}
+
+// ---------------------------------------------------------------------------
+// Tick
+// ---------------------------------------------------------------------------
+
+void AbilityScheduler::tick(const double delta) {
+    if (m_behaviour_count == 0 || m_ticking) {
+        return;
+    }
+
+    m_ticking = true;
+    // Index loops with sizes captured up front: tick() may add groups or
+    // members, which must not be visited (or invalidate iterators) this frame.
+    const size_t group_count = m_groups.size();
+    for (size_t g = 0; g < group_count; ++g) {
+        const size_t member_count = m_groups[g].members.size();
+        for (size_t i = 0; i < member_count; ++i) {
+            // Pausing does not unschedule anything; honour it like _process() would.
+            AbilityBehaviour* behaviour = m_groups[g].members[i];
+            if (behaviour != nullptr && behaviour->can_process()) {
+                behaviour->tick(delta);
+            }
+        }
+    }
+    m_ticking = false;
+
+    compact();
+}
+
+void AbilityScheduler::connect_tree(SceneTree* tree) {
+    if (tree == nullptr || tree->get_instance_id() == m_tree_id) {
+        return;
+    }
+    m_tree_id = tree->get_instance_id();
+    const Callable callable = callable_mp(this, &AbilityScheduler::process_frame);
+    if (!tree->is_connected("process_frame", callable)) {
+        tree->connect("process_frame", callable);
+    }
+}
+
+void AbilityScheduler::process_frame() {
+    // Tick at most once per frame, even if the signal is connected twice.
+    const uint64_t frame = Engine::get_singleton()->get_process_frames();
+    if (frame == m_last_frame) {
+        return;
+    }
+    m_last_frame = frame;
+
+    const auto* tree = Object::cast_to<SceneTree>(ObjectDB::get_instance(m_tree_id));
+    if (tree == nullptr || tree->get_root() == nullptr) {
+        return;
+    }
+    tick(tree->get_root()->get_process_delta_time());
+}
+
+int AbilityScheduler::get_behaviour_count() const {
+    return m_behaviour_count;
+}
+
+int AbilityScheduler::get_class_count() const {
+    return static_cast<int>(m_groups.size());
+}
+
+} // namespace Rebel::Ability
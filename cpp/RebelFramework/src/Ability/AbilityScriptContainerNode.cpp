@@ -2,6 +2,8 @@
 // Alejandro Morcillo Montejo - All Rights Reserved
 
 #include "Rebel/Ability/AbilityScriptContainerNode.hpp"
+#include "Rebel/Ability/AbilityRegistry.hpp"
+#include "Rebel/Timer/TimerServer.hpp"
 
 #include <godot_cpp/core/class_db.hpp>
 
@@ -18,6 +20,10 @@ AbilityScriptContainerNode::AbilityScriptContainerNode() {
     set_process_mode(PROCESS_MODE_DISABLED);
 }
 
+AbilityScriptContainerNode::~AbilityScriptContainerNode() {
+    cancel_cooldown();
+}
+
 // ---------------------------------------------------------------------------
 // _bind_methods
 // ---------------------------------------------------------------------------
@@ -26,10 +32,27 @@ void AbilityScriptContainerNode::_bind_methods() {
     // --- ability ---
     ClassDB::bind_method(D_METHOD("set_ability", "ability"), &AbilityScriptContainerNode::set_ability);
     ClassDB::bind_method(D_METHOD("get_ability"), &AbilityScriptContainerNode::get_ability);
+    ClassDB::bind_method(D_METHOD("resolve_ability"), &AbilityScriptContainerNode::resolve_ability);
+    ClassDB::bind_method(D_METHOD("set_ability_id", "ability_id"), &AbilityScriptContainerNode::set_ability_id);
+    ClassDB::bind_method(D_METHOD("get_ability_id"), &AbilityScriptContainerNode::get_ability_id);
+    ClassDB::bind_method(D_METHOD("get_ability_registry_id"), &AbilityScriptContainerNode::get_ability_registry_id);
+
+    // --- state ---
+    ClassDB::bind_method(D_METHOD("is_active"), &AbilityScriptContainerNode::is_active);
+
+    // --- cooldown ---
+    ClassDB::bind_method(D_METHOD("start_cooldown", "seconds"), &AbilityScriptContainerNode::start_cooldown);
+    ClassDB::bind_method(D_METHOD("cancel_cooldown"), &AbilityScriptContainerNode::cancel_cooldown);
+    ClassDB::bind_method(D_METHOD("is_on_cooldown"), &AbilityScriptContainerNode::is_on_cooldown);
+    ClassDB::bind_method(D_METHOD("get_cooldown_remaining"), &AbilityScriptContainerNode::get_cooldown_remaining);
+
+    ADD_SIGNAL(MethodInfo("cooldown_finished"));
+    ADD_SIGNAL(MethodInfo("ability_changed"));
 
     ADD_GROUP("AbilityScriptContainer", "");
     ADD_PROPERTY(PropertyInfo(Variant::OBJECT, "ability", PROPERTY_HINT_RESOURCE_TYPE, "Ability"),
                  "set_ability", "get_ability");
+    ADD_PROPERTY(PropertyInfo(Variant::STRING, "ability_id"), "set_ability_id", "get_ability_id");
 
     GDVIRTUAL_BIND(_on_activated);
     GDVIRTUAL_BIND(_on_deactivated);
@@ -40,18 +63,52 @@ void AbilityScriptContainerNode::_bind_methods() {
 // ---------------------------------------------------------------------------
 
 void AbilityScriptContainerNode::set_ability(const Ref<Ability>& ability) {
+    if (ability == m_ability) {
+        return;
+    }
     m_ability = ability;
+    emit_signal("ability_changed");
 }
 
 Ref<Ability> AbilityScriptContainerNode::get_ability() const {
     return m_ability;
 }
 
+Ref<Ability> AbilityScriptContainerNode::resolve_ability() const {
+    if (m_ability.is_null() && !m_ability_id.is_empty()) {
+        // Not cached here, so the registry stays free to evict the definition.
+        if (AbilityRegistry* registry = AbilityRegistry::get_singleton()) {
+            return registry->get_ability_by_key(m_ability_id);
+        }
+    }
+    return m_ability;
+}
+
+void AbilityScriptContainerNode::set_ability_id(const String& ability_id) {
+    if (ability_id == m_ability_id) {
+        return;
+    }
+    m_ability_id = ability_id;
+    emit_signal("ability_changed");
+}
+
+String AbilityScriptContainerNode::get_ability_id() const {
+    return m_ability_id;
+}
+
+int64_t AbilityScriptContainerNode::get_ability_registry_id() const {
+    if (!m_ability_id.is_empty()) {
+        return AbilityRegistry::make_id(m_ability_id);
+    }
+    return m_ability.is_valid() ? m_ability->get_registry_id() : 0;
+}
+
 // ---------------------------------------------------------------------------
 // Lifecycle
 // ---------------------------------------------------------------------------
 
 void AbilityScriptContainerNode::on_activated() {
+    m_active = true;
     set_process_mode(PROCESS_MODE_INHERIT);
     GDVIRTUAL_CALL(_on_activated);
 }
@@ -59,6 +116,52 @@ void AbilityScriptContainerNode::on_activated() {
 void AbilityScriptContainerNode::on_deactivated() {
     GDVIRTUAL_CALL(_on_deactivated);
     set_process_mode(PROCESS_MODE_DISABLED);
+    m_active = false;
+}
+
+bool AbilityScriptContainerNode::is_active() const {
+    return m_active;
+}
+
+// ---------------------------------------------------------------------------
+// Cooldown
+// ---------------------------------------------------------------------------
+
+void AbilityScriptContainerNode::start_cooldown(const double seconds) {
+    cancel_cooldown();
+    Timer::TimerServer* timers = Timer::TimerServer::get_singleton();
+    if (timers == nullptr || seconds <= 0.0) {
+        return;
+    }
+    m_cooldown_timer = timers->schedule_native(seconds, &AbilityScriptContainerNode::on_cooldown_expired, this);
+}
+
+void AbilityScriptContainerNode::cancel_cooldown() {
+    if (m_cooldown_timer == 0) {
+        return;
+    }
+    if (Timer::TimerServer* timers = Timer::TimerServer::get_singleton()) {
+        timers->cancel(m_cooldown_timer);
+    }
+    m_cooldown_timer = 0;
+}
+
+bool AbilityScriptContainerNode::is_on_cooldown() const {
+    return m_cooldown_timer != 0;
+}
+
+double AbilityScriptContainerNode::get_cooldown_remaining() const {
+    const Timer::TimerServer* timers = Timer::TimerServer::get_singleton();
+    return timers != nullptr ? timers->get_remaining(m_cooldown_timer) : 0.0;
+}
+
+void AbilityScriptContainerNode::on_cooldown_expired(void* context, const int64_t handle, uint64_t /*payload*/) {
+    auto* container = static_cast<AbilityScriptContainerNode*>(context);
+    if (container->m_cooldown_timer != handle) {
+        return;
+    }
+    container->m_cooldown_timer = 0;
+    container->emit_signal("cooldown_finished");
 }
 
 } // namespace Rebel::Ability
@@ -0,0 +1,378 @@
+// Copyright (c) 2026, and future.
+// Alejandro Morcillo Montejo - All Rights Reserved
+
+#include "Rebel/Ability/AbilityState.hpp"
+
+#include <godot_cpp/core/class_db.hpp>
+#include <godot_cpp/variant/callable_method_pointer.hpp>
+#include <godot_cpp/variant/utility_functions.hpp>
+
+using namespace godot;
+
+namespace Rebel::Ability {
+
+void AbilityState::_bind_methods() {
+    // --- tree ---
+    ClassDB::bind_method(D_METHOD("set_tree", "tree"), &AbilityState::set_tree);
+    ClassDB::bind_method(D_METHOD("get_tree"), &AbilityState::get_tree);
+    ClassDB::bind_method(D_METHOD("set_attributes", "attributes"), &AbilityState::set_attributes);
+    ClassDB::bind_method(D_METHOD("get_attributes"), &AbilityState::get_attributes);
+
+    // --- unlock ---
+    ClassDB::bind_method(D_METHOD("is_enabled", "node"), &AbilityState::is_enabled);
+    ClassDB::bind_method(D_METHOD("is_ability_enabled", "ability"), &AbilityState::is_ability_enabled);
+    ClassDB::bind_method(D_METHOD("is_unlockable", "node"), &AbilityState::is_unlockable);
+    ClassDB::bind_method(D_METHOD("unlock", "node"), &AbilityState::unlock);
+    ClassDB::bind_method(D_METHOD("relock", "node"), &AbilityState::relock);
+    ClassDB::bind_method(D_METHOD("get_unlockable_nodes"), &AbilityState::get_unlockable_nodes);
+    ClassDB::bind_method(D_METHOD("get_unlockable_ids"), &AbilityState::get_unlockable_ids);
+
+    // --- levels ---
+    ClassDB::bind_method(D_METHOD("set_level", "node", "level"), &AbilityState::set_level);
+    ClassDB::bind_method(D_METHOD("get_level", "node"), &AbilityState::get_level);
+    ClassDB::bind_method(D_METHOD("get_active_improvement", "node"), &AbilityState::get_active_improvement);
+    ClassDB::bind_method(D_METHOD("get_description", "node"), &AbilityState::get_description);
+    ClassDB::bind_method(D_METHOD("get_improvement_description", "node"), &AbilityState::get_improvement_description);
+
+    // --- storage ---
+    ClassDB::bind_method(D_METHOD("set_enabled_ids", "ids"), &AbilityState::set_enabled_ids);
+    ClassDB::bind_method(D_METHOD("get_enabled_ids"), &AbilityState::get_enabled_ids);
+    ClassDB::bind_method(D_METHOD("set_levels", "levels"), &AbilityState::set_levels);
+    ClassDB::bind_method(D_METHOD("get_levels"), &AbilityState::get_levels);
+    ClassDB::bind_method(D_METHOD("reset"), &AbilityState::reset);
+
+    ADD_GROUP("AbilityState", "");
+    ADD_PROPERTY(PropertyInfo(Variant::OBJECT,             "tree",        PROPERTY_HINT_RESOURCE_TYPE, "AbilityTree"), "set_tree",        "get_tree");
+    ADD_PROPERTY(PropertyInfo(Variant::PACKED_INT32_ARRAY, "enabled_ids"),                                        "set_enabled_ids", "get_enabled_ids");
+    ADD_PROPERTY(PropertyInfo(Variant::PACKED_BYTE_ARRAY,  "levels"),                                             "set_levels",      "get_levels");
+}
+
+// ---------------------------------------------------------------------------
+// Setters / getters
+// ---------------------------------------------------------------------------
+
+void AbilityState::set_tree(const Ref<AbilityTree>& tree) {
+    if (tree == m_tree) {
+        return;
+    }
+    // Carry progress over by node id (e.g. when the tree is assigned after
+    // the stored ids were loaded).
+    if (m_revision >= 0) {
+        m_pending_enabled = get_enabled_ids();
+    }
+    m_tree = tree;
+    m_revision = -1;
+}
+
+Ref<AbilityTree> AbilityState::get_tree() const {
+    return m_tree;
+}
+
+void AbilityState::set_attributes(const Ref<Attribute::AttributeSet>& attributes) {
+    if (attributes == m_attributes) {
+        return;
+    }
+    const Callable on_changed = callable_mp(this, &AbilityState::on_attributes_changed);
+    if (m_attributes.is_valid() && m_attributes->is_connected("attributes_changed", on_changed)) {
+        m_attributes->disconnect("attributes_changed", on_changed);
+    }
+    m_attributes = attributes;
+    if (m_attributes.is_valid()) {
+        m_attributes->connect("attributes_changed", on_changed);
+    }
+    on_attributes_changed({});
+}
+
+Ref<Attribute::AttributeSet> AbilityState::get_attributes() const {
+    return m_attributes;
+}
+
+// ---------------------------------------------------------------------------
+// Sync
+// ---------------------------------------------------------------------------
+
+bool AbilityState::sync() {
+    if (m_tree.is_null()) {
+        return false;
+    }
+    const AbilityGraph& graph = m_tree->get_graph();
+    if (m_revision == m_tree->get_graph_revision()) {
+        return true;
+    }
+
+    // Keep whatever was enabled before the rebuild, by node id.
+    if (m_revision >= 0) {
+        m_pending_enabled = get_enabled_ids();
+    }
+    m_unlock.reset(graph);
+    m_levels.resize(graph.size(), 0);
+    for (int i = 0; i < m_pending_enabled.size(); ++i) {
+        const int32_t id = m_pending_enabled[i];
+        if (id >= 0 && id < graph.size() && graph.is_valid(id)) {
+            m_unlock.enable(graph, id);
+        }
+    }
+    // Conditions are evaluated once, after every stored unlock is applied.
+    m_unlock.refresh(graph, graph.conditional_ids(), make_context());
+    m_pending_enabled.clear();
+    m_revision = m_tree->get_graph_revision();
+    return true;
+}
+
+void AbilityState::mark_changed() {
+    ++m_version;
+    emit_changed();
+}
+
+AbilityConditionContext AbilityState::make_context() const {
+    return {&m_unlock.enabled, m_levels, m_attributes.ptr()};
+}
+
+void AbilityState::on_attributes_changed(const PackedInt32Array& indices) {
+    // Skip the work until the state is in use; sync() evaluates everything.
+    if (m_revision < 0 || !sync()) {
+        return;
+    }
+    const AbilityGraph& graph = m_tree->get_graph();
+    if (m_unlock.refresh(graph, graph.attribute_conditional_ids(), make_context())) {
+        emit_changed();
+    }
+}
+
+const AbilityUnlockState* AbilityState::get_unlock_state() {
+    return sync() ? &m_unlock : nullptr;
+}
+
+std::span<const uint8_t> AbilityState::levels_view() {
+    if (!sync()) {
+        return {};
+    }
+    return m_levels;
+}
+
+int32_t AbilityState::find_node(const AbilityNode* node) {
+    return sync() ? m_tree->get_graph().find_node(node) : -1;
+}
+
+Ref<AbilityState> AbilityState::duplicate_progress() {
+    Ref<AbilityState> copy;
+    copy.instantiate();
+    copy->m_tree = m_tree;
+    copy->m_attributes = m_attributes;
+    copy->assign_progress(*this);
+    return copy;
+}
+
+void AbilityState::assign_progress(const AbilityState& source) {
+    m_unlock = source.m_unlock;
+    m_levels = source.m_levels;
+    m_revision = source.m_revision;
+    m_pending_enabled = source.m_pending_enabled;
+    // The source may not watch attributes (a respec's working copy does
+    // not); re-evaluate attribute conditions against this state's set.
+    if (m_tree.is_valid() && m_revision == m_tree->get_graph_revision()) {
+        const AbilityGraph& graph = m_tree->get_graph();
+        m_unlock.refresh(graph, graph.attribute_conditional_ids(), make_context());
+    }
+    mark_changed();
+}
+
+// ---------------------------------------------------------------------------
+// Unlock
+// ---------------------------------------------------------------------------
+
+bool AbilityState::is_enabled(const Ref<AbilityNode>& node) {
+    const int32_t id = find_node(node.ptr());
+    return id >= 0 && m_unlock.enabled.test(id);
+}
+
+bool AbilityState::is_ability_enabled(const Ref<Ability>& ability) {
+    if (!sync()) {
+        return false;
+    }
+    const int32_t id = m_tree->get_graph().find_ability(ability.ptr());
+    return id >= 0 && m_unlock.enabled.test(id);
+}
+
+bool AbilityState::is_unlockable(const Ref<AbilityNode>& node) {
+    const int32_t id = find_node(node.ptr());
+    return id >= 0 && m_unlock.unlockable.test(id);
+}
+
+bool AbilityState::unlock(const Ref<AbilityNode>& node) {
+    const int32_t id = find_node(node.ptr());
+    if (id < 0 || node->get_ability().is_null() || !m_unlock.unlockable.test(id)) {
+        return false;
+    }
+    const AbilityConditionContext context = make_context();
+    m_unlock.enable(m_tree->get_graph(), id, &context);
+    mark_changed();
+    return true;
+}
+
+PackedInt32Array AbilityState::relock(const Ref<AbilityNode>& node) {
+    PackedInt32Array result{};
+    const int32_t id = find_node(node.ptr());
+    if (id < 0 || !m_unlock.enabled.test(id)) {
+        return result;
+    }
+    std::vector<int32_t> relocked{};
+    relock_id(id, relocked);
+    for (const int32_t relocked_id : relocked) {
+        result.push_back(relocked_id);
+    }
+    mark_changed();
+    return result;
+}
+
+void AbilityState::relock_id(const int32_t id, std::vector<int32_t>& r_relocked) {
+    if (!sync()) {
+        return;
+    }
+    const AbilityGraph& graph = m_tree->get_graph();
+    const AbilityConditionContext context = make_context();
+
+    // Worklist over the dependents index: only nodes downstream of a relocked
+    // node can lose their condition, so nothing else is visited.
+    std::vector<int32_t> pending{id};
+    while (!pending.empty()) {
+        const int32_t current = pending.back();
+        pending.pop_back();
+        if (!m_unlock.enabled.test(current)) {
+            continue;
+        }
+        // Zero the level first: dependents may have a level() condition on it.
+        m_levels[current] = 0;
+        m_unlock.disable(graph, current, context);
+        r_relocked.push_back(current);
+        for (const int32_t dependent : graph.dependents(current)) {
+            if (m_unlock.enabled.test(dependent) && !m_unlock.holds(graph, dependent, context)) {
+                pending.push_back(dependent);
+            }
+        }
+    }
+}
+
+Array AbilityState::get_unlockable_nodes() {
+    Array result{};
+    if (!sync()) {
+        return result;
+    }
+    const Array nodes = m_tree->get_nodes();
+    m_unlock.unlockable.for_each([&](const int32_t id) {
+        result.append(nodes[id]);
+    });
+    return result;
+}
+
+PackedInt32Array AbilityState::get_unlockable_ids() {
+    PackedInt32Array result{};
+    if (!sync()) {
+        return result;
+    }
+    m_unlock.unlockable.for_each([&](const int32_t id) {
+        result.push_back(id);
+    });
+    return result;
+}
+
+// ---------------------------------------------------------------------------
+// Levels
+// ---------------------------------------------------------------------------
+
+void AbilityState::set_level(const Ref<AbilityNode>& node, const int level) {
+    const int32_t id = find_node(node.ptr());
+    ERR_FAIL_COND_MSG(id < 0, "[AbilityState] Node is not part of this state's tree.");
+    // Levels belong to unlocked nodes only; a locked node stays at 0 so
+    // respec pricing and level() conditions never see phantom levels.
+    if (level > 0 && !m_unlock.enabled.test(id)) {
+        UtilityFunctions::push_warning("[AbilityState] set_level: node #", id, " is locked; unlock it before giving it a level.");
+        return;
+    }
+    m_levels[id] = static_cast<uint8_t>(Math::clamp(level, 0, Ability::IMPROVEMENT_COUNT));
+    // Dependents may have a level() condition on this node.
+    const AbilityGraph& graph = m_tree->get_graph();
+    m_unlock.refresh(graph, graph.dependents(id), make_context());
+    mark_changed();
+}
+
+int AbilityState::get_level(const Ref<AbilityNode>& node) {
+    const int32_t id = find_node(node.ptr());
+    return id >= 0 ? m_levels[id] : 0;
+}
+
+Ref<AbilityImprovement> AbilityState::get_active_improvement(const Ref<AbilityNode>& node) {
+    const int level = get_level(node);
+    if (level <= 0 || node->get_ability().is_null()) {
+        return {};
+    }
+    return node->get_ability()->get_improvement(level);
+}
+
+String AbilityState::get_description(const Ref<AbilityNode>& node) {
+    if (node.is_null() || node->get_ability().is_null()) {
+        return {};
+    }
+    return node->get_ability()->format_description(m_attributes, get_level(node));
+}
+
+String AbilityState::get_improvement_description(const Ref<AbilityNode>& node) {
+    const Ref<AbilityImprovement> improvement = get_active_improvement(node);
+    return improvement.is_valid() ? improvement->format_description(m_attributes, get_level(node)) : String();
+}
+
+// ---------------------------------------------------------------------------
+// Storage
+// ---------------------------------------------------------------------------
+
+void AbilityState::set_enabled_ids(const PackedInt32Array& ids) {
+    m_pending_enabled = ids;
+    m_revision = -1;
+    mark_changed();
+}
+
+PackedInt32Array AbilityState::get_enabled_ids() {
+    if (m_revision < 0) {
+        // Not applied yet — hand back what was stored.
+        return m_pending_enabled;
+    }
+    PackedInt32Array ids{};
+    m_unlock.enabled.for_each([&](const int32_t id) {
+        ids.push_back(id);
+    });
+    return ids;
+}
+
+void AbilityState::set_levels(const PackedByteArray& levels) {
+    m_levels.assign(levels.ptr(), levels.ptr() + levels.size());
+    for (uint8_t& level : m_levels) {
+        level = static_cast<uint8_t>(Math::min<int>(level, Ability::IMPROVEMENT_COUNT));
+    }
+    if (m_revision >= 0) {
+        m_levels.resize(m_unlock.missing.size(), 0);
+        if (sync()) {
+            const AbilityGraph& graph = m_tree->get_graph();
+            m_unlock.refresh(graph, graph.conditional_ids(), make_context());
+        }
+    }
+    mark_changed();
+}
+
+PackedByteArray AbilityState::get_levels() const {
+    PackedByteArray levels{};
+    levels.resize(static_cast<int64_t>(m_levels.size()));
+    if (!m_levels.empty()) {
+        memcpy(levels.ptrw(), m_levels.data(), m_levels.size());
+    }
+    return levels;
+}
+
+void AbilityState::reset() {
+    m_pending_enabled.clear();
+    m_revision = -1;
+    std::fill(m_levels.begin(), m_levels.end(), 0);
+    sync();
+    mark_changed();
+}
+
+} // namespace Rebel::Ability
@@ -0,0 +1,182 @@
+// Copyright (c) 2026, and future.
+// Alejandro Morcillo Montejo - All Rights Reserved
+
+#include "Rebel/Ability/AbilityTask.hpp"
+
+#include "Rebel/Ability/AbilityTaskExecutor.hpp"
+
+#include <godot_cpp/classes/animation_mixer.hpp>
+
+#include <array>
+#include <new>
+#include <vector>
+
+using namespace godot;
+
+namespace Rebel::Ability {
+
+// ---------------------------------------------------------------------------
+// Frame pool
+// ---------------------------------------------------------------------------
+
+namespace {
+
+constexpr int SIZE_CLASS_COUNT = 7; // 64, 128, ..., 4096 bytes
+
+static_assert(AbilityTaskFramePool::MIN_POOLED_SIZE << (SIZE_CLASS_COUNT - 1) == AbilityTaskFramePool::MAX_POOLED_SIZE);
+
+struct FreeFrame {
+    FreeFrame* next;
+};
+
+struct FramePool {
+    std::array<FreeFrame*, SIZE_CLASS_COUNT> free_lists{};
+    std::vector<void*> blocks{};
+    size_t reserved_bytes{0};
+
+    ~FramePool() {
+        for (void* block : blocks) {
+            ::operator delete(block);
+        }
+    }
+};
+
+FramePool& frame_pool() {
+    static FramePool pool;
+    return pool;
+}
+
+int size_class_of(const size_t size) {
+    int size_class = 0;
+    for (size_t capacity = AbilityTaskFramePool::MIN_POOLED_SIZE; capacity < size; capacity <<= 1) {
+        ++size_class;
+    }
+    return size_class;
+}
+
+} // namespace
+
+void* AbilityTaskFramePool::allocate(const size_t size) {
+    if (size > MAX_POOLED_SIZE) {
+        return ::operator new(size);
+    }
+    FramePool& pool = frame_pool();
+    const int size_class = size_class_of(size);
+    if (pool.free_lists[size_class] == nullptr) {
+        // Carve a fresh block into frames of this class.
+        const size_t frame_size = MIN_POOLED_SIZE << size_class;
+        auto* block = static_cast<std::byte*>(::operator new(frame_size * FRAMES_PER_BLOCK));
+        pool.blocks.push_back(block);
+        pool.reserved_bytes += frame_size * FRAMES_PER_BLOCK;
+        for (int i = FRAMES_PER_BLOCK - 1; i >= 0; --i) {
+            auto* frame = reinterpret_cast<FreeFrame*>(block + frame_size * i);
+            frame->next = pool.free_lists[size_class];
+            pool.free_lists[size_class] = frame;
+        }
+    }
+    FreeFrame* frame = pool.free_lists[size_class];
+    pool.free_lists[size_class] = frame->next;
+    return frame;
+}
+
+void AbilityTaskFramePool::deallocate(void* frame, const size_t size) {
+    if (frame == nullptr) {
+        return;
+    }
+    if (size > MAX_POOLED_SIZE) {
+        ::operator delete(frame);
+        return;
+    }
+    FramePool& pool = frame_pool();
+    const int size_class = size_class_of(size);
+    auto* free_frame = static_cast<FreeFrame*>(frame);
+    free_frame->next = pool.free_lists[size_class];
+    pool.free_lists[size_class] = free_frame;
+}
+
+size_t AbilityTaskFramePool::get_reserved_bytes() {
+    return frame_pool().reserved_bytes;
+}
+
+// ---------------------------------------------------------------------------
+// Task
+// ---------------------------------------------------------------------------
+
+AbilityTask::promise_type::~promise_type() {
+    if (wait != NO_WAIT) {
+        if (AbilityTaskExecutor* executor = AbilityTaskExecutor::get_singleton()) {
+            executor->cancel(wait);
+        }
+    }
+}
+
+AbilityTask& AbilityTask::operator=(AbilityTask&& other) noexcept {
+    if (this != &other) {
+        cancel();
+        m_handle = other.m_handle;
+        other.m_handle = {};
+    }
+    return *this;
+}
+
+AbilityTask::~AbilityTask() {
+    cancel();
+}
+
+void AbilityTask::start() {
+    if (!m_handle || m_handle.promise().started) {
+        return;
+    }
+    m_handle.promise().started = true;
+    m_handle.resume();
+}
+
+void AbilityTask::cancel() {
+    if (m_handle) {
+        m_handle.destroy();
+        m_handle = {};
+    }
+}
+
+// ---------------------------------------------------------------------------
+// Awaitables
+// ---------------------------------------------------------------------------
+
+bool AbilityTask::Wait::await_suspend(const Handle handle) {
+    AbilityTaskExecutor* executor = AbilityTaskExecutor::get_singleton();
+    return executor != nullptr && executor->suspend(*this, handle, &handle.promise().wait);
+}
+
+AbilityTask::Wait AbilityTask::next_frame() {
+    Wait wait{};
+    wait.kind = WaitKind::ProcessFrame;
+    return wait;
+}
+
+AbilityTask::Wait AbilityTask::next_physics_frame() {
+    Wait wait{};
+    wait.kind = WaitKind::PhysicsFrame;
+    return wait;
+}
+
+AbilityTask::Wait AbilityTask::seconds(const double seconds) {
+    Wait wait{};
+    wait.kind = WaitKind::Duration;
+    wait.seconds = seconds > 0.0 ? seconds : 0.0;
+    return wait;
+}
+
+AbilityTask::Wait AbilityTask::signal(Object* object, const StringName& signal, const Variant& match) {
+    Wait wait{};
+    wait.kind = WaitKind::Signal;
+    wait.object_id = object != nullptr ? object->get_instance_id() : 0;
+    wait.signal_name = signal;
+    wait.match = match;
+    return wait;
+}
+
+AbilityTask::Wait AbilityTask::animation(AnimationMixer* mixer, const StringName& animation) {
+    return signal(mixer, "animation_finished", animation);
+}
+
+} // namespace Rebel::Ability
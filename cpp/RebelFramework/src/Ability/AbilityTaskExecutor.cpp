@@ -0,0 +1,329 @@
+// Copyright (c) 2026, and future.
+// Alejandro Morcillo Montejo - All Rights Reserved
+
+#include "Rebel/Ability/AbilityTaskExecutor.hpp"
+
+#include "Rebel/Timer/TimerServer.hpp"
+
+#include <godot_cpp/classes/engine.hpp>
+#include <godot_cpp/classes/scene_tree.hpp>
+#include <godot_cpp/core/class_db.hpp>
+#include <godot_cpp/templates/hashfuncs.hpp>
+#include <godot_cpp/variant/callable_custom.hpp>
+#include <godot_cpp/variant/callable_method_pointer.hpp>
+#include <godot_cpp/variant/utility_functions.hpp>
+
+using namespace godot;
+
+namespace Rebel::Ability {
+
+AbilityTaskExecutor* AbilityTaskExecutor::s_singleton = nullptr;
+
+namespace {
+
+/**
+ * Connected to the signal a task waits on. Accepts any number of arguments
+ * (a bound method would have to match the signal's arity) and hands them to
+ * the executor as the co_await result.
+ */
+class SignalWaitCallable : public CallableCustom {
+    uint64_t m_executor_id;
+    uint32_t m_index;
+    uint32_t m_generation;
+
+    static bool compare_equal(const CallableCustom* a, const CallableCustom* b) {
+        const auto* lhs = static_cast<const SignalWaitCallable*>(a);
+        const auto* rhs = static_cast<const SignalWaitCallable*>(b);
+        return lhs->m_index == rhs->m_index && lhs->m_generation == rhs->m_generation;
+    }
+
+    static bool compare_less(const CallableCustom* a, const CallableCustom* b) {
+        const auto* lhs = static_cast<const SignalWaitCallable*>(a);
+        const auto* rhs = static_cast<const SignalWaitCallable*>(b);
+        return lhs->key() < rhs->key();
+    }
+
+    [[nodiscard]] uint64_t key() const { return (uint64_t{m_generation} << 32) | m_index; }
+
+public:
+    SignalWaitCallable(const uint64_t executor_id, const uint32_t index, const uint32_t generation) :
+            m_executor_id(executor_id), m_index(index), m_generation(generation) {}
+
+    uint32_t hash() const override { return hash_murmur3_one_64(key()); }
+
+    String get_as_text() const override { return "AbilityTaskExecutor::signal_wait"; }
+
+    CompareEqualFunc get_compare_equal_func() const override { return &compare_equal; }
+
+    CompareLessFunc get_compare_less_func() const override { return &compare_less; }
+
+    ObjectID get_object() const override { return ObjectID(m_executor_id); }
+
+    void call(const Variant** p_arguments, const int p_argcount, Variant& r_return_value, GDExtensionCallError& r_call_error) const override {
+        r_call_error.error = GDEXTENSION_CALL_OK;
+        Array arguments{};
+        for (int i = 0; i < p_argcount; ++i) {
+            arguments.push_back(*p_arguments[i]);
+        }
+        if (AbilityTaskExecutor* executor = AbilityTaskExecutor::get_singleton()) {
+            executor->resume_signal(m_index, m_generation, arguments);
+        }
+    }
+};
+
+} // namespace
+
+// ---------------------------------------------------------------------------
+// _bind_methods
+// ---------------------------------------------------------------------------
+
+void AbilityTaskExecutor::_bind_methods() {
+    ClassDB::bind_method(D_METHOD("process_frames"), &AbilityTaskExecutor::process_frames);
+    ClassDB::bind_method(D_METHOD("process_physics_frames"), &AbilityTaskExecutor::process_physics_frames);
+    ClassDB::bind_method(D_METHOD("get_wait_count"), &AbilityTaskExecutor::get_wait_count);
+    ClassDB::bind_method(D_METHOD("get_frame_pool_bytes"), &AbilityTaskExecutor::get_frame_pool_bytes);
+}
+
+AbilityTaskExecutor::AbilityTaskExecutor() {
+    s_singleton = this;
+}
+
+AbilityTaskExecutor::~AbilityTaskExecutor() {
+    // Tasks outliving the executor stay suspended; their promises must not call back.
+    for (uint32_t index = 0; index < m_waits.size(); ++index) {
+        if (m_waits[index].kind != WaitKind::Free) {
+            *m_waits[index].owner = AbilityTask::NO_WAIT;
+            release(index);
+        }
+    }
+    if (s_singleton == this) {
+        s_singleton = nullptr;
+    }
+}
+
+AbilityTaskExecutor* AbilityTaskExecutor::get_singleton() {
+    return s_singleton;
+}
+
+// ---------------------------------------------------------------------------
+// Suspend / resume
+// ---------------------------------------------------------------------------
+
+bool AbilityTaskExecutor::suspend(AbilityTask::Wait& wait, const std::coroutine_handle<> handle, uint32_t* owner) {
+    Object* emitter = nullptr;
+    if (wait.kind == WaitKind::Signal) {
+        emitter = ObjectDB::get_instance(wait.object_id);
+        if (emitter == nullptr) {
+            return false;
+        }
+        if (!emitter->has_signal(wait.signal_name)) {
+            UtilityFunctions::push_error("[AbilityTaskExecutor] ", emitter->get_class(), " has no signal '", wait.signal_name, "'.");
+            return false;
+        }
+    }
+    Timer::TimerServer* timers = Timer::TimerServer::get_singleton();
+    if (wait.kind == WaitKind::Duration && timers == nullptr) {
+        return false;
+    }
+
+    const uint32_t index = allocate();
+    WaitRecord& record = m_waits[index];
+    record.handle = handle;
+    record.owner = owner;
+    record.result = &wait.result;
+    record.kind = wait.kind;
+    const uint64_t payload = (uint64_t{record.generation} << 32) | index;
+
+    switch (wait.kind) {
+        case WaitKind::ProcessFrame:
+            m_process_queue.emplace_back(index, record.generation);
+            connect_tree(Object::cast_to<SceneTree>(Engine::get_singleton()->get_main_loop()));
+            break;
+        case WaitKind::PhysicsFrame:
+            m_physics_queue.emplace_back(index, record.generation);
+            connect_tree(Object::cast_to<SceneTree>(Engine::get_singleton()->get_main_loop()));
+            break;
+        case WaitKind::Duration:
+            record.timer = timers->schedule_native(wait.seconds, &AbilityTaskExecutor::on_timer, this, payload);
+            break;
+        case WaitKind::Signal:
+            record.object_id = wait.object_id;
+            record.signal_name = wait.signal_name;
+            record.match = wait.match;
+            record.callable = Callable(memnew(SignalWaitCallable(get_instance_id(), index, record.generation)));
+            emitter->connect(record.signal_name, record.callable);
+            break;
+        case WaitKind::Free:
+            break;
+    }
+
+    *owner = index;
+    return true;
+}
+
+void AbilityTaskExecutor::cancel(const uint32_t index) {
+    if (index < m_waits.size() && m_waits[index].kind != WaitKind::Free) {
+        release(index);
+    }
+}
+
+void AbilityTaskExecutor::resume_signal(const uint32_t index, const uint32_t generation, const Array& arguments) {
+    if (index >= m_waits.size() || m_waits[index].generation != generation || m_waits[index].kind != WaitKind::Signal) {
+        return;
+    }
+    WaitRecord& record = m_waits[index];
+    if (record.match.get_type() != Variant::NIL && (arguments.is_empty() || arguments[0] != record.match)) {
+        return;
+    }
+    *record.result = arguments;
+    resume(index);
+}
+
+void AbilityTaskExecutor::resume(const uint32_t index) {
+    const std::coroutine_handle<> handle = m_waits[index].handle;
+    *m_waits[index].owner = AbilityTask::NO_WAIT;
+    release(index);
+    // May suspend again, which can grow m_waits; nothing above is used after this.
+    handle.resume();
+}
+
+void AbilityTaskExecutor::on_timer(void* context, int64_t /*handle*/, const uint64_t payload) {
+    auto* executor = static_cast<AbilityTaskExecutor*>(context);
+    const auto index = static_cast<uint32_t>(payload & 0xffffffffu);
+    const auto generation = static_cast<uint32_t>(payload >> 32);
+    if (index >= executor->m_waits.size()) {
+        return;
+    }
+    WaitRecord& record = executor->m_waits[index];
+    if (record.generation != generation || record.kind != WaitKind::Duration) {
+        return;
+    }
+    // The one-shot timer is done; don't cancel it on release.
+    record.timer = 0;
+    executor->resume(index);
+}
+
+// ---------------------------------------------------------------------------
+// Records
+// ---------------------------------------------------------------------------
+
+uint32_t AbilityTaskExecutor::allocate() {
+    uint32_t index;
+    if (!m_free_waits.empty()) {
+        index = m_free_waits.back();
+        m_free_waits.pop_back();
+    } else {
+        index = static_cast<uint32_t>(m_waits.size());
+        m_waits.emplace_back();
+    }
+    ++m_wait_count;
+    return index;
+}
+
+void AbilityTaskExecutor::release(const uint32_t index) {
+    WaitRecord& record = m_waits[index];
+    if (record.kind == WaitKind::Duration && record.timer != 0) {
+        if (Timer::TimerServer* timers = Timer::TimerServer::get_singleton()) {
+            timers->cancel(record.timer);
+        }
+    } else if (record.kind == WaitKind::Signal) {
+        Object* emitter = ObjectDB::get_instance(record.object_id);
+        if (emitter != nullptr && emitter->is_connected(record.signal_name, record.callable)) {
+            emitter->disconnect(record.signal_name, record.callable);
+        }
+    }
+
+    // Bumping the generation invalidates queue entries, timer payloads and callables.
+    const uint32_t generation = record.generation + 1;
+    record = WaitRecord{};
+    record.generation = generation;
+    m_free_waits.push_back(index);
+    --m_wait_count;
+}
+
+// ---------------------------------------------------------------------------
+// Frame queues
+// ---------------------------------------------------------------------------
+
+void AbilityTaskExecutor::process_frames() {
+    drain(m_process_queue);
+}
+
+void AbilityTaskExecutor::process_physics_frames() {
+    drain(m_physics_queue);
+}
+
+void AbilityTaskExecutor::drain(std::vector<std::pair<uint32_t, uint32_t>>& queue) {
+    if (queue.empty()) {
+        return;
+    }
+    // Tasks that wait for another frame while being resumed land in the
+    // emptied queue and run next frame, not in this loop.
+    std::vector<std::pair<uint32_t, uint32_t>> draining = std::move(m_draining);
+    draining.swap(queue);
+    for (const auto& [index, generation] : draining) {
+        if (m_waits[index].generation == generation && m_waits[index].kind != WaitKind::Free) {
+            resume(index);
+        }
+    }
+    draining.clear();
+    m_draining = std::move(draining);
+}
+
+void AbilityTaskExecutor::connect_tree(SceneTree* tree) {
+    if (tree == nullptr || tree->get_instance_id() == m_tree_id) {
+        return;
+    }
+    m_tree_id = tree->get_instance_id();
+    const Callable on_process = callable_mp(this, &AbilityTaskExecutor::process_frame);
+    if (!tree->is_connected("process_frame", on_process)) {
+        tree->connect("process_frame", on_process);
+    }
+    const Callable on_physics = callable_mp(this, &AbilityTaskExecutor::physics_frame);
+    if (!tree->is_connected("physics_frame", on_physics)) {
+        tree->connect("physics_frame", on_physics);
+    }
+}
+
+void AbilityTaskExecutor::process_frame() {
+    // Drain at most once per frame, even if the signal is connected twice.
+    const uint64_t frame = Engine::get_singleton()->get_process_frames();
+    if (frame == m_last_process_frame) {
+        return;
+    }
+    m_last_process_frame = frame;
+
+    const auto* tree = Object::cast_to<SceneTree>(ObjectDB::get_instance(m_tree_id));
+    if (tree == nullptr || tree->is_paused()) {
+        return;
+    }
+    process_frames();
+}
+
+void AbilityTaskExecutor::physics_frame() {
+    const uint64_t frame = Engine::get_singleton()->get_physics_frames();
+    if (frame == m_last_physics_frame) {
+        return;
+    }
+    m_last_physics_frame = frame;
+
+    const auto* tree = Object::cast_to<SceneTree>(ObjectDB::get_instance(m_tree_id));
+    if (tree == nullptr || tree->is_paused()) {
+        return;
+    }
+    process_physics_frames();
+}
+
+// ---------------------------------------------------------------------------
+// Stats
+// ---------------------------------------------------------------------------
+
+int AbilityTaskExecutor::get_wait_count() const {
+    return m_wait_count;
+}
+
+int64_t AbilityTaskExecutor::get_frame_pool_bytes() const {
+    return static_cast<int64_t>(AbilityTaskFramePool::get_reserved_bytes());
+}
+
+} // namespace Rebel::Ability
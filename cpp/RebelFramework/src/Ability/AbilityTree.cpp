@@ -2,9 +2,15 @@
 // Alejandro Morcillo Montejo - All Rights Reserved
 
 #include "Rebel/Ability/AbilityTree.hpp"
+#include "Rebel/Ability/AbilityIconAtlas.hpp"
+#include "Rebel/Ability/AbilityRespec.hpp"
 #include "Rebel/Ability/AbilityScriptContainerNode.hpp"
+#include "Rebel/Ability/AbilityState.hpp"
 
 #include <godot_cpp/core/class_db.hpp>
+#include <godot_cpp/variant/callable_method_pointer.hpp>
+#include <godot_cpp/variant/packed_float32_array.hpp>
+#include <godot_cpp/variant/utility_functions.hpp>
 
 using namespace godot;
 
@@ -14,17 +20,34 @@ void AbilityTree::_bind_methods() {
     // --- nodes ---
     ClassDB::bind_method(D_METHOD("set_nodes", "nodes"), &AbilityTree::set_nodes);
     ClassDB::bind_method(D_METHOD("get_nodes"), &AbilityTree::get_nodes);
+    ClassDB::bind_method(D_METHOD("set_icon_atlas", "atlas"), &AbilityTree::set_icon_atlas);
+    ClassDB::bind_method(D_METHOD("get_icon_atlas"), &AbilityTree::get_icon_atlas);
 
     // --- helpers ---
     ClassDB::bind_method(D_METHOD("get_root_nodes"), &AbilityTree::get_root_nodes);
-    ClassDB::bind_method(D_METHOD("try_unlock", "node"), &AbilityTree::try_unlock);
-    ClassDB::bind_method(D_METHOD("try_activate", "node", "parent"), &AbilityTree::try_activate);
+    ClassDB::bind_method(D_METHOD("get_depth_layers"), &AbilityTree::get_depth_layers);
+    ClassDB::bind_method(D_METHOD("get_node_depth", "node"), &AbilityTree::get_node_depth);
+    ClassDB::bind_method(D_METHOD("get_validation_errors"), &AbilityTree::get_validation_errors);
+    ClassDB::bind_method(D_METHOD("create_state"), &AbilityTree::create_state);
+    ClassDB::bind_method(D_METHOD("try_unlock", "state", "node"), &AbilityTree::try_unlock);
+    ClassDB::bind_method(D_METHOD("begin_respec", "state"), &AbilityTree::begin_respec);
+    ClassDB::bind_method(D_METHOD("get_node_id", "node"), &AbilityTree::get_node_id);
+    ClassDB::bind_method(D_METHOD("get_node_by_id", "id"), &AbilityTree::get_node_by_id);
+    ClassDB::bind_method(D_METHOD("get_graph_revision"), &AbilityTree::get_graph_revision);
+    ClassDB::bind_method(D_METHOD("query_state", "state", "budget"), &AbilityTree::query_state);
+    ClassDB::bind_method(D_METHOD("try_activate", "state", "node", "parent"), &AbilityTree::try_activate);
     ClassDB::bind_method(D_METHOD("deactivate", "behavior_node"), &AbilityTree::deactivate);
+    ClassDB::bind_method(D_METHOD("find_container", "ability", "character"), &AbilityTree::find_container);
+    ClassDB::bind_method(D_METHOD("find_container_by_id", "ability_id", "character"), &AbilityTree::find_container_by_id);
+    ClassDB::bind_method(D_METHOD("activate_all_enabled", "state", "character"), &AbilityTree::activate_all_enabled);
 
     ADD_GROUP("AbilityTree", "");
     ADD_PROPERTY(PropertyInfo(Variant::ARRAY, "nodes",
                               PROPERTY_HINT_ARRAY_TYPE, "AbilityNode"),
                  "set_nodes", "get_nodes");
+    ADD_PROPERTY(PropertyInfo(Variant::OBJECT, "icon_atlas",
+                              PROPERTY_HINT_RESOURCE_TYPE, "AbilityIconAtlas"),
+                 "set_icon_atlas", "get_icon_atlas");
 }
 
 // ---------------------------------------------------------------------------
@@ -32,66 +55,106 @@ void AbilityTree::_bind_methods() {
 // ---------------------------------------------------------------------------
 
 void AbilityTree::set_nodes(const Array& nodes) {
+    const Callable on_changed = callable_mp(this, &AbilityTree::on_node_changed);
+    for (int i = 0; i < m_nodes.size(); ++i) {
+        const Ref<AbilityNode> node = m_nodes[i];
+        if (node.is_valid() && node->is_connected("changed", on_changed)) {
+            node->disconnect("changed", on_changed);
+        }
+    }
+
     m_nodes = nodes;
+
+    for (int i = 0; i < m_nodes.size(); ++i) {
+        const Ref<AbilityNode> node = m_nodes[i];
+        if (node.is_valid() && !node->is_connected("changed", on_changed)) {
+            node->connect("changed", on_changed);
+        }
+    }
+
+    // Compile now so authoring mistakes surface when the tree is loaded or
+    // edited, not the first time the player opens the ability screen.
+    m_graph_dirty = true;
+    ensure_compiled();
 }
 
 Array AbilityTree::get_nodes() const {
     return m_nodes;
 }
 
+void AbilityTree::set_icon_atlas(const Ref<AbilityIconAtlas>& atlas) {
+    m_icon_atlas = atlas;
+    emit_changed();
+}
+
+Ref<AbilityIconAtlas> AbilityTree::get_icon_atlas() const {
+    return m_icon_atlas;
+}
+
 // ---------------------------------------------------------------------------
 // get_root_nodes
 // ---------------------------------------------------------------------------
 
-Array AbilityTree::get_root_nodes() const {
-    Array result{};
-    for (int i = 0; i < m_nodes.size(); ++i) {
-        const Ref<AbilityNode> node = m_nodes[i];
-        if (node.is_null()) {
-            continue;
-        }
-        // A root node has no prerequisites.
-        if (node->get_prerequisites().is_empty()) {
-            result.append(node);
-        }
-    }
-    return result;
+Array AbilityTree::get_root_nodes() {
+    ensure_compiled();
+    return m_root_nodes;
+}
+
+Array AbilityTree::get_depth_layers() {
+    ensure_compiled();
+    return m_depth_layers;
+}
+
+int AbilityTree::get_node_depth(const Ref<AbilityNode>& node) {
+    const int id = get_node_id(node);
+    return id >= 0 ? m_graph.get_depth(id) : -1;
+}
+
+PackedStringArray AbilityTree::get_validation_errors() {
+    ensure_compiled();
+    return m_graph.get_errors();
 }
 
 // ---------------------------------------------------------------------------
 // try_unlock
 // ---------------------------------------------------------------------------
 
-bool AbilityTree::try_unlock(const Ref<AbilityNode>& node) {
-    if (node.is_null()) {
-        return false;
-    }
+Ref<AbilityState> AbilityTree::create_state() {
+    Ref<AbilityState> state;
+    state.instantiate();
+    state->set_tree(this);
+    return state;
+}
 
-    const Ref<Ability> ability = node->get_ability();
-    if (ability.is_null()) {
+bool AbilityTree::try_unlock(const Ref<AbilityState>& state, const Ref<AbilityNode>& node) {
+    if (state.is_null() || node.is_null()) {
         return false;
     }
-
-    // Already unlocked — nothing to do.
-    if (ability->get_enabled()) {
+    if (state->get_tree().ptr() != this) {
+        UtilityFunctions::push_warning("[AbilityTree] try_unlock: the state belongs to a different tree.");
         return false;
     }
 
-    // Prerequisites not satisfied.
-    if (!node->can_unlock()) {
-        return false;
-    }
+    // AbilityState::unlock() rejects null abilities, enabled nodes and nodes
+    // whose prerequisites are not all enabled.
+    return state->unlock(node);
+}
 
-    ability->set_enabled(true);
-    return true;
+Ref<AbilityRespec> AbilityTree::begin_respec(const Ref<AbilityState>& state) {
+    Ref<AbilityRespec> respec;
+    respec.instantiate();
+    if (!respec->begin(this, state)) {
+        return {};
+    }
+    return respec;
 }
 
 // ---------------------------------------------------------------------------
 // try_activate
 // ---------------------------------------------------------------------------
 
-Node* AbilityTree::try_activate(const Ref<AbilityNode>& node, Node* character) {
-    if (!try_unlock(node)) {
+Node* AbilityTree::try_activate(const Ref<AbilityState>& state, const Ref<AbilityNode>& node, Node* character) {
+    if (!try_unlock(state, node)) {
         return nullptr;
     }
 
@@ -99,24 +162,12 @@ Node* AbilityTree::try_activate(const Ref<AbilityNode>& node, Node* character) {
         return nullptr;
     }
 
-    const Ref<Ability> ability = node->get_ability();
-
-    // Search the character's direct children for the matching container.
-    for (int i = 0; i < character->get_child_count(); ++i) {
-        AbilityScriptContainerNode* container =
-            Object::cast_to<AbilityScriptContainerNode>(character->get_child(i));
-
-        if (container == nullptr) {
-            continue;
-        }
-
-        if (container->get_ability() == ability) {
-            container->on_activated();
-            return container;
-        }
+    if (AbilityScriptContainerNode* container = find_container(node->get_ability(), character)) {
+        container->on_activated();
+        return container;
     }
 
-    // Ability unlocked in data but no container found — passive ability.
+    // Ability unlocked in the state but no container found — passive ability.
     return nullptr;
 }
 
@@ -136,4 +187,266 @@ void AbilityTree::deactivate(Node* behavior_node) {
     // The node is part of the character scene — do NOT queue_free().
 }
 
+// ---------------------------------------------------------------------------
+// Compiled graph
+// ---------------------------------------------------------------------------
+
+void AbilityTree::ensure_compiled() {
+    if (!m_graph_dirty) {
+        return;
+    }
+    m_graph.build(m_nodes);
+    m_graph_dirty = false;
+    ++m_graph_revision;
+
+    const PackedStringArray& errors = m_graph.get_errors();
+    for (int i = 0; i < errors.size(); ++i) {
+        UtilityFunctions::push_error("[AbilityTree] ", get_path(), ": ", errors[i]);
+    }
+
+    m_root_nodes.clear();
+    for (const int32_t id : m_graph.roots()) {
+        m_root_nodes.append(m_nodes[id]);
+    }
+
+    m_depth_layers.clear();
+    for (int32_t layer = 0; layer < m_graph.get_layer_count(); ++layer) {
+        Array layer_nodes{};
+        for (const int32_t id : m_graph.layer(layer)) {
+            layer_nodes.append(m_nodes[id]);
+        }
+        m_depth_layers.append(layer_nodes);
+    }
+}
+
+void AbilityTree::on_node_changed() {
+    m_graph_dirty = true;
+    emit_changed();
+}
+
+const AbilityGraph& AbilityTree::get_graph() {
+    ensure_compiled();
+    return m_graph;
+}
+
+int64_t AbilityTree::get_graph_revision() const {
+    return m_graph_revision;
+}
+
+int AbilityTree::get_node_id(const Ref<AbilityNode>& node) {
+    ensure_compiled();
+    return m_graph.find_node(node.ptr());
+}
+
+Ref<AbilityNode> AbilityTree::get_node_by_id(const int id) const {
+    if (id < 0 || id >= m_nodes.size()) {
+        return {};
+    }
+    return m_nodes[id];
+}
+
+// ---------------------------------------------------------------------------
+// Bulk query
+// ---------------------------------------------------------------------------
+
+Dictionary AbilityTree::query_state(const Ref<AbilityState>& state, const float budget) {
+    Dictionary result{};
+    if (state.is_null() || state->get_tree().ptr() != this) {
+        return result;
+    }
+    const AbilityUnlockState* unlock = state->get_unlock_state();
+    if (unlock == nullptr) {
+        return result;
+    }
+    const std::span<const uint8_t> levels = state->levels_view();
+    const int32_t count = m_graph.size();
+
+    PackedInt32Array unlocked{};
+    PackedInt32Array unlockable{};
+    PackedInt32Array affordable{};
+    PackedInt32Array level_column{};
+    PackedFloat32Array next_cost{};
+    unlocked.resize(count);
+    unlockable.resize(count);
+    affordable.resize(count);
+    level_column.resize(count);
+    next_cost.resize(count);
+
+    // Fill through raw pointers: one copy-on-write check per column, not per element.
+    int32_t* unlocked_ptr = unlocked.ptrw();
+    int32_t* unlockable_ptr = unlockable.ptrw();
+    int32_t* affordable_ptr = affordable.ptrw();
+    int32_t* level_ptr = level_column.ptrw();
+    float* cost_ptr = next_cost.ptrw();
+
+    for (int32_t id = 0; id < count; ++id) {
+        const Ref<AbilityNode> node = m_nodes[id];
+        const Ref<Ability> ability = node.is_valid() ? node->get_ability() : Ref<Ability>();
+        const bool is_unlocked = unlock->enabled.test(id);
+        const bool is_unlockable = unlock->unlockable.test(id);
+        const int level = id < static_cast<int32_t>(levels.size()) ? levels[id] : 0;
+
+        float cost = 0.0f;
+        bool purchasable = false;
+        if (ability.is_valid()) {
+            if (!is_unlocked) {
+                cost = ability->get_cost();
+                purchasable = is_unlockable;
+            } else if (level < Ability::IMPROVEMENT_COUNT) {
+                const Ref<AbilityImprovement> improvement = ability->get_improvement(level + 1);
+                cost = improvement.is_valid() ? improvement->get_cost() : 0.0f;
+                purchasable = true;
+            }
+        }
+
+        unlocked_ptr[id] = is_unlocked ? 1 : 0;
+        unlockable_ptr[id] = is_unlockable ? 1 : 0;
+        affordable_ptr[id] = purchasable && cost <= budget ? 1 : 0;
+        level_ptr[id] = level;
+        cost_ptr[id] = cost;
+    }
+
+    result["unlocked"] = unlocked;
+    result["unlockable"] = unlockable;
+    result["affordable"] = affordable;
+    result["level"] = level_column;
+    result["next_cost"] = next_cost;
+    return result;
+}
+
+// ---------------------------------------------------------------------------
+// Container index
+// ---------------------------------------------------------------------------
+
+AbilityScriptContainerNode* AbilityTree::find_container(const Ref<Ability>& ability, Node* character) {
+    if (ability.is_null()) {
+        return nullptr;
+    }
+    return find_container_by_id(ability->get_registry_id(), character);
+}
+
+AbilityScriptContainerNode* AbilityTree::find_container_by_id(const int64_t ability_id, Node* character) {
+    if (ability_id == 0 || character == nullptr) {
+        return nullptr;
+    }
+
+    // Off-tree characters get no invalidation signals, so they are not
+    // indexed: scan their children directly.
+    if (!character->is_inside_tree()) {
+        for (int i = 0; i < character->get_child_count(); ++i) {
+            auto* container = Object::cast_to<AbilityScriptContainerNode>(character->get_child(i));
+            if (container != nullptr && container->get_ability_registry_id() == ability_id) {
+                return container;
+            }
+        }
+        return nullptr;
+    }
+
+    // Two attempts: a hit on a stale index (e.g. a container re-parented
+    // without the signals we watch) triggers one rebuild.
+    for (int attempt = 0; attempt < 2; ++attempt) {
+        ContainerIndex& index = get_container_index(character);
+        const uint64_t* container_id = index.containers_by_ability.getptr(ability_id);
+        if (container_id == nullptr) {
+            return nullptr;
+        }
+        auto* container = Object::cast_to<AbilityScriptContainerNode>(ObjectDB::get_instance(*container_id));
+        if (container != nullptr && container->get_parent() == character && container->get_ability_registry_id() == ability_id) {
+            return container;
+        }
+        index.valid = false;
+    }
+    return nullptr;
+}
+
+int AbilityTree::activate_all_enabled(const Ref<AbilityState>& state, Node* character) {
+    if (state.is_null() || state->get_tree().ptr() != this || character == nullptr) {
+        return 0;
+    }
+
+    int activated = 0;
+    const PackedInt32Array enabled = state->get_enabled_ids();
+    for (int64_t i = 0; i < enabled.size(); ++i) {
+        const Ref<AbilityNode> node = get_node_by_id(enabled[i]);
+        if (node.is_null() || node->get_ability().is_null()) {
+            continue;
+        }
+        AbilityScriptContainerNode* container = find_container(node->get_ability(), character);
+        if (container != nullptr && !container->is_active()) {
+            container->on_activated();
+            ++activated;
+        }
+    }
+    return activated;
+}
+
+AbilityTree::ContainerIndex& AbilityTree::get_container_index(Node* character) {
+    const uint64_t character_id = character->get_instance_id();
+    ContainerIndex* index = m_container_indices.getptr(character_id);
+    if (index == nullptr) {
+        index = &m_container_indices.insert(character_id, ContainerIndex{})->value;
+    }
+
+    // Only called for characters in the tree; on_character_exiting() drops
+    // the index (and the signals) when the character leaves it.
+    if (!index->connected) {
+        character->connect("child_entered_tree", callable_mp(this, &AbilityTree::on_character_child_changed).bind(character_id));
+        character->connect("child_exiting_tree", callable_mp(this, &AbilityTree::on_character_child_changed).bind(character_id));
+        character->connect("tree_exiting", callable_mp(this, &AbilityTree::on_character_exiting).bind(character_id), CONNECT_ONE_SHOT);
+        index->connected = true;
+        index->valid = false;
+    }
+    if (index->valid) {
+        return *index;
+    }
+
+    index->containers_by_ability.clear();
+    const Callable on_ability_changed = callable_mp(this, &AbilityTree::on_container_ability_changed).bind(character_id);
+    for (int i = 0; i < character->get_child_count(); ++i) {
+        auto* container = Object::cast_to<AbilityScriptContainerNode>(character->get_child(i));
+        if (container == nullptr) {
+            continue;
+        }
+        // A container whose ability changes must be re-indexed, or a miss
+        // would never be noticed.
+        if (!container->is_connected("ability_changed", on_ability_changed)) {
+            container->connect("ability_changed", on_ability_changed);
+        }
+        const int64_t ability_id = container->get_ability_registry_id();
+        if (ability_id != 0) {
+            index->containers_by_ability[ability_id] = container->get_instance_id();
+        }
+    }
+    index->valid = true;
+    return *index;
+}
+
+void AbilityTree::on_character_child_changed(Node* child, const uint64_t character_id) {
+    if (Object::cast_to<AbilityScriptContainerNode>(child) == nullptr) {
+        return;
+    }
+    if (ContainerIndex* index = m_container_indices.getptr(character_id)) {
+        index->valid = false;
+    }
+}
+
+void AbilityTree::on_container_ability_changed(const uint64_t character_id) {
+    if (ContainerIndex* index = m_container_indices.getptr(character_id)) {
+        index->valid = false;
+    }
+}
+
+void AbilityTree::on_character_exiting(const uint64_t character_id) {
+    m_container_indices.erase(character_id);
+    if (Node* character = Object::cast_to<Node>(ObjectDB::get_instance(character_id))) {
+        const Callable on_child = callable_mp(this, &AbilityTree::on_character_child_changed).bind(character_id);
+        if (character->is_connected("child_entered_tree", on_child)) {
+            character->disconnect("child_entered_tree", on_child);
+        }
+        if (character->is_connected("child_exiting_tree", on_child)) {
+            character->disconnect("child_exiting_tree", on_child);
+        }
+    }
+}
+
 } // namespace Rebel::Ability
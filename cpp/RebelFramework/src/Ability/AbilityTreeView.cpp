@@ -0,0 +1,577 @@
+// Copyright (c) 2026, and future.
+// Alejandro Morcillo Montejo - All Rights Reserved
+
+#include "Rebel/Ability/AbilityTreeView.hpp"
+
+#include "Rebel/Ability/AbilityIconAtlas.hpp"
+#include "Rebel/Ability/AbilityNode.hpp"
+
+#include <godot_cpp/classes/base_button.hpp>
+#include <godot_cpp/classes/texture_button.hpp>
+#include <godot_cpp/classes/viewport.hpp>
+#include <godot_cpp/core/class_db.hpp>
+#include <godot_cpp/variant/callable_method_pointer.hpp>
+#include <godot_cpp/variant/packed_vector2_array.hpp>
+#include <godot_cpp/variant/utility_functions.hpp>
+
+#include <algorithm>
+#include <cmath>
+
+using namespace godot;
+
+namespace Rebel::Ability {
+
+namespace {
+
+/** Widget meta holding the node id it is bound to. */
+const StringName NODE_ID_META = "ability_node_id";
+
+const Color LOCKED_MODULATE{0.35f, 0.35f, 0.35f, 1.0f};
+const Color UNLOCKABLE_MODULATE{0.75f, 0.75f, 0.75f, 1.0f};
+
+} // namespace
+
+// ---------------------------------------------------------------------------
+// Constructor
+// ---------------------------------------------------------------------------
+
+AbilityTreeView::AbilityTreeView() {
+    // Scrolling moves the view; the transform notification is how it notices.
+    set_notify_transform(true);
+}
+
+// ---------------------------------------------------------------------------
+// _bind_methods
+// ---------------------------------------------------------------------------
+
+void AbilityTreeView::_bind_methods() {
+    ClassDB::bind_method(D_METHOD("refresh"), &AbilityTreeView::refresh);
+    ClassDB::bind_method(D_METHOD("get_widget", "node"), &AbilityTreeView::get_widget);
+    ClassDB::bind_method(D_METHOD("get_node_rect", "node"), &AbilityTreeView::get_node_rect);
+    ClassDB::bind_method(D_METHOD("get_widget_count"), &AbilityTreeView::get_widget_count);
+
+    // --- source ---
+    ClassDB::bind_method(D_METHOD("set_ability_tree", "tree"), &AbilityTreeView::set_ability_tree);
+    ClassDB::bind_method(D_METHOD("get_ability_tree"), &AbilityTreeView::get_ability_tree);
+    ClassDB::bind_method(D_METHOD("set_state", "state"), &AbilityTreeView::set_state);
+    ClassDB::bind_method(D_METHOD("get_state"), &AbilityTreeView::get_state);
+    ClassDB::bind_method(D_METHOD("set_node_scene", "scene"), &AbilityTreeView::set_node_scene);
+    ClassDB::bind_method(D_METHOD("get_node_scene"), &AbilityTreeView::get_node_scene);
+
+    // --- layout ---
+    ClassDB::bind_method(D_METHOD("set_node_size", "size"), &AbilityTreeView::set_node_size);
+    ClassDB::bind_method(D_METHOD("get_node_size"), &AbilityTreeView::get_node_size);
+    ClassDB::bind_method(D_METHOD("set_spacing", "spacing"), &AbilityTreeView::set_spacing);
+    ClassDB::bind_method(D_METHOD("get_spacing"), &AbilityTreeView::get_spacing);
+
+    // --- edges ---
+    ClassDB::bind_method(D_METHOD("set_edge_color", "color"), &AbilityTreeView::set_edge_color);
+    ClassDB::bind_method(D_METHOD("get_edge_color"), &AbilityTreeView::get_edge_color);
+    ClassDB::bind_method(D_METHOD("set_unlocked_edge_color", "color"), &AbilityTreeView::set_unlocked_edge_color);
+    ClassDB::bind_method(D_METHOD("get_unlocked_edge_color"), &AbilityTreeView::get_unlocked_edge_color);
+    ClassDB::bind_method(D_METHOD("set_edge_width", "width"), &AbilityTreeView::set_edge_width);
+    ClassDB::bind_method(D_METHOD("get_edge_width"), &AbilityTreeView::get_edge_width);
+
+    ADD_SIGNAL(MethodInfo("widget_bound",
+                          PropertyInfo(Variant::OBJECT, "widget", PROPERTY_HINT_RESOURCE_TYPE, "Control"),
+                          PropertyInfo(Variant::OBJECT, "node", PROPERTY_HINT_RESOURCE_TYPE, "AbilityNode"),
+                          PropertyInfo(Variant::INT, "node_id")));
+    ADD_SIGNAL(MethodInfo("node_pressed", PropertyInfo(Variant::OBJECT, "node", PROPERTY_HINT_RESOURCE_TYPE, "AbilityNode")));
+
+    ADD_GROUP("AbilityTreeView", "");
+    ADD_PROPERTY(PropertyInfo(Variant::OBJECT, "ability_tree", PROPERTY_HINT_RESOURCE_TYPE, "AbilityTree"),  "set_ability_tree", "get_ability_tree");
+    ADD_PROPERTY(PropertyInfo(Variant::OBJECT, "state",        PROPERTY_HINT_RESOURCE_TYPE, "AbilityState"), "set_state",        "get_state");
+    ADD_PROPERTY(PropertyInfo(Variant::OBJECT, "node_scene",   PROPERTY_HINT_RESOURCE_TYPE, "PackedScene"),  "set_node_scene",   "get_node_scene");
+
+    ADD_GROUP("Layout", "");
+    ADD_PROPERTY(PropertyInfo(Variant::VECTOR2, "node_size"), "set_node_size", "get_node_size");
+    ADD_PROPERTY(PropertyInfo(Variant::VECTOR2, "spacing"),   "set_spacing",   "get_spacing");
+
+    ADD_GROUP("Edges", "");
+    ADD_PROPERTY(PropertyInfo(Variant::COLOR, "edge_color"),                                        "set_edge_color",          "get_edge_color");
+    ADD_PROPERTY(PropertyInfo(Variant::COLOR, "unlocked_edge_color"),                               "set_unlocked_edge_color", "get_unlocked_edge_color");
+    ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "edge_width", PROPERTY_HINT_RANGE, "0.5,16,0.5"),    "set_edge_width",          "get_edge_width");
+}
+
+void AbilityTreeView::_notification(const int p_what) {
+    switch (p_what) {
+        case NOTIFICATION_ENTER_TREE:
+        case NOTIFICATION_VISIBILITY_CHANGED:
+            m_dirty = true;
+            queue_refresh();
+            break;
+        case NOTIFICATION_TRANSFORM_CHANGED:
+        case NOTIFICATION_RESIZED:
+            // Usually a scroll; refresh() returns early while the bound region still covers the screen.
+            queue_refresh();
+            break;
+        default:
+            break;
+    }
+}
+
+// ---------------------------------------------------------------------------
+// Setters / getters
+// ---------------------------------------------------------------------------
+
+void AbilityTreeView::set_ability_tree(const Ref<AbilityTree>& tree) {
+    if (tree == m_tree) {
+        return;
+    }
+    const Callable on_changed = callable_mp(this, &AbilityTreeView::on_source_changed);
+    if (m_tree.is_valid() && m_tree->is_connected("changed", on_changed)) {
+        m_tree->disconnect("changed", on_changed);
+    }
+    m_tree = tree;
+    if (m_tree.is_valid()) {
+        m_tree->connect("changed", on_changed);
+    }
+    // Node ids mean nothing across trees.
+    release_all_widgets();
+    m_layout_revision = -1;
+    on_source_changed();
+}
+
+Ref<AbilityTree> AbilityTreeView::get_ability_tree() const {
+    return m_tree;
+}
+
+void AbilityTreeView::set_state(const Ref<AbilityState>& state) {
+    if (state == m_state) {
+        return;
+    }
+    const Callable on_changed = callable_mp(this, &AbilityTreeView::on_source_changed);
+    if (m_state.is_valid() && m_state->is_connected("changed", on_changed)) {
+        m_state->disconnect("changed", on_changed);
+    }
+    m_state = state;
+    if (m_state.is_valid()) {
+        m_state->connect("changed", on_changed);
+    }
+    on_source_changed();
+}
+
+Ref<AbilityState> AbilityTreeView::get_state() const {
+    return m_state;
+}
+
+void AbilityTreeView::set_node_scene(const Ref<PackedScene>& scene) {
+    m_node_scene = scene;
+    // Pooled widgets were instanced from the old scene.
+    release_all_widgets();
+    for (Control* widget : m_free_widgets) {
+        widget->queue_free();
+    }
+    m_widget_count -= static_cast<int>(m_free_widgets.size());
+    m_free_widgets.clear();
+    on_source_changed();
+}
+
+Ref<PackedScene> AbilityTreeView::get_node_scene() const {
+    return m_node_scene;
+}
+
+void AbilityTreeView::set_node_size(const Vector2& size) {
+    m_node_size = Vector2(Math::max(1.0f, size.x), Math::max(1.0f, size.y));
+    m_layout_revision = -1;
+    on_source_changed();
+}
+
+Vector2 AbilityTreeView::get_node_size() const {
+    return m_node_size;
+}
+
+void AbilityTreeView::set_spacing(const Vector2& spacing) {
+    m_spacing = Vector2(Math::max(0.0f, spacing.x), Math::max(0.0f, spacing.y));
+    m_layout_revision = -1;
+    on_source_changed();
+}
+
+Vector2 AbilityTreeView::get_spacing() const {
+    return m_spacing;
+}
+
+void AbilityTreeView::set_edge_color(const Color& color) {
+    m_edge_color = color;
+    queue_redraw();
+}
+
+Color AbilityTreeView::get_edge_color() const {
+    return m_edge_color;
+}
+
+void AbilityTreeView::set_unlocked_edge_color(const Color& color) {
+    m_unlocked_edge_color = color;
+    queue_redraw();
+}
+
+Color AbilityTreeView::get_unlocked_edge_color() const {
+    return m_unlocked_edge_color;
+}
+
+void AbilityTreeView::set_edge_width(const float width) {
+    m_edge_width = Math::max(0.5f, width);
+    queue_redraw();
+}
+
+float AbilityTreeView::get_edge_width() const {
+    return m_edge_width;
+}
+
+Control* AbilityTreeView::get_widget(const Ref<AbilityNode>& node) const {
+    if (node.is_null() || m_tree.is_null() || m_layout_revision != m_tree->get_graph_revision()) {
+        return nullptr;
+    }
+    const int32_t id = m_tree->get_graph().find_node(node.ptr());
+    return id >= 0 && id < static_cast<int32_t>(m_widget_by_node.size()) ? m_widget_by_node[id] : nullptr;
+}
+
+Rect2 AbilityTreeView::get_node_rect(const Ref<AbilityNode>& node) {
+    if (node.is_null() || m_tree.is_null()) {
+        return {};
+    }
+    update_layout();
+    const int32_t id = m_tree->get_graph().find_node(node.ptr());
+    if (id < 0 || id >= static_cast<int32_t>(m_laid_out.size()) || !m_laid_out[id]) {
+        return {};
+    }
+    return {m_positions[id], m_node_size};
+}
+
+int AbilityTreeView::get_widget_count() const {
+    return m_widget_count;
+}
+
+// ---------------------------------------------------------------------------
+// Refresh
+// ---------------------------------------------------------------------------
+
+void AbilityTreeView::queue_refresh() {
+    if (m_refresh_queued || !is_inside_tree()) {
+        return;
+    }
+    m_refresh_queued = true;
+    callable_mp(this, &AbilityTreeView::refresh).call_deferred();
+}
+
+void AbilityTreeView::on_source_changed() {
+    m_dirty = true;
+    queue_refresh();
+}
+
+void AbilityTreeView::refresh() {
+    m_refresh_queued = false;
+    if (!is_inside_tree()) {
+        return;
+    }
+    update_layout();
+
+    const Rect2 visible = get_visible_region();
+    if (!m_dirty && m_bound_region.encloses(visible)) {
+        return;
+    }
+    // Bind a margin of about one node around the screen so small scrolls
+    // neither rebind widgets nor redraw edges.
+    m_bound_region = visible.grow(Math::max(m_node_size.x, m_node_size.y) + Math::max(m_spacing.x, m_spacing.y));
+    m_dirty = false;
+    update_widgets();
+    queue_redraw();
+}
+
+// ---------------------------------------------------------------------------
+// Layout
+// ---------------------------------------------------------------------------
+
+void AbilityTreeView::update_layout() {
+    if (m_tree.is_null()) {
+        if (m_layout_revision != -1 || !m_positions.empty()) {
+            m_positions.clear();
+            m_laid_out.clear();
+            m_edge_floor.clear();
+            m_layout_revision = -1;
+            set_custom_minimum_size(Vector2());
+        }
+        return;
+    }
+    const AbilityGraph& graph = m_tree->get_graph();
+    if (m_layout_revision == m_tree->get_graph_revision()) {
+        return;
+    }
+
+    // The graph was rebuilt; ids may now point at other nodes.
+    release_all_widgets();
+
+    const int32_t size = graph.size();
+    m_positions.assign(size, Vector2());
+    m_laid_out.assign(size, 0);
+    m_widget_by_node.assign(size, nullptr);
+
+    const Vector2 pitch = m_node_size + m_spacing;
+    const int32_t layer_count = graph.get_layer_count();
+    size_t widest = 0;
+    for (int32_t layer = 0; layer < layer_count; ++layer) {
+        widest = std::max(widest, graph.layer(layer).size());
+    }
+    const float content_width = widest > 0 ? static_cast<float>(widest) * pitch.x - m_spacing.x : 0.0f;
+
+    for (int32_t layer = 0; layer < layer_count; ++layer) {
+        const std::span<const int32_t> ids = graph.layer(layer);
+        const float row_width = static_cast<float>(ids.size()) * pitch.x - m_spacing.x;
+        // Rows are centred; every row keeps x increasing in list order, which update_widgets() relies on.
+        const float x0 = (content_width - row_width) * 0.5f;
+        for (size_t i = 0; i < ids.size(); ++i) {
+            m_positions[ids[i]] = Vector2(x0 + static_cast<float>(i) * pitch.x, static_cast<float>(layer) * pitch.y);
+            m_laid_out[ids[i]] = 1;
+        }
+    }
+
+    // Topmost prerequisite layer per layer, then carried up from the bottom
+    // so m_edge_floor[L] covers every edge ending at L or below.
+    m_edge_floor.resize(layer_count);
+    for (int32_t layer = 0; layer < layer_count; ++layer) {
+        m_edge_floor[layer] = layer;
+        for (const int32_t id : graph.layer(layer)) {
+            for (const int32_t prerequisite : graph.prerequisites(id)) {
+                if (m_laid_out[prerequisite]) {
+                    m_edge_floor[layer] = std::min(m_edge_floor[layer], graph.get_depth(prerequisite));
+                }
+            }
+        }
+    }
+    for (int32_t layer = layer_count - 2; layer >= 0; --layer) {
+        m_edge_floor[layer] = std::min(m_edge_floor[layer], m_edge_floor[layer + 1]);
+    }
+
+    const float content_height = layer_count > 0 ? static_cast<float>(layer_count) * pitch.y - m_spacing.y : 0.0f;
+    set_custom_minimum_size(Vector2(content_width, content_height));
+    m_layout_revision = m_tree->get_graph_revision();
+    m_dirty = true;
+}
+
+Rect2 AbilityTreeView::get_visible_region() const {
+    // The nearest clipping ancestor (a ScrollContainer, a panel with
+    // clip_contents) bounds what can be seen; the viewport bounds the rest.
+    Rect2 global_region{};
+    bool clipped = false;
+    for (Node* parent = get_parent(); parent != nullptr; parent = parent->get_parent()) {
+        const Control* control = Object::cast_to<Control>(parent);
+        if (control != nullptr && control->is_clipping_contents()) {
+            global_region = control->get_global_rect();
+            clipped = true;
+            break;
+        }
+    }
+    if (!clipped) {
+        global_region = get_canvas_transform().affine_inverse().xform(get_viewport_rect());
+    }
+    return get_global_transform().affine_inverse().xform(global_region);
+}
+
+// ---------------------------------------------------------------------------
+// Widgets
+// ---------------------------------------------------------------------------
+
+void AbilityTreeView::update_widgets() {
+    if (m_tree.is_null() || !is_visible_in_tree()) {
+        release_all_widgets();
+        return;
+    }
+    const AbilityGraph& graph = m_tree->get_graph();
+    const Vector2 pitch = m_node_size + m_spacing;
+    const Rect2& region = m_bound_region;
+
+    // Collect the visible ids: a row range from y, then a binary search on x per row.
+    std::vector<int32_t> visible{};
+    const int32_t layer_count = graph.get_layer_count();
+    const auto first_layer = static_cast<int32_t>(Math::max(0.0f, std::floor((region.position.y - m_node_size.y) / pitch.y)));
+    const auto last_layer = static_cast<int32_t>(Math::min(static_cast<float>(layer_count - 1), std::floor(region.get_end().y / pitch.y)));
+    for (int32_t layer = first_layer; layer <= last_layer; ++layer) {
+        const std::span<const int32_t> ids = graph.layer(layer);
+        auto it = std::lower_bound(ids.begin(), ids.end(), region.position.x, [&](const int32_t id, const float x) {
+            return m_positions[id].x + m_node_size.x <= x;
+        });
+        for (; it != ids.end() && m_positions[*it].x < region.get_end().x; ++it) {
+            visible.push_back(*it);
+        }
+    }
+    std::sort(visible.begin(), visible.end());
+
+    // Release the widgets that scrolled out, keeping the rest bound.
+    std::vector<int32_t> kept{};
+    for (const int32_t id : m_bound_ids) {
+        if (std::binary_search(visible.begin(), visible.end(), id)) {
+            kept.push_back(id);
+        } else {
+            release_widget(m_widget_by_node[id]);
+            m_widget_by_node[id] = nullptr;
+        }
+    }
+
+    // Bind the new ones, and rebind the kept ones so they show the current state.
+    m_bound_ids.clear();
+    for (const int32_t id : visible) {
+        Control* widget = m_widget_by_node[id];
+        if (widget == nullptr) {
+            widget = acquire_widget();
+            if (widget == nullptr) {
+                continue;
+            }
+            m_widget_by_node[id] = widget;
+        }
+        bind_widget(widget, id);
+        m_bound_ids.push_back(id);
+    }
+}
+
+Control* AbilityTreeView::acquire_widget() {
+    if (!m_free_widgets.empty()) {
+        Control* widget = m_free_widgets.back();
+        m_free_widgets.pop_back();
+        return widget;
+    }
+
+    Control* widget = nullptr;
+    if (m_node_scene.is_valid()) {
+        Node* instance = m_node_scene->instantiate();
+        widget = Object::cast_to<Control>(instance);
+        if (widget == nullptr) {
+            if (instance != nullptr) {
+                memdelete(instance);
+            }
+            UtilityFunctions::push_error("[AbilityTreeView] node_scene must have a Control root: ", m_node_scene->get_path());
+            return nullptr;
+        }
+    } else {
+        TextureButton* button = memnew(TextureButton);
+        button->set_ignore_texture_size(true);
+        button->set_stretch_mode(TextureButton::STRETCH_KEEP_ASPECT_CENTERED);
+        widget = button;
+    }
+
+    if (BaseButton* button = Object::cast_to<BaseButton>(widget)) {
+        button->connect("pressed", callable_mp(this, &AbilityTreeView::on_widget_pressed).bind(widget));
+    }
+    // Internal: the pool is not part of the scene and is never saved with it.
+    add_child(widget, false, INTERNAL_MODE_BACK);
+    ++m_widget_count;
+    return widget;
+}
+
+void AbilityTreeView::release_widget(Control* widget) {
+    widget->hide();
+    widget->set_meta(NODE_ID_META, -1);
+    m_free_widgets.push_back(widget);
+}
+
+void AbilityTreeView::release_all_widgets() {
+    for (const int32_t id : m_bound_ids) {
+        release_widget(m_widget_by_node[id]);
+        m_widget_by_node[id] = nullptr;
+    }
+    m_bound_ids.clear();
+    m_dirty = true;
+}
+
+void AbilityTreeView::bind_widget(Control* widget, const int32_t id) {
+    const Ref<AbilityNode> node = m_tree->get_nodes()[id];
+    widget->set_position(m_positions[id]);
+    widget->set_size(m_node_size);
+    widget->set_meta(NODE_ID_META, id);
+
+    const AbilityUnlockState* unlock = get_unlock_state();
+    const bool enabled = unlock != nullptr && unlock->enabled.test(id);
+    const bool unlockable = unlock != nullptr && unlock->unlockable.test(id);
+
+    if (m_node_scene.is_null()) {
+        auto* button = Object::cast_to<TextureButton>(widget);
+        const Ref<Ability> ability = node.is_valid() ? node->get_ability() : Ref<Ability>();
+        Ref<Texture2D> icon{};
+        if (ability.is_valid()) {
+            const int level = enabled ? m_state->levels_view()[id] : 0;
+            const Ref<AbilityIconAtlas> atlas = m_tree->get_icon_atlas();
+            if (atlas.is_valid()) {
+                icon = atlas->get_icon(ability, level);
+            }
+            if (icon.is_null()) {
+                icon = ability->get_icon();
+            }
+        }
+        button->set_texture_normal(icon);
+        button->set_tooltip_text(ability.is_valid() ? ability->get_name() : String());
+        button->set_modulate(enabled ? Color(1, 1, 1, 1) : unlockable ? UNLOCKABLE_MODULATE : LOCKED_MODULATE);
+    }
+    widget->show();
+    emit_signal("widget_bound", widget, node, id);
+}
+
+void AbilityTreeView::on_widget_pressed(Control* widget) {
+    const int32_t id = widget->get_meta(NODE_ID_META, -1);
+    if (m_tree.is_null() || id < 0 || id >= m_tree->get_nodes().size()) {
+        return;
+    }
+    emit_signal("node_pressed", m_tree->get_nodes()[id]);
+}
+
+const AbilityUnlockState* AbilityTreeView::get_unlock_state() {
+    if (m_state.is_null() || m_state->get_tree() != m_tree) {
+        return nullptr;
+    }
+    return m_state->get_unlock_state();
+}
+
+// ---------------------------------------------------------------------------
+// Drawing
+// ---------------------------------------------------------------------------
+
+void AbilityTreeView::_draw() {
+    if (m_tree.is_null() || m_layout_revision != m_tree->get_graph_revision()) {
+        return;
+    }
+    const AbilityGraph& graph = m_tree->get_graph();
+    const AbilityUnlockState* unlock = get_unlock_state();
+    const Rect2& region = m_bound_region;
+    const float half_width = m_node_size.x * 0.5f;
+
+    // Edges run from the bottom of a prerequisite down to the top of its
+    // dependent. One that crosses the region ends at or below the first
+    // visible row and starts at or above the last one, so only the rows from
+    // that end's edge floor down to the last visible row are walked.
+    PackedVector2Array locked{};
+    PackedVector2Array unlocked{};
+    const Vector2 pitch = m_node_size + m_spacing;
+    const int32_t layer_count = graph.get_layer_count();
+    const auto first_layer = static_cast<int32_t>(Math::max(0.0f, std::floor(region.position.y / pitch.y)));
+    const auto last_layer = std::min(layer_count - 1, static_cast<int32_t>(std::floor(region.get_end().y / pitch.y)));
+    if (first_layer >= layer_count || last_layer < 0) {
+        return;
+    }
+    for (int32_t layer = m_edge_floor[first_layer]; layer <= last_layer; ++layer) {
+        for (const int32_t id : graph.layer(layer)) {
+            const Vector2 from = m_positions[id] + Vector2(half_width, m_node_size.y);
+            for (const int32_t dependent : graph.dependents(id)) {
+                if (!m_laid_out[dependent] || graph.get_depth(dependent) < first_layer) {
+                    continue;
+                }
+                const Vector2 to = m_positions[dependent] + Vector2(half_width, 0.0f);
+                Rect2 bounds(from, Vector2());
+                bounds.expand_to(to);
+                if (!region.intersects(bounds, true)) {
+                    continue;
+                }
+                const bool lit = unlock != nullptr && unlock->enabled.test(id) && unlock->enabled.test(dependent);
+                PackedVector2Array& lines = lit ? unlocked : locked;
+                lines.push_back(from);
+                lines.push_back(to);
+            }
+        }
+    }
+
+    if (!locked.is_empty()) {
+        draw_multiline(locked, m_edge_color, m_edge_width);
+    }
+    if (!unlocked.is_empty()) {
+        draw_multiline(unlocked, m_unlocked_edge_color, m_edge_width);
+    }
+}
+
+} // namespace Rebel::Ability
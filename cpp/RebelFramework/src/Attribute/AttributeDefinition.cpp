@@ -0,0 +1,114 @@
+// Copyright (c) 2026, and future.
+// Alejandro Morcillo Montejo - All Rights Reserved
+
+#include "Rebel/Attribute/AttributeDefinition.hpp"
+
+#include <godot_cpp/core/class_db.hpp>
+
+using namespace godot;
+
+namespace Rebel::Attribute {
+
+void AttributeDefinition::_bind_methods() {
+    // --- attribute_name ---
+    ClassDB::bind_method(D_METHOD("set_attribute_name", "name"), &AttributeDefinition::set_attribute_name);
+    ClassDB::bind_method(D_METHOD("get_attribute_name"), &AttributeDefinition::get_attribute_name);
+
+    // --- base_value ---
+    ClassDB::bind_method(D_METHOD("set_base_value", "value"), &AttributeDefinition::set_base_value);
+    ClassDB::bind_method(D_METHOD("get_base_value"), &AttributeDefinition::get_base_value);
+
+    // --- sources ---
+    ClassDB::bind_method(D_METHOD("set_sources", "sources"), &AttributeDefinition::set_sources);
+    ClassDB::bind_method(D_METHOD("get_sources"), &AttributeDefinition::get_sources);
+
+    // --- coefficients ---
+    ClassDB::bind_method(D_METHOD("set_coefficients", "coefficients"), &AttributeDefinition::set_coefficients);
+    ClassDB::bind_method(D_METHOD("get_coefficients"), &AttributeDefinition::get_coefficients);
+
+    // --- bounds ---
+    ClassDB::bind_method(D_METHOD("set_min_value", "value"), &AttributeDefinition::set_min_value);
+    ClassDB::bind_method(D_METHOD("get_min_value"), &AttributeDefinition::get_min_value);
+    ClassDB::bind_method(D_METHOD("set_max_value", "value"), &AttributeDefinition::set_max_value);
+    ClassDB::bind_method(D_METHOD("get_max_value"), &AttributeDefinition::get_max_value);
+
+    ADD_GROUP("Attribute", "");
+    ADD_PROPERTY(PropertyInfo(Variant::STRING_NAME,          "attribute_name"), "set_attribute_name", "get_attribute_name");
+    ADD_PROPERTY(PropertyInfo(Variant::FLOAT,                "base_value"),     "set_base_value",     "get_base_value");
+    ADD_PROPERTY(PropertyInfo(Variant::FLOAT,                "min_value"),      "set_min_value",      "get_min_value");
+    ADD_PROPERTY(PropertyInfo(Variant::FLOAT,                "max_value"),      "set_max_value",      "get_max_value");
+
+    ADD_GROUP("Derivation", "");
+    ADD_PROPERTY(PropertyInfo(Variant::PACKED_STRING_ARRAY,  "sources"),        "set_sources",        "get_sources");
+    ADD_PROPERTY(PropertyInfo(Variant::PACKED_FLOAT32_ARRAY, "coefficients"),   "set_coefficients",   "get_coefficients");
+}
+
+// --- attribute_name ---
+
+void AttributeDefinition::set_attribute_name(const StringName& name) {
+    m_attribute_name = name;
+    emit_changed();
+}
+
+StringName AttributeDefinition::get_attribute_name() const {
+    return m_attribute_name;
+}
+
+// --- base_value ---
+
+void AttributeDefinition::set_base_value(const float value) {
+    m_base_value = value;
+    emit_changed();
+}
+
+float AttributeDefinition::get_base_value() const {
+    return m_base_value;
+}
+
+// --- sources ---
+
+void AttributeDefinition::set_sources(const PackedStringArray& sources) {
+    m_sources = sources;
+    emit_changed();
+}
+
+PackedStringArray AttributeDefinition::get_sources() const {
+    return m_sources;
+}
+
+// --- coefficients ---
+
+void AttributeDefinition::set_coefficients(const PackedFloat32Array& coefficients) {
+    m_coefficients = coefficients;
+    emit_changed();
+}
+
+PackedFloat32Array AttributeDefinition::get_coefficients() const {
+    return m_coefficients;
+}
+
+float AttributeDefinition::get_coefficient(const int index) const {
+    return index >= 0 && index < m_coefficients.size() ? m_coefficients[index] : 1.0f;
+}
+
+// --- bounds ---
+
+void AttributeDefinition::set_min_value(const float value) {
+    m_min_value = value;
+    emit_changed();
+}
+
+float AttributeDefinition::get_min_value() const {
+    return m_min_value;
+}
+
+void AttributeDefinition::set_max_value(const float value) {
+    m_max_value = value;
+    emit_changed();
+}
+
+float AttributeDefinition::get_max_value() const {
+    return m_max_value;
+}
+
+} // namespace Rebel::Attribute
@@ -0,0 +1,319 @@
+// Copyright (c) 2026, and future.
+// Alejandro Morcillo Montejo - All Rights Reserved
+
+#include "Rebel/Attribute/AttributeSet.hpp"
+
+#include <godot_cpp/core/class_db.hpp>
+#include <godot_cpp/variant/callable_method_pointer.hpp>
+#include <godot_cpp/variant/utility_functions.hpp>
+
+using namespace godot;
+
+namespace Rebel::Attribute {
+
+// ---------------------------------------------------------------------------
+// _bind_methods
+// ---------------------------------------------------------------------------
+
+void AttributeSet::_bind_methods() {
+    // --- definitions ---
+    ClassDB::bind_method(D_METHOD("set_definitions", "definitions"), &AttributeSet::set_definitions);
+    ClassDB::bind_method(D_METHOD("get_definitions"), &AttributeSet::get_definitions);
+
+    // --- values ---
+    ClassDB::bind_method(D_METHOD("compile"), &AttributeSet::compile);
+    ClassDB::bind_method(D_METHOD("get_attribute_index", "name"), &AttributeSet::get_attribute_index);
+    ClassDB::bind_method(D_METHOD("get_value", "name"), &AttributeSet::get_value);
+    ClassDB::bind_method(D_METHOD("get_base_value", "name"), &AttributeSet::get_base_value);
+    ClassDB::bind_method(D_METHOD("set_base_value", "name", "value"), &AttributeSet::set_base_value);
+    ClassDB::bind_method(D_METHOD("add_base_value", "name", "delta"), &AttributeSet::add_base_value);
+    ClassDB::bind_method(D_METHOD("get_values"), &AttributeSet::get_values);
+    ClassDB::bind_method(D_METHOD("get_attribute_names"), &AttributeSet::get_attribute_names);
+    ClassDB::bind_method(D_METHOD("reset"), &AttributeSet::reset);
+
+    ADD_SIGNAL(MethodInfo("attributes_changed", PropertyInfo(Variant::PACKED_INT32_ARRAY, "indices")));
+
+    ADD_GROUP("AttributeSet", "");
+    ADD_PROPERTY(PropertyInfo(Variant::ARRAY, "definitions",
+                              PROPERTY_HINT_ARRAY_TYPE, "AttributeDefinition"),
+                 "set_definitions", "get_definitions");
+}
+
+// ---------------------------------------------------------------------------
+// Setters / getters
+// ---------------------------------------------------------------------------
+
+void AttributeSet::set_definitions(const Array& definitions) {
+    const Callable on_changed = callable_mp(this, &AttributeSet::on_definition_changed);
+    for (int i = 0; i < m_definitions.size(); ++i) {
+        const Ref<AttributeDefinition> definition = m_definitions[i];
+        if (definition.is_valid() && definition->is_connected("changed", on_changed)) {
+            definition->disconnect("changed", on_changed);
+        }
+    }
+
+    m_definitions = definitions;
+
+    for (int i = 0; i < m_definitions.size(); ++i) {
+        const Ref<AttributeDefinition> definition = m_definitions[i];
+        if (definition.is_valid() && !definition->is_connected("changed", on_changed)) {
+            definition->connect("changed", on_changed);
+        }
+    }
+    m_compiled = false;
+    emit_changed();
+}
+
+Array AttributeSet::get_definitions() const {
+    return m_definitions;
+}
+
+void AttributeSet::on_definition_changed() {
+    m_compiled = false;
+    emit_changed();
+}
+
+// ---------------------------------------------------------------------------
+// compile
+// ---------------------------------------------------------------------------
+
+void AttributeSet::compile() {
+    compile_graph(true);
+}
+
+void AttributeSet::compile_graph(const bool keep_base_values) {
+    const auto count = static_cast<int32_t>(m_definitions.size());
+
+    // Runtime changes to base values survive a recompile, matched by name;
+    // attributes that were never changed pick up their new authored value.
+    HashMap<StringName, float> runtime_base_values{};
+    if (keep_base_values) {
+        for (const KeyValue<StringName, int32_t>& entry : m_index_by_name) {
+            const int32_t index = entry.value;
+            if (m_base_values[index] != m_authored_base_values[index]) {
+                runtime_base_values[entry.key] = m_base_values[index];
+            }
+        }
+    }
+
+    m_index_by_name.clear();
+    for (int32_t i = 0; i < count; ++i) {
+        const Ref<AttributeDefinition> definition = m_definitions[i];
+        if (definition.is_null()) {
+            continue;
+        }
+        const StringName name = definition->get_attribute_name();
+        if (m_index_by_name.has(name)) {
+            UtilityFunctions::push_error("[AttributeSet] Duplicate attribute '", name, "'; only the first definition is used.");
+            continue;
+        }
+        m_index_by_name[name] = i;
+    }
+
+    // Resolve sources into a CSR list of (index, coefficient).
+    m_source_offsets.assign(count + 1, 0);
+    m_source_ids.clear();
+    m_source_coefficients.clear();
+    m_min_values.assign(count, 0.0f);
+    m_max_values.assign(count, 0.0f);
+    m_base_values.assign(count, 0.0f);
+    m_authored_base_values.assign(count, 0.0f);
+    std::vector<int32_t> in_degree(count, 0);
+    std::vector<int32_t> out_degree(count, 0);
+
+    for (int32_t i = 0; i < count; ++i) {
+        m_source_offsets[i] = static_cast<int32_t>(m_source_ids.size());
+        const Ref<AttributeDefinition> definition = m_definitions[i];
+        if (definition.is_null()) {
+            continue;
+        }
+        m_authored_base_values[i] = definition->get_base_value();
+        const float* runtime_base = runtime_base_values.getptr(definition->get_attribute_name());
+        m_base_values[i] = runtime_base != nullptr ? *runtime_base : m_authored_base_values[i];
+        m_min_values[i] = definition->get_min_value();
+        m_max_values[i] = definition->get_max_value();
+
+        const PackedStringArray sources = definition->get_sources();
+        for (int s = 0; s < sources.size(); ++s) {
+            const int32_t* source = m_index_by_name.getptr(StringName(sources[s]));
+            if (source == nullptr) {
+                UtilityFunctions::push_error("[AttributeSet] '", definition->get_attribute_name(), "' reads unknown attribute '", sources[s], "'.");
+                continue;
+            }
+            m_source_ids.push_back(*source);
+            m_source_coefficients.push_back(definition->get_coefficient(s));
+            ++in_degree[i];
+            ++out_degree[*source];
+        }
+    }
+    m_source_offsets[count] = static_cast<int32_t>(m_source_ids.size());
+
+    // Invert into a dependents CSR list.
+    m_dependent_offsets.assign(count + 1, 0);
+    for (int32_t i = 0; i < count; ++i) {
+        m_dependent_offsets[i + 1] = m_dependent_offsets[i] + out_degree[i];
+    }
+    m_dependent_ids.assign(m_source_ids.size(), 0);
+    std::vector<int32_t> cursor(m_dependent_offsets.begin(), m_dependent_offsets.end() - 1);
+    for (int32_t i = 0; i < count; ++i) {
+        for (int32_t e = m_source_offsets[i]; e < m_source_offsets[i + 1]; ++e) {
+            m_dependent_ids[cursor[m_source_ids[e]]++] = i;
+        }
+    }
+
+    // Kahn's algorithm; whatever is left over sits on a cycle.
+    m_eval_order.clear();
+    m_eval_order.reserve(count);
+    for (int32_t i = 0; i < count; ++i) {
+        if (in_degree[i] == 0) {
+            m_eval_order.push_back(i);
+        }
+    }
+    for (size_t head = 0; head < m_eval_order.size(); ++head) {
+        const int32_t current = m_eval_order[head];
+        for (int32_t e = m_dependent_offsets[current]; e < m_dependent_offsets[current + 1]; ++e) {
+            if (--in_degree[m_dependent_ids[e]] == 0) {
+                m_eval_order.push_back(m_dependent_ids[e]);
+            }
+        }
+    }
+    m_cycle_begin = static_cast<int32_t>(m_eval_order.size());
+    if (m_cycle_begin < count) {
+        for (int32_t i = 0; i < count; ++i) {
+            if (in_degree[i] > 0) {
+                const Ref<AttributeDefinition> definition = m_definitions[i];
+                UtilityFunctions::push_error("[AttributeSet] '", definition->get_attribute_name(), "' is part of a dependency cycle; its sources are evaluated as-is.");
+                m_eval_order.push_back(i);
+            }
+        }
+    }
+
+    m_rank.assign(count, 0);
+    for (int32_t r = 0; r < count; ++r) {
+        m_rank[m_eval_order[r]] = r;
+    }
+
+    m_pending.assign(count, 0);
+    m_values.resize(count);
+    m_values.fill(0.0f);
+    m_compiled = true;
+
+    for (const int32_t index : m_eval_order) {
+        m_values.set(index, evaluate(index));
+    }
+}
+
+void AttributeSet::ensure_compiled() {
+    if (!m_compiled) {
+        compile();
+    }
+}
+
+float AttributeSet::evaluate(const int32_t index) const {
+    const float* values = m_values.ptr();
+    float result = m_base_values[index];
+    for (int32_t e = m_source_offsets[index]; e < m_source_offsets[index + 1]; ++e) {
+        result += m_source_coefficients[e] * values[m_source_ids[e]];
+    }
+    return Math::clamp(result, m_min_values[index], m_max_values[index]);
+}
+
+// ---------------------------------------------------------------------------
+// Values
+// ---------------------------------------------------------------------------
+
+int AttributeSet::get_attribute_index(const StringName& name) {
+    ensure_compiled();
+    const int32_t* index = m_index_by_name.getptr(name);
+    return index != nullptr ? *index : -1;
+}
+
+float AttributeSet::get_value(const StringName& name) {
+    const int index = get_attribute_index(name);
+    return index >= 0 ? m_values[index] : 0.0f;
+}
+
+float AttributeSet::get_base_value(const StringName& name) {
+    const int index = get_attribute_index(name);
+    return index >= 0 ? m_base_values[index] : 0.0f;
+}
+
+void AttributeSet::set_base_value(const StringName& name, const float value) {
+    const int index = get_attribute_index(name);
+    if (index < 0) {
+        UtilityFunctions::push_warning("[AttributeSet] Unknown attribute '", name, "'.");
+        return;
+    }
+    if (m_base_values[index] == value) {
+        return;
+    }
+    m_base_values[index] = value;
+
+    // Walk the evaluation list from the changed attribute onwards; only
+    // attributes flagged by an upstream change are recomputed.
+    PackedInt32Array changed{};
+    float* values = m_values.ptrw();
+    m_pending[index] = 1;
+    const auto count = static_cast<int32_t>(m_eval_order.size());
+    for (int32_t r = m_rank[index]; r < count; ++r) {
+        const int32_t current = m_eval_order[r];
+        if (!m_pending[current]) {
+            continue;
+        }
+        m_pending[current] = 0;
+
+        const float updated = evaluate(current);
+        if (updated == values[current]) {
+            continue;
+        }
+        values[current] = updated;
+        changed.push_back(current);
+        for (int32_t e = m_dependent_offsets[current]; e < m_dependent_offsets[current + 1]; ++e) {
+            m_pending[m_dependent_ids[e]] = 1;
+        }
+    }
+
+    // Cycle members sit after the topological order and may flag members
+    // the walk has already passed; drop those flags so they do not leak
+    // into the next change.
+    for (int32_t r = m_cycle_begin; r < count; ++r) {
+        m_pending[m_eval_order[r]] = 0;
+    }
+
+    if (!changed.is_empty()) {
+        emit_signal("attributes_changed", changed);
+    }
+}
+
+void AttributeSet::add_base_value(const StringName& name, const float delta) {
+    set_base_value(name, get_base_value(name) + delta);
+}
+
+PackedFloat32Array AttributeSet::get_values() {
+    ensure_compiled();
+    return m_values;
+}
+
+PackedStringArray AttributeSet::get_attribute_names() {
+    PackedStringArray names{};
+    names.resize(m_definitions.size());
+    for (int i = 0; i < m_definitions.size(); ++i) {
+        const Ref<AttributeDefinition> definition = m_definitions[i];
+        if (definition.is_valid()) {
+            names.set(i, definition->get_attribute_name());
+        }
+    }
+    return names;
+}
+
+void AttributeSet::reset() {
+    compile_graph(false);
+    PackedInt32Array all{};
+    all.resize(static_cast<int64_t>(m_eval_order.size()));
+    for (int32_t i = 0; i < all.size(); ++i) {
+        all.set(i, i);
+    }
+    emit_signal("attributes_changed", all);
+}
+
+} // namespace Rebel::Attribute
@@ -68,15 +68,39 @@ namespace Rebel::CharacterBody {
         ClassDB::bind_method(D_METHOD("set_custom_gravity_magnitude", "magnitude"), &BaseCharacterBody3D::set_custom_gravity_magnitude);
         ClassDB::bind_method(D_METHOD("get_custom_gravity_magnitude"), &BaseCharacterBody3D::get_custom_gravity_magnitude);
 
+        // Bind modifier methods
+        ClassDB::bind_method(D_METHOD("add_modifier", "stat", "op", "value", "duration", "source"), &BaseCharacterBody3D::add_modifier, DEFVAL(0.0f), DEFVAL(StringName()));
+        ClassDB::bind_method(D_METHOD("remove_modifier", "id"), &BaseCharacterBody3D::remove_modifier);
+        ClassDB::bind_method(D_METHOD("remove_modifiers_from_source", "source"), &BaseCharacterBody3D::remove_modifiers_from_source);
+        ClassDB::bind_method(D_METHOD("clear_modifiers"), &BaseCharacterBody3D::clear_modifiers);
+        ClassDB::bind_method(D_METHOD("get_modifier_count", "stat"), &BaseCharacterBody3D::get_modifier_count);
+        ClassDB::bind_method(D_METHOD("get_stat", "stat"), &BaseCharacterBody3D::get_stat);
+        ClassDB::bind_method(D_METHOD("get_base_stat", "stat"), &BaseCharacterBody3D::get_base_stat);
+        ClassDB::bind_method(D_METHOD("set_base_stat", "stat", "value"), &BaseCharacterBody3D::set_base_stat);
+
+        BIND_ENUM_CONSTANT(STAT_MOVING_SPEED);
+        BIND_ENUM_CONSTANT(STAT_ACCELERATION_TIME);
+        BIND_ENUM_CONSTANT(STAT_DECELERATION_TIME);
+        BIND_ENUM_CONSTANT(STAT_ACCELERATION_CURVE_INTENSITY);
+        BIND_ENUM_CONSTANT(STAT_DECELERATION_CURVE_INTENSITY);
+        BIND_ENUM_CONSTANT(STAT_ROTATION_SPEED);
+        BIND_ENUM_CONSTANT(STAT_ATTACK_CHARGE_TIME);
+        BIND_ENUM_CONSTANT(STAT_COUNT);
+
+        BIND_ENUM_CONSTANT(MODIFIER_ADD);
+        BIND_ENUM_CONSTANT(MODIFIER_MULTIPLY);
+        BIND_ENUM_CONSTANT(MODIFIER_OVERRIDE);
+
         // Register properties - Movement
+        // Properties store base values; get_<name>() returns the modified value.
         ADD_GROUP("Movement", "");
-        ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "moving_speed", PROPERTY_HINT_RANGE, "0,100,0.1,or_greater"), "set_moving_speed", "get_moving_speed");
-        ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "acceleration_time", PROPERTY_HINT_RANGE, "0.01,2.0,0.01,or_greater"), "set_acceleration_time", "get_acceleration_time");
-        ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "deceleration_time", PROPERTY_HINT_RANGE, "0.01,2.0,0.01,or_greater"), "set_deceleration_time", "get_deceleration_time");
-        ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "acceleration_curve_intensity", PROPERTY_HINT_RANGE, "0,1,0.01"), "set_acceleration_curve_intensity", "get_acceleration_curve_intensity");
-        ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "deceleration_curve_intensity", PROPERTY_HINT_RANGE, "0,1,0.01"), "set_deceleration_curve_intensity", "get_deceleration_curve_intensity");
-        ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "rotation_speed", PROPERTY_HINT_RANGE, "0,50,0.1,or_greater"), "set_rotation_speed", "get_rotation_speed");
-        ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "attack_charge_time", PROPERTY_HINT_RANGE, "0.1,5.0,0.1,or_greater"), "set_attack_charge_time", "get_attack_charge_time");
+        ADD_PROPERTYI(PropertyInfo(Variant::FLOAT, "moving_speed", PROPERTY_HINT_RANGE, "0,100,0.1,or_greater"), "set_base_stat", "get_base_stat", STAT_MOVING_SPEED);
+        ADD_PROPERTYI(PropertyInfo(Variant::FLOAT, "acceleration_time", PROPERTY_HINT_RANGE, "0.01,2.0,0.01,or_greater"), "set_base_stat", "get_base_stat", STAT_ACCELERATION_TIME);
+        ADD_PROPERTYI(PropertyInfo(Variant::FLOAT, "deceleration_time", PROPERTY_HINT_RANGE, "0.01,2.0,0.01,or_greater"), "set_base_stat", "get_base_stat", STAT_DECELERATION_TIME);
+        ADD_PROPERTYI(PropertyInfo(Variant::FLOAT, "acceleration_curve_intensity", PROPERTY_HINT_RANGE, "0,1,0.01"), "set_base_stat", "get_base_stat", STAT_ACCELERATION_CURVE_INTENSITY);
+        ADD_PROPERTYI(PropertyInfo(Variant::FLOAT, "deceleration_curve_intensity", PROPERTY_HINT_RANGE, "0,1,0.01"), "set_base_stat", "get_base_stat", STAT_DECELERATION_CURVE_INTENSITY);
+        ADD_PROPERTYI(PropertyInfo(Variant::FLOAT, "rotation_speed", PROPERTY_HINT_RANGE, "0,50,0.1,or_greater"), "set_base_stat", "get_base_stat", STAT_ROTATION_SPEED);
+        ADD_PROPERTYI(PropertyInfo(Variant::FLOAT, "attack_charge_time", PROPERTY_HINT_RANGE, "0.1,5.0,0.1,or_greater"), "set_base_stat", "get_base_stat", STAT_ATTACK_CHARGE_TIME);
 
         // Register properties - Gravity
         ADD_GROUP("Gravity", "");
@@ -85,6 +109,174 @@ namespace Rebel::CharacterBody {
         ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "custom_gravity_magnitude", PROPERTY_HINT_RANGE, "0,100,0.1,or_greater"), "set_custom_gravity_magnitude", "get_custom_gravity_magnitude");
     }
 
+    int64_t BaseCharacterBody3D::add_modifier(const Stat stat, const ModifierOp op, const float value, const float duration, const StringName& source) {
+        ERR_FAIL_INDEX_V(stat, STAT_COUNT, 0);
+
+        StatModifier modifier;
+        // The low bits carry the stat so removal only has to search one stack.
+        modifier.id = (nextModifierId++ << 4) | stat;
+        modifier.op = op;
+        modifier.value = value;
+        modifier.source = source;
+        if (duration > 0.0f) {
+            modifier.expiresAt = modifierClock + duration;
+            nextModifierExpiry = Math::min(nextModifierExpiry, modifier.expiresAt);
+        }
+        statModifiers[stat].push_back(modifier);
+        dirtyStats |= 1u << stat;
+        return modifier.id;
+    }
+
+    bool BaseCharacterBody3D::remove_modifier(const int64_t id) {
+        const auto stat = static_cast<Stat>(id & 0xF);
+        if (stat >= STAT_COUNT) {
+            return false;
+        }
+        std::vector<StatModifier>& stack = statModifiers[stat];
+        for (auto it = stack.begin(); it != stack.end(); ++it) {
+            if (it->id == id) {
+                stack.erase(it);
+                dirtyStats |= 1u << stat;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    int BaseCharacterBody3D::remove_modifiers_from_source(const StringName& source) {
+        int removed = 0;
+        for (int stat = 0; stat < STAT_COUNT; ++stat) {
+            const size_t erased = std::erase_if(statModifiers[stat], [&source](const StatModifier& modifier) {
+                return modifier.source == source;
+            });
+            if (erased > 0) {
+                dirtyStats |= 1u << stat;
+                removed += static_cast<int>(erased);
+            }
+        }
+        return removed;
+    }
+
+    void BaseCharacterBody3D::clear_modifiers() {
+        for (int stat = 0; stat < STAT_COUNT; ++stat) {
+            if (!statModifiers[stat].empty()) {
+                statModifiers[stat].clear();
+                dirtyStats |= 1u << stat;
+            }
+        }
+        nextModifierExpiry = std::numeric_limits<double>::infinity();
+    }
+
+    int BaseCharacterBody3D::get_modifier_count(const Stat stat) const {
+        ERR_FAIL_INDEX_V(stat, STAT_COUNT, 0);
+        return static_cast<int>(statModifiers[stat].size());
+    }
+
+    float BaseCharacterBody3D::get_stat(const Stat stat) const {
+        ERR_FAIL_INDEX_V(stat, STAT_COUNT, 0.0f);
+        return get_final_value(stat);
+    }
+
+    float BaseCharacterBody3D::get_base_stat(const Stat stat) const {
+        ERR_FAIL_INDEX_V(stat, STAT_COUNT, 0.0f);
+        return get_base_value(stat);
+    }
+
+    void BaseCharacterBody3D::set_base_stat(const Stat stat, const float value) {
+        switch (stat) {
+            case STAT_MOVING_SPEED: set_moving_speed(value); break;
+            case STAT_ACCELERATION_TIME: set_acceleration_time(value); break;
+            case STAT_DECELERATION_TIME: set_deceleration_time(value); break;
+            case STAT_ACCELERATION_CURVE_INTENSITY: set_acceleration_curve_intensity(value); break;
+            case STAT_DECELERATION_CURVE_INTENSITY: set_deceleration_curve_intensity(value); break;
+            case STAT_ROTATION_SPEED: set_rotation_speed(value); break;
+            case STAT_ATTACK_CHARGE_TIME: set_attack_charge_time(value); break;
+            default: ERR_FAIL_MSG("Invalid stat.");
+        }
+    }
+
+    float BaseCharacterBody3D::get_base_value(const Stat stat) const {
+        switch (stat) {
+            case STAT_MOVING_SPEED: return movingSpeed;
+            case STAT_ACCELERATION_TIME: return accelerationTime;
+            case STAT_DECELERATION_TIME: return decelerationTime;
+            case STAT_ACCELERATION_CURVE_INTENSITY: return accelerationCurveIntensity;
+            case STAT_DECELERATION_CURVE_INTENSITY: return decelerationCurveIntensity;
+            case STAT_ROTATION_SPEED: return rotationSpeed;
+            case STAT_ATTACK_CHARGE_TIME: return attackChargeTime;
+            default: return 0.0f;
+        }
+    }
+
+    float BaseCharacterBody3D::get_final_value(const Stat stat) const {
+        const uint32_t bit = 1u << stat;
+        if ((dirtyStats & bit) == 0) {
+            return finalStats[stat];
+        }
+
+        const float base = get_base_value(stat);
+        float added = 0.0f;
+        float factor = 1.0f;
+        bool overridden = false;
+        float override_value = 0.0f;
+        for (const StatModifier& modifier : statModifiers[stat]) {
+            switch (modifier.op) {
+                case MODIFIER_ADD:
+                    added += modifier.value;
+                    break;
+                case MODIFIER_MULTIPLY:
+                    factor *= modifier.value;
+                    break;
+                case MODIFIER_OVERRIDE:
+                    overridden = true;
+                    override_value = modifier.value;
+                    break;
+            }
+        }
+
+        finalStats[stat] = clamp_stat(stat, overridden ? override_value : (base + added) * factor);
+        dirtyStats &= ~bit;
+        return finalStats[stat];
+    }
+
+    float BaseCharacterBody3D::clamp_stat(const Stat stat, const float value) {
+        switch (stat) {
+            case STAT_ACCELERATION_TIME:
+            case STAT_DECELERATION_TIME:
+                return Math::max(0.01f, value);
+            case STAT_ACCELERATION_CURVE_INTENSITY:
+            case STAT_DECELERATION_CURVE_INTENSITY:
+                return Math::clamp(value, 0.0f, 1.0f);
+            case STAT_ATTACK_CHARGE_TIME:
+                return Math::max(0.1f, value);
+            default:
+                return value;
+        }
+    }
+
+    void BaseCharacterBody3D::tick_modifiers(const double delta) {
+        if (nextModifierExpiry == std::numeric_limits<double>::infinity()) {
+            return;
+        }
+        modifierClock += delta;
+        if (modifierClock < nextModifierExpiry) {
+            return;
+        }
+
+        nextModifierExpiry = std::numeric_limits<double>::infinity();
+        for (int stat = 0; stat < STAT_COUNT; ++stat) {
+            const size_t erased = std::erase_if(statModifiers[stat], [this](const StatModifier& modifier) {
+                return modifier.expiresAt <= modifierClock;
+            });
+            if (erased > 0) {
+                dirtyStats |= 1u << stat;
+            }
+            for (const StatModifier& modifier : statModifiers[stat]) {
+                nextModifierExpiry = Math::min(nextModifierExpiry, modifier.expiresAt);
+            }
+        }
+    }
+
     void BaseCharacterBody3D::set_use_custom_gravity(const bool enabled) {
         useCustomGravity = enabled;
     }
@@ -111,50 +303,56 @@ namespace Rebel::CharacterBody {
 
     void BaseCharacterBody3D::set_attack_charge_time(const float time) {
         attackChargeTime = Math::max(0.1f, time);
+        dirtyStats |= 1u << STAT_ATTACK_CHARGE_TIME;
     }
 
     float BaseCharacterBody3D::get_attack_charge_time() const {
-        return attackChargeTime;
+        return get_final_value(STAT_ATTACK_CHARGE_TIME);
     }
 
     float BaseCharacterBody3D::get_moving_speed() const {
-        return movingSpeed;
+        return get_final_value(STAT_MOVING_SPEED);
     }
 
     void BaseCharacterBody3D::set_moving_speed(const float speed) {
         movingSpeed = speed;
+        dirtyStats |= 1u << STAT_MOVING_SPEED;
     }
 
     float BaseCharacterBody3D::get_acceleration_time() const {
-        return accelerationTime;
+        return get_final_value(STAT_ACCELERATION_TIME);
     }
 
     void BaseCharacterBody3D::set_acceleration_time(const float value) {
         accelerationTime = Math::max(0.01f, value);
+        dirtyStats |= 1u << STAT_ACCELERATION_TIME;
     }
 
     float BaseCharacterBody3D::get_deceleration_time() const {
-        return decelerationTime;
+        return get_final_value(STAT_DECELERATION_TIME);
     }
 
     void BaseCharacterBody3D::set_deceleration_time(const float value) {
         decelerationTime = Math::max(0.01f, value);
+        dirtyStats |= 1u << STAT_DECELERATION_TIME;
     }
 
     float BaseCharacterBody3D::get_acceleration_curve_intensity() const {
-        return accelerationCurveIntensity;
+        return get_final_value(STAT_ACCELERATION_CURVE_INTENSITY);
     }
 
     void BaseCharacterBody3D::set_acceleration_curve_intensity(const float value) {
         accelerationCurveIntensity = Math::clamp(value, 0.0f, 1.0f);
+        dirtyStats |= 1u << STAT_ACCELERATION_CURVE_INTENSITY;
     }
 
     float BaseCharacterBody3D::get_deceleration_curve_intensity() const {
-        return decelerationCurveIntensity;
+        return get_final_value(STAT_DECELERATION_CURVE_INTENSITY);
     }
 
     void BaseCharacterBody3D::set_deceleration_curve_intensity(const float value) {
         decelerationCurveIntensity = Math::clamp(value, 0.0f, 1.0f);
+        dirtyStats |= 1u << STAT_DECELERATION_CURVE_INTENSITY;
     }
 
     float BaseCharacterBody3D::ease_in(const float t, const float intensity) {
@@ -168,11 +366,12 @@ namespace Rebel::CharacterBody {
     }
 
     float BaseCharacterBody3D::get_rotation_speed() const {
-        return rotationSpeed;
+        return get_final_value(STAT_ROTATION_SPEED);
     }
 
     void BaseCharacterBody3D::set_rotation_speed(const float value) {
         rotationSpeed = value;
+        dirtyStats |= 1u << STAT_ROTATION_SPEED;
     }
 
     Vector3 BaseCharacterBody3D::get_gravity_up_direction() const {
@@ -191,6 +390,7 @@ namespace Rebel::CharacterBody {
                 _internal_ready();
                 break;
             case NOTIFICATION_PHYSICS_PROCESS:
+                tick_modifiers(get_physics_process_delta_time());
                 _internal_physics_process(get_physics_process_delta_time());
                 break;
             case NOTIFICATION_PROCESS:
@@ -0,0 +1,159 @@
+// Copyright (c) 2026, and future.
+// Alejandro Morcillo Montejo - All Rights Reserved
+
+#include "Rebel/Health/HealthComponent.hpp"
+
+#include "Rebel/Health/HealthServer.hpp"
+
+#include <godot_cpp/classes/engine.hpp>
+#include <godot_cpp/core/class_db.hpp>
+
+using namespace godot;
+
+namespace Rebel::Health {
+
+// ---------------------------------------------------------------------------
+// _bind_methods
+// ---------------------------------------------------------------------------
+
+void HealthComponent::_bind_methods() {
+    ClassDB::bind_method(D_METHOD("take_damage", "amount", "source"), &HealthComponent::take_damage, DEFVAL(Variant()));
+    ClassDB::bind_method(D_METHOD("heal", "amount"), &HealthComponent::heal);
+    ClassDB::bind_method(D_METHOD("set_invulnerable", "seconds"), &HealthComponent::set_invulnerable);
+    ClassDB::bind_method(D_METHOD("revive"), &HealthComponent::revive);
+    ClassDB::bind_method(D_METHOD("get_health"), &HealthComponent::get_health);
+    ClassDB::bind_method(D_METHOD("get_shield"), &HealthComponent::get_shield);
+    ClassDB::bind_method(D_METHOD("is_alive"), &HealthComponent::is_alive);
+    ClassDB::bind_method(D_METHOD("is_invulnerable"), &HealthComponent::is_invulnerable);
+    ClassDB::bind_method(D_METHOD("get_handle"), &HealthComponent::get_handle);
+
+    // --- max_health ---
+    ClassDB::bind_method(D_METHOD("set_max_health", "value"), &HealthComponent::set_max_health);
+    ClassDB::bind_method(D_METHOD("get_max_health"), &HealthComponent::get_max_health);
+
+    // --- max_shield ---
+    ClassDB::bind_method(D_METHOD("set_max_shield", "value"), &HealthComponent::set_max_shield);
+    ClassDB::bind_method(D_METHOD("get_max_shield"), &HealthComponent::get_max_shield);
+
+    // --- hit_invulnerability ---
+    ClassDB::bind_method(D_METHOD("set_hit_invulnerability", "seconds"), &HealthComponent::set_hit_invulnerability);
+    ClassDB::bind_method(D_METHOD("get_hit_invulnerability"), &HealthComponent::get_hit_invulnerability);
+
+    ADD_GROUP("Health", "");
+    ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "max_health",          PROPERTY_HINT_RANGE, "0,10000,0.1,or_greater"), "set_max_health",          "get_max_health");
+    ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "max_shield",          PROPERTY_HINT_RANGE, "0,10000,0.1,or_greater"), "set_max_shield",          "get_max_shield");
+    ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "hit_invulnerability", PROPERTY_HINT_RANGE, "0,5,0.01,suffix:s"),      "set_hit_invulnerability", "get_hit_invulnerability");
+}
+
+void HealthComponent::_notification(const int p_what) {
+    HealthServer* server = HealthServer::get_singleton();
+    if (server == nullptr || Engine::get_singleton()->is_editor_hint()) {
+        return;
+    }
+    switch (p_what) {
+        case NOTIFICATION_ENTER_TREE:
+            // The slot outlives tree exits so a reparent keeps health, shield and invulnerability.
+            if (m_handle == 0) {
+                m_handle = server->create_slot(this, get_tree(), m_max_health, m_max_shield, m_hit_invulnerability);
+            } else {
+                server->set_slot_paused(m_handle, false);
+            }
+            break;
+        case NOTIFICATION_EXIT_TREE:
+            server->set_slot_paused(m_handle, true);
+            break;
+        case NOTIFICATION_PREDELETE:
+            server->free_slot(m_handle);
+            m_handle = 0;
+            break;
+        default:
+            break;
+    }
+}
+
+// ---------------------------------------------------------------------------
+// Public API
+// ---------------------------------------------------------------------------
+
+void HealthComponent::take_damage(const float amount, Object* source) {
+    if (m_handle != 0) {
+        HealthServer::get_singleton()->queue_damage(m_handle, amount, source);
+    }
+}
+
+void HealthComponent::heal(const float amount) {
+    if (m_handle != 0) {
+        HealthServer::get_singleton()->queue_heal(m_handle, amount);
+    }
+}
+
+void HealthComponent::set_invulnerable(const float seconds) {
+    if (m_handle != 0) {
+        HealthServer::get_singleton()->set_invulnerable(m_handle, seconds);
+    }
+}
+
+void HealthComponent::revive() {
+    if (m_handle != 0) {
+        HealthServer::get_singleton()->revive(m_handle);
+    }
+}
+
+float HealthComponent::get_health() const {
+    return m_handle != 0 ? HealthServer::get_singleton()->get_health(m_handle) : m_max_health;
+}
+
+float HealthComponent::get_shield() const {
+    return m_handle != 0 ? HealthServer::get_singleton()->get_shield(m_handle) : m_max_shield;
+}
+
+bool HealthComponent::is_alive() const {
+    return m_handle != 0 ? HealthServer::get_singleton()->is_alive(m_handle) : m_max_health > 0.0f;
+}
+
+bool HealthComponent::is_invulnerable() const {
+    return m_handle != 0 && HealthServer::get_singleton()->is_invulnerable(m_handle);
+}
+
+int64_t HealthComponent::get_handle() const {
+    return m_handle;
+}
+
+// ---------------------------------------------------------------------------
+// Setters / getters
+// ---------------------------------------------------------------------------
+
+void HealthComponent::set_max_health(const float value) {
+    m_max_health = Math::max(value, 0.0f);
+    if (m_handle != 0) {
+        HealthServer::get_singleton()->set_max_health(m_handle, m_max_health);
+    }
+}
+
+float HealthComponent::get_max_health() const {
+    return m_max_health;
+}
+
+void HealthComponent::set_max_shield(const float value) {
+    m_max_shield = Math::max(value, 0.0f);
+    if (m_handle != 0) {
+        HealthServer::get_singleton()->set_max_shield(m_handle, m_max_shield);
+    }
+}
+
+float HealthComponent::get_max_shield() const {
+    return m_max_shield;
+}
+
+void HealthComponent::set_hit_invulnerability(const float seconds) {
+    m_hit_invulnerability = Math::max(seconds, 0.0f);
+    if (m_handle != 0) {
+        HealthServer::get_singleton()->set_hit_invulnerability(m_handle, m_hit_invulnerability);
+    }
+}
+
+float HealthComponent::get_hit_invulnerability() const {
+    return m_hit_invulnerability;
+}
+
+} // namespace Rebel::Health
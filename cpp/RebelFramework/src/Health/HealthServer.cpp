@@ -0,0 +1,351 @@
+// Copyright (c) 2026, and future.
+// Alejandro Morcillo Montejo - All Rights Reserved
+
+#include "Rebel/Health/HealthServer.hpp"
+
+#include "Rebel/Trigger/TriggerEngine.hpp"
+
+#include <godot_cpp/classes/engine.hpp>
+#include <godot_cpp/classes/scene_tree.hpp>
+#include <godot_cpp/classes/window.hpp>
+#include <godot_cpp/core/class_db.hpp>
+#include <godot_cpp/variant/callable_method_pointer.hpp>
+#include <godot_cpp/variant/packed_float32_array.hpp>
+
+using namespace godot;
+
+namespace Rebel::Health {
+
+HealthServer* HealthServer::s_singleton = nullptr;
+
+namespace {
+
+constexpr int64_t pack_handle(const uint32_t slot, const uint32_t generation) {
+    return static_cast<int64_t>((static_cast<uint64_t>(generation) << 32) | slot);
+}
+
+constexpr uint32_t handle_slot(const int64_t handle) {
+    return static_cast<uint32_t>(static_cast<uint64_t>(handle) & 0xFFFFFFFFu);
+}
+
+constexpr uint32_t handle_generation(const int64_t handle) {
+    return static_cast<uint32_t>(static_cast<uint64_t>(handle) >> 32);
+}
+
+} // namespace
+
+// ---------------------------------------------------------------------------
+// _bind_methods
+// ---------------------------------------------------------------------------
+
+void HealthServer::_bind_methods() {
+    ClassDB::bind_method(D_METHOD("queue_damage", "handle", "amount", "source"), &HealthServer::queue_damage, DEFVAL(Variant()));
+    ClassDB::bind_method(D_METHOD("queue_heal", "handle", "amount"), &HealthServer::queue_heal);
+    ClassDB::bind_method(D_METHOD("resolve"), &HealthServer::resolve);
+    ClassDB::bind_method(D_METHOD("get_pending_events"), &HealthServer::get_pending_events);
+    ClassDB::bind_method(D_METHOD("get_slot_count"), &HealthServer::get_slot_count);
+
+    ADD_SIGNAL(MethodInfo("damage_resolved",
+        PropertyInfo(Variant::ARRAY, "components", PROPERTY_HINT_ARRAY_TYPE, "HealthComponent"),
+        PropertyInfo(Variant::PACKED_FLOAT32_ARRAY, "amounts")));
+    ADD_SIGNAL(MethodInfo("deaths_resolved",
+        PropertyInfo(Variant::ARRAY, "components", PROPERTY_HINT_ARRAY_TYPE, "HealthComponent")));
+}
+
+HealthServer::HealthServer() {
+    s_singleton = this;
+}
+
+HealthServer::~HealthServer() {
+    if (s_singleton == this) {
+        s_singleton = nullptr;
+    }
+}
+
+HealthServer* HealthServer::get_singleton() {
+    return s_singleton;
+}
+
+// ---------------------------------------------------------------------------
+// Slots
+// ---------------------------------------------------------------------------
+
+int64_t HealthServer::create_slot(Object* owner, SceneTree* tree, const float max_health, const float max_shield, const float hit_invulnerability) {
+    ERR_FAIL_NULL_V(owner, 0);
+
+    uint32_t slot;
+    if (!m_free_slots.empty()) {
+        slot = m_free_slots.back();
+        m_free_slots.pop_back();
+    } else {
+        slot = static_cast<uint32_t>(m_health.size());
+        m_health.push_back(0.0f);
+        m_max_health.push_back(0.0f);
+        m_shield.push_back(0.0f);
+        m_max_shield.push_back(0.0f);
+        m_invulnerable_time.push_back(0.0f);
+        m_hit_invulnerability.push_back(0.0f);
+        m_owner_ids.push_back(0);
+        m_generations.push_back(1);
+        m_alive.push_back(0);
+        m_paused.push_back(0);
+        m_batch_damage.push_back(0.0f);
+    }
+
+    m_max_health[slot] = Math::max(max_health, 0.0f);
+    m_health[slot] = m_max_health[slot];
+    m_max_shield[slot] = Math::max(max_shield, 0.0f);
+    m_shield[slot] = m_max_shield[slot];
+    m_invulnerable_time[slot] = 0.0f;
+    m_hit_invulnerability[slot] = Math::max(hit_invulnerability, 0.0f);
+    m_owner_ids[slot] = owner->get_instance_id();
+    m_alive[slot] = 1;
+    m_paused[slot] = 0;
+
+    connect_tree(tree);
+    return pack_handle(slot, m_generations[slot]);
+}
+
+void HealthServer::free_slot(const int64_t handle) {
+    const int64_t slot = slot_of(handle);
+    if (slot < 0) {
+        return;
+    }
+    m_owner_ids[slot] = 0;
+    m_alive[slot] = 0;
+    // Bumping the generation invalidates every handle still referring to the slot.
+    ++m_generations[slot];
+    m_free_slots.push_back(static_cast<uint32_t>(slot));
+}
+
+void HealthServer::set_slot_paused(const int64_t handle, const bool paused) {
+    const int64_t slot = slot_of(handle);
+    if (slot >= 0) {
+        m_paused[slot] = paused ? 1 : 0;
+    }
+}
+
+int64_t HealthServer::slot_of(const int64_t handle) const {
+    const uint32_t slot = handle_slot(handle);
+    if (slot >= m_generations.size() || m_generations[slot] != handle_generation(handle) || m_owner_ids[slot] == 0) {
+        return -1;
+    }
+    return slot;
+}
+
+void HealthServer::connect_tree(SceneTree* tree) {
+    if (tree == nullptr || tree->get_instance_id() == m_tree_id) {
+        return;
+    }
+    m_tree_id = tree->get_instance_id();
+    const Callable callable = callable_mp(this, &HealthServer::resolve);
+    if (!tree->is_connected("process_frame", callable)) {
+        tree->connect("process_frame", callable);
+    }
+}
+
+// ---------------------------------------------------------------------------
+// Event queue
+// ---------------------------------------------------------------------------
+
+void HealthServer::queue_damage(const int64_t handle, const float amount, Object* source) {
+    if (amount <= 0.0f) {
+        return;
+    }
+    m_queue.push_back({handle, amount, source != nullptr ? source->get_instance_id() : 0});
+}
+
+void HealthServer::queue_heal(const int64_t handle, const float amount) {
+    if (amount <= 0.0f) {
+        return;
+    }
+    m_queue.push_back({handle, -amount, 0});
+}
+
+void HealthServer::resolve() {
+    tick_invulnerability();
+    if (m_queue.empty()) {
+        return;
+    }
+
+    // Swap the queue out so hits queued by signal handlers land in the next batch.
+    std::vector<DamageEvent> events{};
+    events.swap(m_queue);
+
+    Trigger::TriggerEngine* triggers = Trigger::TriggerEngine::get_singleton();
+
+    Array deaths{};
+    for (const DamageEvent& event : events) {
+        const int64_t slot = slot_of(event.handle);
+        if (slot < 0 || !m_alive[slot] || m_paused[slot]) {
+            continue;
+        }
+
+        if (event.amount < 0.0f) {
+            m_health[slot] = Math::min(m_health[slot] - event.amount, m_max_health[slot]);
+            continue;
+        }
+        if (m_invulnerable_time[slot] > 0.0f) {
+            continue;
+        }
+
+        float remaining = event.amount;
+        const float absorbed = Math::min(m_shield[slot], remaining);
+        m_shield[slot] -= absorbed;
+        remaining -= absorbed;
+        m_health[slot] = Math::max(m_health[slot] - remaining, 0.0f);
+
+        if (m_batch_damage[slot] == 0.0f) {
+            m_batch_touched.push_back(static_cast<uint32_t>(slot));
+        }
+        m_batch_damage[slot] += event.amount;
+        m_invulnerable_time[slot] = m_hit_invulnerability[slot];
+
+        if (triggers != nullptr) {
+            triggers->emit_event({Trigger::TriggerEngine::CHANNEL_HIT, 0, event.source_id, m_owner_ids[slot], event.amount, {}});
+        }
+
+        if (m_health[slot] <= 0.0f) {
+            m_alive[slot] = 0;
+            deaths.push_back(ObjectDB::get_instance(m_owner_ids[slot]));
+            if (triggers != nullptr) {
+                triggers->emit_event({Trigger::TriggerEngine::CHANNEL_KILL, 0, event.source_id, m_owner_ids[slot], event.amount, {}});
+            }
+        }
+    }
+
+    if (!m_batch_touched.empty()) {
+        Array components{};
+        PackedFloat32Array amounts{};
+        components.resize(static_cast<int64_t>(m_batch_touched.size()));
+        amounts.resize(static_cast<int64_t>(m_batch_touched.size()));
+        float* amounts_ptr = amounts.ptrw();
+        for (size_t i = 0; i < m_batch_touched.size(); ++i) {
+            const uint32_t slot = m_batch_touched[i];
+            components[static_cast<int64_t>(i)] = ObjectDB::get_instance(m_owner_ids[slot]);
+            amounts_ptr[i] = m_batch_damage[slot];
+            m_batch_damage[slot] = 0.0f;
+        }
+        m_batch_touched.clear();
+        emit_signal("damage_resolved", components, amounts);
+    }
+    if (!deaths.is_empty()) {
+        emit_signal("deaths_resolved", deaths);
+    }
+
+    // Resolve on-hit / on-kill procs in the same frame as the hits themselves.
+    if (triggers != nullptr) {
+        triggers->resolve();
+    }
+}
+
+void HealthServer::tick_invulnerability() {
+    // Tick at most once per frame, even when resolve() is also called manually.
+    const uint64_t frame = Engine::get_singleton()->get_process_frames();
+    if (frame == m_last_tick_frame) {
+        return;
+    }
+    m_last_tick_frame = frame;
+
+    const auto* tree = Object::cast_to<SceneTree>(ObjectDB::get_instance(m_tree_id));
+    if (tree == nullptr || tree->get_root() == nullptr) {
+        return;
+    }
+    const auto elapsed = static_cast<float>(tree->get_root()->get_process_delta_time());
+    for (size_t slot = 0; slot < m_invulnerable_time.size(); ++slot) {
+        if (!m_paused[slot]) {
+            m_invulnerable_time[slot] = Math::max(m_invulnerable_time[slot] - elapsed, 0.0f);
+        }
+    }
+}
+
+int HealthServer::get_pending_events() const {
+    return static_cast<int>(m_queue.size());
+}
+
+int HealthServer::get_slot_count() const {
+    return static_cast<int>(m_health.size() - m_free_slots.size());
+}
+
+// ---------------------------------------------------------------------------
+// Slot access
+// ---------------------------------------------------------------------------
+
+bool HealthServer::is_valid(const int64_t handle) const {
+    return slot_of(handle) >= 0;
+}
+
+float HealthServer::get_health(const int64_t handle) const {
+    const int64_t slot = slot_of(handle);
+    return slot < 0 ? 0.0f : m_health[slot];
+}
+
+float HealthServer::get_max_health(const int64_t handle) const {
+    const int64_t slot = slot_of(handle);
+    return slot < 0 ? 0.0f : m_max_health[slot];
+}
+
+float HealthServer::get_shield(const int64_t handle) const {
+    const int64_t slot = slot_of(handle);
+    return slot < 0 ? 0.0f : m_shield[slot];
+}
+
+float HealthServer::get_max_shield(const int64_t handle) const {
+    const int64_t slot = slot_of(handle);
+    return slot < 0 ? 0.0f : m_max_shield[slot];
+}
+
+bool HealthServer::is_alive(const int64_t handle) const {
+    const int64_t slot = slot_of(handle);
+    return slot >= 0 && m_alive[slot];
+}
+
+bool HealthServer::is_invulnerable(const int64_t handle) const {
+    const int64_t slot = slot_of(handle);
+    return slot >= 0 && m_invulnerable_time[slot] > 0.0f;
+}
+
+void HealthServer::set_max_health(const int64_t handle, const float value) {
+    const int64_t slot = slot_of(handle);
+    if (slot < 0) {
+        return;
+    }
+    m_max_health[slot] = Math::max(value, 0.0f);
+    m_health[slot] = Math::min(m_health[slot], m_max_health[slot]);
+}
+
+void HealthServer::set_max_shield(const int64_t handle, const float value) {
+    const int64_t slot = slot_of(handle);
+    if (slot < 0) {
+        return;
+    }
+    m_max_shield[slot] = Math::max(value, 0.0f);
+    m_shield[slot] = Math::min(m_shield[slot], m_max_shield[slot]);
+}
+
+void HealthServer::set_hit_invulnerability(const int64_t handle, const float seconds) {
+    const int64_t slot = slot_of(handle);
+    if (slot >= 0) {
+        m_hit_invulnerability[slot] = Math::max(seconds, 0.0f);
+    }
+}
+
+void HealthServer::set_invulnerable(const int64_t handle, const float seconds) {
+    const int64_t slot = slot_of(handle);
+    if (slot >= 0) {
+        m_invulnerable_time[slot] = Math::max(seconds, 0.0f);
+    }
+}
+
+void HealthServer::revive(const int64_t handle) {
+    const int64_t slot = slot_of(handle);
+    if (slot < 0) {
+        return;
+    }
+    m_health[slot] = m_max_health[slot];
+    m_shield[slot] = m_max_shield[slot];
+    m_invulnerable_time[slot] = 0.0f;
+    m_alive[slot] = 1;
+}
+
+} // namespace Rebel::Health
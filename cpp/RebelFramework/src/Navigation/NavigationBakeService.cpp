@@ -0,0 +1,306 @@
+// Copyright (c) 2026, and future.
+// Alejandro Morcillo Montejo - All Rights Reserved
+
+#include "Rebel/Navigation/NavigationBakeService.hpp"
+
+#include <godot_cpp/classes/engine.hpp>
+#include <godot_cpp/classes/navigation_mesh_source_geometry_data3d.hpp>
+#include <godot_cpp/classes/navigation_server3d.hpp>
+#include <godot_cpp/classes/performance.hpp>
+#include <godot_cpp/classes/time.hpp>
+#include <godot_cpp/core/class_db.hpp>
+#include <godot_cpp/variant/callable_method_pointer.hpp>
+#include <godot_cpp/variant/typed_array.hpp>
+
+using namespace godot;
+
+namespace Rebel::Navigation {
+
+namespace {
+
+constexpr auto MONITOR_BAKE_TIME = "last_bake_time_msec";
+constexpr auto MONITOR_POLYGONS = "last_polygon_count";
+
+} // namespace
+
+// ---------------------------------------------------------------------------
+// _bind_methods
+// ---------------------------------------------------------------------------
+
+void NavigationBakeService::_bind_methods() {
+    ClassDB::bind_method(D_METHOD("request_bake", "region", "source_root"), &NavigationBakeService::request_bake, DEFVAL(Variant()));
+    ClassDB::bind_method(D_METHOD("is_baking", "region"), &NavigationBakeService::is_baking);
+    ClassDB::bind_method(D_METHOD("is_baked", "region"), &NavigationBakeService::is_baked);
+    ClassDB::bind_method(D_METHOD("find_path", "region", "from", "to"), &NavigationBakeService::find_path);
+    ClassDB::bind_method(D_METHOD("clear"), &NavigationBakeService::clear);
+
+    // --- metrics ---
+    ClassDB::bind_method(D_METHOD("get_last_bake_time_msec"), &NavigationBakeService::get_last_bake_time_msec);
+    ClassDB::bind_method(D_METHOD("get_last_polygon_count"), &NavigationBakeService::get_last_polygon_count);
+    ClassDB::bind_method(D_METHOD("get_active_bakes"), &NavigationBakeService::get_active_bakes);
+
+    ADD_SIGNAL(MethodInfo("bake_finished",
+        PropertyInfo(Variant::OBJECT, "region", PROPERTY_HINT_NODE_TYPE, "NavigationRegion3D"),
+        PropertyInfo(Variant::INT, "polygon_count"),
+        PropertyInfo(Variant::FLOAT, "bake_time_msec")));
+
+    ADD_GROUP("Metrics", "");
+    ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "last_bake_time_msec", PROPERTY_HINT_NONE, "", PROPERTY_USAGE_EDITOR | PROPERTY_USAGE_READ_ONLY), "", "get_last_bake_time_msec");
+    ADD_PROPERTY(PropertyInfo(Variant::INT,   "last_polygon_count",  PROPERTY_HINT_NONE, "", PROPERTY_USAGE_EDITOR | PROPERTY_USAGE_READ_ONLY), "", "get_last_polygon_count");
+}
+
+void NavigationBakeService::_notification(const int p_what) {
+    switch (p_what) {
+        case NOTIFICATION_ENTER_TREE:
+            register_monitors();
+            break;
+        case NOTIFICATION_EXIT_TREE:
+            unregister_monitors();
+            break;
+        default:
+            break;
+    }
+}
+
+// ---------------------------------------------------------------------------
+// Public API
+// ---------------------------------------------------------------------------
+
+bool NavigationBakeService::request_bake(NavigationRegion3D* region, Node* source_root) {
+    if (region == nullptr || Engine::get_singleton()->is_editor_hint()) {
+        return false;
+    }
+    if (source_root == nullptr) {
+        source_root = region;
+    }
+
+    // Bake into a fresh mesh so the region keeps navigating on its old one
+    // until the swap. The region's current mesh, if any, supplies the agent
+    // radius, cell size and parsing settings.
+    Ref<NavigationMesh> mesh;
+    const Ref<NavigationMesh> template_mesh = region->get_navigation_mesh();
+    if (template_mesh.is_valid()) {
+        mesh = template_mesh->duplicate();
+        mesh->clear();
+    } else {
+        mesh.instantiate();
+        mesh->set_parsed_geometry_type(NavigationMesh::PARSED_GEOMETRY_BOTH);
+    }
+
+    const uint64_t region_id = region->get_instance_id();
+    RegionJob& job = m_jobs[region_id];
+    job.pending_mesh = mesh;
+    job.start_usec = Time::get_singleton()->get_ticks_usec();
+    job.baking = true;
+    job.baked = false;
+    ++job.generation; // Supersedes any bake still in flight for this region.
+
+    // Coarse fallback so enemies can path before the bake lands.
+    GridMap* grid_map = Object::cast_to<GridMap>(source_root);
+    if (grid_map == nullptr) {
+        const TypedArray<Node> grid_maps = source_root->find_children("*", "GridMap", true, false);
+        if (!grid_maps.is_empty()) {
+            grid_map = Object::cast_to<GridMap>(grid_maps[0]);
+        }
+    }
+    job.grid_map_id = grid_map != nullptr ? grid_map->get_instance_id() : 0;
+    job.fallback = grid_map != nullptr ? build_fallback_grid(grid_map, job.floor_layer) : Ref<AStarGrid2D>();
+
+    // Parsing touches scene nodes and must stay on the main thread; only the
+    // bake itself goes to the worker pool.
+    NavigationServer3D* server = NavigationServer3D::get_singleton();
+    Ref<NavigationMeshSourceGeometryData3D> source_geometry;
+    source_geometry.instantiate();
+    server->parse_source_geometry_data(mesh, source_geometry, source_root);
+    server->bake_from_source_geometry_data_async(
+        mesh, source_geometry,
+        callable_mp(this, &NavigationBakeService::on_bake_finished).bind(region_id, job.generation));
+    return true;
+}
+
+bool NavigationBakeService::is_baking(NavigationRegion3D* region) const {
+    if (region == nullptr) {
+        return false;
+    }
+    const RegionJob* job = m_jobs.getptr(region->get_instance_id());
+    return job != nullptr && job->baking;
+}
+
+bool NavigationBakeService::is_baked(NavigationRegion3D* region) const {
+    if (region == nullptr) {
+        return false;
+    }
+    const RegionJob* job = m_jobs.getptr(region->get_instance_id());
+    return job != nullptr && job->baked;
+}
+
+PackedVector3Array NavigationBakeService::find_path(NavigationRegion3D* region, const Vector3& from, const Vector3& to) const {
+    if (region == nullptr || !region->is_inside_tree()) {
+        return {};
+    }
+
+    const RegionJob* job = m_jobs.getptr(region->get_instance_id());
+    if (job == nullptr || !job->baking) {
+        return NavigationServer3D::get_singleton()->map_get_path(region->get_navigation_map(), from, to, true);
+    }
+
+    // Bake still in flight — answer from the coarse grid.
+    GridMap* grid_map = Object::cast_to<GridMap>(ObjectDB::get_instance(job->grid_map_id));
+    if (job->fallback.is_null() || grid_map == nullptr) {
+        return {};
+    }
+
+    const Vector3i from_cell = grid_map->local_to_map(grid_map->to_local(from));
+    const Vector3i to_cell = grid_map->local_to_map(grid_map->to_local(to));
+    const Vector2i from_id(from_cell.x, from_cell.z);
+    const Vector2i to_id(to_cell.x, to_cell.z);
+    if (!job->fallback->is_in_boundsv(from_id) || !job->fallback->is_in_boundsv(to_id)) {
+        return {};
+    }
+
+    const TypedArray<Vector2i> ids = job->fallback->get_id_path(from_id, to_id, true);
+    PackedVector3Array path{};
+    path.resize(ids.size());
+    for (int64_t i = 0; i < ids.size(); ++i) {
+        const Vector2i id = ids[i];
+        const Vector3 point = grid_map->to_global(grid_map->map_to_local(Vector3i(id.x, job->floor_layer, id.y)));
+        path.set(i, Vector3(point.x, from.y, point.z));
+    }
+    return path;
+}
+
+void NavigationBakeService::clear() {
+    m_jobs.clear();
+}
+
+// ---------------------------------------------------------------------------
+// Metrics
+// ---------------------------------------------------------------------------
+
+double NavigationBakeService::get_last_bake_time_msec() const {
+    return m_last_bake_time_msec;
+}
+
+int NavigationBakeService::get_last_polygon_count() const {
+    return m_last_polygon_count;
+}
+
+int NavigationBakeService::get_active_bakes() const {
+    int active = 0;
+    for (const KeyValue<uint64_t, RegionJob>& kv : m_jobs) {
+        if (kv.value.baking) {
+            ++active;
+        }
+    }
+    return active;
+}
+
+String NavigationBakeService::get_monitor_id(const char* metric) const {
+    // Monitors call into this instance, so each service registers its own.
+    return "rebel/navigation_" + String::num_uint64(get_instance_id()) + "/" + metric;
+}
+
+void NavigationBakeService::register_monitors() {
+    Performance* performance = Performance::get_singleton();
+    const String bake_time = get_monitor_id(MONITOR_BAKE_TIME);
+    if (!performance->has_custom_monitor(bake_time)) {
+        performance->add_custom_monitor(bake_time, callable_mp(this, &NavigationBakeService::get_last_bake_time_msec));
+    }
+    const String polygons = get_monitor_id(MONITOR_POLYGONS);
+    if (!performance->has_custom_monitor(polygons)) {
+        performance->add_custom_monitor(polygons, callable_mp(this, &NavigationBakeService::get_last_polygon_count));
+    }
+}
+
+void NavigationBakeService::unregister_monitors() {
+    Performance* performance = Performance::get_singleton();
+    for (const char* metric : {MONITOR_BAKE_TIME, MONITOR_POLYGONS}) {
+        const String id = get_monitor_id(metric);
+        if (performance->has_custom_monitor(id)) {
+            performance->remove_custom_monitor(id);
+        }
+    }
+}
+
+// ---------------------------------------------------------------------------
+// Bake completion
+// ---------------------------------------------------------------------------
+
+void NavigationBakeService::on_bake_finished(const uint64_t region_id, const uint32_t generation) {
+    // The server does not guarantee which thread runs the callback; the swap
+    // touches the scene, so defer it to the main thread.
+    callable_mp(this, &NavigationBakeService::apply_bake).call_deferred(region_id, generation);
+}
+
+void NavigationBakeService::apply_bake(const uint64_t region_id, const uint32_t generation) {
+    RegionJob* job = m_jobs.getptr(region_id);
+    if (job == nullptr || !job->baking || job->generation != generation) {
+        return; // Superseded or cleared.
+    }
+
+    NavigationRegion3D* region = Object::cast_to<NavigationRegion3D>(ObjectDB::get_instance(region_id));
+    if (region == nullptr) {
+        m_jobs.erase(region_id);
+        return;
+    }
+
+    // Single assignment: the navigation map picks up the new mesh on its next sync.
+    const Ref<NavigationMesh> mesh = job->pending_mesh;
+    region->set_navigation_mesh(mesh);
+
+    m_last_bake_time_msec = static_cast<double>(Time::get_singleton()->get_ticks_usec() - job->start_usec) / 1000.0;
+    m_last_polygon_count = static_cast<int>(mesh->get_polygon_count());
+
+    job->pending_mesh.unref();
+    job->fallback.unref();
+    job->baking = false;
+    job->baked = true;
+
+    emit_signal("bake_finished", region, m_last_polygon_count, m_last_bake_time_msec);
+}
+
+// ---------------------------------------------------------------------------
+// Fallback grid
+// ---------------------------------------------------------------------------
+
+Ref<AStarGrid2D> NavigationBakeService::build_fallback_grid(GridMap* grid_map, int& floor_layer) {
+    const TypedArray<Vector3i> cells = grid_map->get_used_cells();
+    if (cells.is_empty()) {
+        return {};
+    }
+
+    Vector3i min_cell = cells[0];
+    Vector3i max_cell = cells[0];
+    for (int64_t i = 1; i < cells.size(); ++i) {
+        const Vector3i cell = cells[i];
+        min_cell = Vector3i(Math::min(min_cell.x, cell.x), Math::min(min_cell.y, cell.y), Math::min(min_cell.z, cell.z));
+        max_cell = Vector3i(Math::max(max_cell.x, cell.x), Math::max(max_cell.y, cell.y), Math::max(max_cell.z, cell.z));
+    }
+    floor_layer = min_cell.y;
+
+    Ref<AStarGrid2D> grid;
+    grid.instantiate();
+    const Rect2i region(min_cell.x, min_cell.z, max_cell.x - min_cell.x + 1, max_cell.z - min_cell.z + 1);
+    grid->set_region(region);
+    grid->set_diagonal_mode(AStarGrid2D::DIAGONAL_MODE_ONLY_IF_NO_OBSTACLES);
+    grid->update();
+    grid->fill_solid_region(region, true);
+
+    // Floor cells on the lowest layer are walkable; anything stacked directly
+    // on top of them (walls, props from the meshlib) blocks the cell again.
+    for (int64_t i = 0; i < cells.size(); ++i) {
+        const Vector3i cell = cells[i];
+        if (cell.y == floor_layer) {
+            grid->set_point_solid(Vector2i(cell.x, cell.z), false);
+        }
+    }
+    for (int64_t i = 0; i < cells.size(); ++i) {
+        const Vector3i cell = cells[i];
+        if (cell.y == floor_layer + 1) {
+            grid->set_point_solid(Vector2i(cell.x, cell.z), true);
+        }
+    }
+    return grid;
+}
+
+} // namespace Rebel::Navigation
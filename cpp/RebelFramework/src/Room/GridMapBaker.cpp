@@ -0,0 +1,333 @@
+// Copyright (c) 2026, and future.
+// Alejandro Morcillo Montejo - All Rights Reserved
+
+#include "Rebel/Room/GridMapBaker.hpp"
+
+#include <godot_cpp/classes/box_shape3d.hpp>
+#include <godot_cpp/classes/collision_shape3d.hpp>
+#include <godot_cpp/classes/mesh_library.hpp>
+#include <godot_cpp/classes/multi_mesh.hpp>
+#include <godot_cpp/classes/multi_mesh_instance3d.hpp>
+#include <godot_cpp/classes/static_body3d.hpp>
+#include <godot_cpp/core/class_db.hpp>
+#include <godot_cpp/variant/typed_array.hpp>
+#include <godot_cpp/variant/utility_functions.hpp>
+
+#include <algorithm>
+#include <map>
+#include <tuple>
+#include <vector>
+
+using namespace godot;
+
+namespace Rebel::Room {
+
+namespace {
+
+/** Millimetre quantisation so float box extents can be used as map keys. */
+int64_t quantize(const real_t value) {
+    return static_cast<int64_t>(Math::round(value * 1000.0));
+}
+
+/** Cells that share a layer and a box slab: (layer, slab bottom, slab height). */
+using SlabKey = std::tuple<int32_t, int64_t, int64_t>;
+
+struct MergedBox {
+    int32_t x0;
+    int32_t z0;
+    int32_t width;
+    int32_t depth;
+    real_t bottom;
+    real_t height;
+    bool full_height;
+};
+
+/**
+ * @brief Greedy rectangle cover of a set of cells on one slab.
+ *
+ * Scans row by row, grows each rectangle along X first and then along Z as
+ * long as the whole row span is still free. Not optimal, but produces few
+ * rectangles for the blocky layouts a room generator emits.
+ */
+template <typename Emit>
+void greedy_rectangles(const std::vector<Vector2i>& cells, Emit&& emit) {
+    Vector2i min_cell = cells.front();
+    Vector2i max_cell = cells.front();
+    for (const Vector2i& cell : cells) {
+        min_cell = Vector2i(Math::min(min_cell.x, cell.x), Math::min(min_cell.y, cell.y));
+        max_cell = Vector2i(Math::max(max_cell.x, cell.x), Math::max(max_cell.y, cell.y));
+    }
+
+    const int32_t width = max_cell.x - min_cell.x + 1;
+    const int32_t depth = max_cell.y - min_cell.y + 1;
+
+    // 0 = empty, 1 = filled, 2 = already covered by a rectangle.
+    std::vector<uint8_t> grid(static_cast<size_t>(width) * depth, 0);
+    for (const Vector2i& cell : cells) {
+        grid[static_cast<size_t>(cell.y - min_cell.y) * width + (cell.x - min_cell.x)] = 1;
+    }
+
+    for (int32_t z = 0; z < depth; ++z) {
+        for (int32_t x = 0; x < width; ++x) {
+            if (grid[static_cast<size_t>(z) * width + x] != 1) {
+                continue;
+            }
+
+            int32_t rect_width = 1;
+            while (x + rect_width < width && grid[static_cast<size_t>(z) * width + x + rect_width] == 1) {
+                ++rect_width;
+            }
+
+            int32_t rect_depth = 1;
+            while (z + rect_depth < depth) {
+                bool row_free = true;
+                for (int32_t i = 0; i < rect_width; ++i) {
+                    if (grid[static_cast<size_t>(z + rect_depth) * width + x + i] != 1) {
+                        row_free = false;
+                        break;
+                    }
+                }
+                if (!row_free) {
+                    break;
+                }
+                ++rect_depth;
+            }
+
+            for (int32_t dz = 0; dz < rect_depth; ++dz) {
+                for (int32_t dx = 0; dx < rect_width; ++dx) {
+                    grid[static_cast<size_t>(z + dz) * width + x + dx] = 2;
+                }
+            }
+            emit(min_cell.x + x, min_cell.y + z, rect_width, rect_depth);
+        }
+    }
+}
+
+} // namespace
+
+// ---------------------------------------------------------------------------
+// _bind_methods
+// ---------------------------------------------------------------------------
+
+void GridMapBaker::_bind_methods() {
+    ClassDB::bind_method(D_METHOD("bake", "grid_map"), &GridMapBaker::bake);
+
+    // --- options ---
+    ClassDB::bind_method(D_METHOD("set_replace_source", "enabled"), &GridMapBaker::set_replace_source);
+    ClassDB::bind_method(D_METHOD("get_replace_source"), &GridMapBaker::get_replace_source);
+    ClassDB::bind_method(D_METHOD("set_merge_vertically", "enabled"), &GridMapBaker::set_merge_vertically);
+    ClassDB::bind_method(D_METHOD("get_merge_vertically"), &GridMapBaker::get_merge_vertically);
+
+    // --- statistics ---
+    ClassDB::bind_method(D_METHOD("get_last_cell_count"), &GridMapBaker::get_last_cell_count);
+    ClassDB::bind_method(D_METHOD("get_last_shape_count"), &GridMapBaker::get_last_shape_count);
+    ClassDB::bind_method(D_METHOD("get_last_multimesh_count"), &GridMapBaker::get_last_multimesh_count);
+
+    ADD_PROPERTY(PropertyInfo(Variant::BOOL, "replace_source"),   "set_replace_source",   "get_replace_source");
+    ADD_PROPERTY(PropertyInfo(Variant::BOOL, "merge_vertically"), "set_merge_vertically", "get_merge_vertically");
+}
+
+// ---------------------------------------------------------------------------
+// bake
+// ---------------------------------------------------------------------------
+
+Node3D* GridMapBaker::bake(GridMap* grid_map) {
+    m_last_cell_count = 0;
+    m_last_shape_count = 0;
+    m_last_multimesh_count = 0;
+
+    if (grid_map == nullptr) {
+        return nullptr;
+    }
+    const Ref<MeshLibrary> library = grid_map->get_mesh_library();
+    if (library.is_null()) {
+        UtilityFunctions::push_warning("[GridMapBaker] GridMap has no MeshLibrary assigned; nothing to bake.");
+        return nullptr;
+    }
+
+    const TypedArray<Vector3i> cells = grid_map->get_used_cells();
+    if (cells.is_empty()) {
+        return nullptr;
+    }
+    m_last_cell_count = static_cast<int>(cells.size());
+
+    const Vector3 cell_size = grid_map->get_cell_size();
+    const real_t cell_scale = grid_map->get_cell_scale();
+    constexpr real_t EPSILON = 0.001f;
+
+    Node3D* root = memnew(Node3D);
+    root->set_name("BakedGridMap");
+    root->set_transform(grid_map->get_transform());
+
+    StaticBody3D* body = memnew(StaticBody3D);
+    body->set_name("Collision");
+    body->set_collision_layer(grid_map->get_collision_layer());
+    body->set_collision_mask(grid_map->get_collision_mask());
+    root->add_child(body);
+
+    std::map<SlabKey, std::vector<Vector2i>> slabs{};
+    std::map<int32_t, std::vector<Transform3D>> instances{};
+
+    for (int64_t i = 0; i < cells.size(); ++i) {
+        const Vector3i cell = cells[i];
+        const int32_t item = grid_map->get_cell_item(cell);
+
+        Transform3D cell_xform(grid_map->get_cell_item_basis(cell), grid_map->map_to_local(cell));
+        cell_xform.basis.scale(Vector3(cell_scale, cell_scale, cell_scale));
+
+        // --- rendering: one instance per cell, grouped by meshlib item ---
+        if (library->get_item_mesh(item).is_valid()) {
+            instances[item].push_back(cell_xform * library->get_item_mesh_transform(item));
+        }
+
+        // --- collision: mergeable slabs vs. cells kept as-is ---
+        const Array shapes = library->get_item_shapes(item); // [Shape3D, Transform3D, ...]
+        if (shapes.size() == 2) {
+            const Ref<BoxShape3D> box = shapes[0];
+            if (box.is_valid()) {
+                const Transform3D shape_xform = cell_xform * Transform3D(shapes[1]);
+                const Vector3 box_size = box->get_size();
+                const AABB bounds = shape_xform.xform(AABB(-box_size * 0.5f, box_size));
+                const Vector3 bounds_center = bounds.get_center();
+
+                // Only boxes that exactly tile the cell footprint can be merged
+                // with their neighbours without changing the collision volume.
+                const bool fills_footprint =
+                    Math::abs(bounds.size.x - cell_size.x) < EPSILON &&
+                    Math::abs(bounds.size.z - cell_size.z) < EPSILON &&
+                    Math::abs(bounds_center.x - cell_xform.origin.x) < EPSILON &&
+                    Math::abs(bounds_center.z - cell_xform.origin.z) < EPSILON;
+
+                if (fills_footprint) {
+                    slabs[{cell.y, quantize(bounds.position.y), quantize(bounds.size.y)}].push_back(Vector2i(cell.x, cell.z));
+                    continue;
+                }
+            }
+        }
+
+        for (int64_t s = 0; s + 1 < shapes.size(); s += 2) {
+            const Ref<Shape3D> shape = shapes[s];
+            if (shape.is_null()) {
+                continue;
+            }
+            CollisionShape3D* collision = memnew(CollisionShape3D);
+            collision->set_shape(shape);
+            collision->set_transform(cell_xform * Transform3D(shapes[s + 1]));
+            body->add_child(collision);
+            ++m_last_shape_count;
+        }
+    }
+
+    // --- greedy-merge each slab into rectangles ---
+    std::vector<MergedBox> boxes{};
+    for (const auto& [key, slab_cells] : slabs) {
+        const real_t bottom = static_cast<real_t>(std::get<1>(key)) / 1000.0f;
+        const real_t height = static_cast<real_t>(std::get<2>(key)) / 1000.0f;
+        const bool full_height = Math::abs(height - cell_size.y) < EPSILON;
+        greedy_rectangles(slab_cells, [&](const int32_t x0, const int32_t z0, const int32_t width, const int32_t depth) {
+            boxes.push_back({x0, z0, width, depth, bottom, height, full_height});
+        });
+    }
+
+    // --- stack identical full-height rectangles on consecutive layers ---
+    if (m_merge_vertically && !boxes.empty()) {
+        std::sort(boxes.begin(), boxes.end(), [](const MergedBox& a, const MergedBox& b) {
+            return std::tie(a.x0, a.z0, a.width, a.depth, a.full_height, a.bottom) <
+                   std::tie(b.x0, b.z0, b.width, b.depth, b.full_height, b.bottom);
+        });
+
+        std::vector<MergedBox> stacked{};
+        stacked.reserve(boxes.size());
+        for (const MergedBox& box : boxes) {
+            if (!stacked.empty()) {
+                MergedBox& top = stacked.back();
+                const bool same_footprint = top.x0 == box.x0 && top.z0 == box.z0 &&
+                                            top.width == box.width && top.depth == box.depth;
+                if (same_footprint && top.full_height && box.full_height &&
+                    Math::abs(top.bottom + top.height - box.bottom) < EPSILON) {
+                    top.height += box.height;
+                    continue;
+                }
+            }
+            stacked.push_back(box);
+        }
+        boxes.swap(stacked);
+    }
+
+    for (const MergedBox& box : boxes) {
+        // Cell centres of the two opposite corners give the rectangle centre
+        // regardless of the GridMap's per-axis centring flags.
+        const Vector3 first = grid_map->map_to_local(Vector3i(box.x0, 0, box.z0));
+        const Vector3 last = grid_map->map_to_local(Vector3i(box.x0 + box.width - 1, 0, box.z0 + box.depth - 1));
+
+        Ref<BoxShape3D> shape;
+        shape.instantiate();
+        shape->set_size(Vector3(cell_size.x * box.width, box.height, cell_size.z * box.depth));
+
+        CollisionShape3D* collision = memnew(CollisionShape3D);
+        collision->set_shape(shape);
+        collision->set_position(Vector3((first.x + last.x) * 0.5f, box.bottom + box.height * 0.5f, (first.z + last.z) * 0.5f));
+        body->add_child(collision);
+        ++m_last_shape_count;
+    }
+
+    // --- one MultiMesh per meshlib item ---
+    for (const auto& [item, transforms] : instances) {
+        Ref<MultiMesh> multimesh;
+        multimesh.instantiate();
+        multimesh->set_transform_format(MultiMesh::TRANSFORM_3D);
+        multimesh->set_mesh(library->get_item_mesh(item));
+        multimesh->set_instance_count(static_cast<int32_t>(transforms.size()));
+        for (size_t t = 0; t < transforms.size(); ++t) {
+            multimesh->set_instance_transform(static_cast<int32_t>(t), transforms[t]);
+        }
+
+        MultiMeshInstance3D* instance = memnew(MultiMeshInstance3D);
+        instance->set_name(String("Item") + String::num_int64(item));
+        instance->set_multimesh(multimesh);
+        root->add_child(instance);
+        ++m_last_multimesh_count;
+    }
+
+    if (m_replace_source && grid_map->get_parent() != nullptr) {
+        grid_map->get_parent()->add_child(root);
+        grid_map->set_visible(false);
+        grid_map->set_collision_layer(0);
+        grid_map->set_collision_mask(0);
+    }
+    return root;
+}
+
+// ---------------------------------------------------------------------------
+// Setters / getters
+// ---------------------------------------------------------------------------
+
+void GridMapBaker::set_replace_source(const bool enabled) {
+    m_replace_source = enabled;
+}
+
+bool GridMapBaker::get_replace_source() const {
+    return m_replace_source;
+}
+
+void GridMapBaker::set_merge_vertically(const bool enabled) {
+    m_merge_vertically = enabled;
+}
+
+bool GridMapBaker::get_merge_vertically() const {
+    return m_merge_vertically;
+}
+
+int GridMapBaker::get_last_cell_count() const {
+    return m_last_cell_count;
+}
+
+int GridMapBaker::get_last_shape_count() const {
+    return m_last_shape_count;
+}
+
+int GridMapBaker::get_last_multimesh_count() const {
+    return m_last_multimesh_count;
+}
+
+} // namespace Rebel::Room
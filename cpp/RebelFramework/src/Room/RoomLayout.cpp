@@ -0,0 +1,427 @@
+// Copyright (c) 2026, and future.
+// Alejandro Morcillo Montejo - All Rights Reserved
+
+#include "Rebel/Room/RoomLayout.hpp"
+
+#include <godot_cpp/core/class_db.hpp>
+#include <godot_cpp/variant/transform3d.hpp>
+#include <godot_cpp/variant/utility_functions.hpp>
+
+#include <cstring>
+
+using namespace godot;
+
+namespace Rebel::Room {
+
+namespace {
+
+// ---------------------------------------------------------------------------
+// Blob layout
+//
+//   Header        32 bytes
+//   SectionEntry  16 bytes x section_count
+//   Sections      each aligned to SECTION_ALIGNMENT, POD records
+// ---------------------------------------------------------------------------
+
+constexpr char MAGIC[4] = {'R', 'L', 'A', 'Y'};
+constexpr uint64_t SECTION_ALIGNMENT = 16;
+
+enum SectionKind : uint32_t {
+    SECTION_CELLS = 1,
+    SECTION_SPAWN_POINTS = 2,
+    SECTION_PROPS = 3,
+    SECTION_NAV_VERTICES = 4,
+    SECTION_NAV_INDICES = 5,
+    SECTION_COUNT = 5,
+};
+
+struct Header {
+    char magic[4];
+    uint32_t format_version;
+    uint32_t generator_version;
+    uint32_t section_count;
+    uint64_t seed;
+    uint64_t total_size;
+};
+static_assert(sizeof(Header) == 32);
+
+struct SectionEntry {
+    uint32_t kind;
+    uint32_t count;
+    uint64_t offset;
+};
+static_assert(sizeof(SectionEntry) == 16);
+
+constexpr uint64_t align_up(const uint64_t value) {
+    return (value + SECTION_ALIGNMENT - 1) & ~(SECTION_ALIGNMENT - 1);
+}
+
+template <typename T>
+std::span<const T> view_section(const PackedByteArray& blob, const SectionEntry& entry) {
+    return {reinterpret_cast<const T*>(blob.ptr() + entry.offset), entry.count};
+}
+
+} // namespace
+
+// ---------------------------------------------------------------------------
+// _bind_methods
+// ---------------------------------------------------------------------------
+
+void RoomLayout::_bind_methods() {
+    ClassDB::bind_static_method("RoomLayout", D_METHOD("from_bytes", "bytes"), &RoomLayout::from_bytes);
+
+    // --- identity ---
+    ClassDB::bind_method(D_METHOD("set_seed", "seed"), &RoomLayout::set_seed);
+    ClassDB::bind_method(D_METHOD("get_seed"), &RoomLayout::get_seed);
+    ClassDB::bind_method(D_METHOD("set_generator_version", "version"), &RoomLayout::set_generator_version);
+    ClassDB::bind_method(D_METHOD("get_generator_version"), &RoomLayout::get_generator_version);
+
+    // --- content ---
+    ClassDB::bind_method(D_METHOD("set_cells", "cells"), &RoomLayout::set_cells);
+    ClassDB::bind_method(D_METHOD("get_cells"), &RoomLayout::get_cells);
+    ClassDB::bind_method(D_METHOD("set_spawn_points", "points"), &RoomLayout::set_spawn_points);
+    ClassDB::bind_method(D_METHOD("get_spawn_points"), &RoomLayout::get_spawn_points);
+    ClassDB::bind_method(D_METHOD("set_props", "ids", "transforms"), &RoomLayout::set_props);
+    ClassDB::bind_method(D_METHOD("get_prop_ids"), &RoomLayout::get_prop_ids);
+    ClassDB::bind_method(D_METHOD("get_prop_transforms"), &RoomLayout::get_prop_transforms);
+    ClassDB::bind_method(D_METHOD("set_navigation", "vertices", "indices"), &RoomLayout::set_navigation);
+    ClassDB::bind_method(D_METHOD("get_nav_vertices"), &RoomLayout::get_nav_vertices);
+    ClassDB::bind_method(D_METHOD("get_nav_indices"), &RoomLayout::get_nav_indices);
+
+    // --- serialization ---
+    ClassDB::bind_method(D_METHOD("pack"), &RoomLayout::pack);
+    ClassDB::bind_method(D_METHOD("is_packed"), &RoomLayout::is_packed);
+    ClassDB::bind_method(D_METHOD("get_bytes"), &RoomLayout::get_bytes);
+
+    ADD_PROPERTY(PropertyInfo(Variant::INT, "seed"),              "set_seed",              "get_seed");
+    ADD_PROPERTY(PropertyInfo(Variant::INT, "generator_version"), "set_generator_version", "get_generator_version");
+}
+
+// ---------------------------------------------------------------------------
+// from_bytes
+// ---------------------------------------------------------------------------
+
+Ref<RoomLayout> RoomLayout::from_bytes(const PackedByteArray& bytes) {
+    Ref<RoomLayout> layout;
+    layout.instantiate();
+    layout->m_blob = bytes;
+    if (!layout->fix_up()) {
+        return {};
+    }
+    return layout;
+}
+
+// ---------------------------------------------------------------------------
+// Setters / getters
+// ---------------------------------------------------------------------------
+
+void RoomLayout::set_seed(const int64_t seed) {
+    unpack();
+    m_seed = static_cast<uint64_t>(seed);
+}
+
+int64_t RoomLayout::get_seed() const {
+    return static_cast<int64_t>(m_seed);
+}
+
+void RoomLayout::set_generator_version(const int version) {
+    unpack();
+    m_generator_version = static_cast<uint32_t>(Math::max(0, version));
+}
+
+int RoomLayout::get_generator_version() const {
+    return static_cast<int>(m_generator_version);
+}
+
+void RoomLayout::set_cells(const PackedInt32Array& cells) {
+    unpack();
+    if (cells.size() % 5 != 0) {
+        UtilityFunctions::push_warning("[RoomLayout] cells must hold 5 ints per cell; trailing values ignored.");
+    }
+    m_staged_cells = cells;
+    m_staged_cells.resize(cells.size() - cells.size() % 5);
+}
+
+PackedInt32Array RoomLayout::get_cells() const {
+    if (!is_packed()) {
+        return m_staged_cells;
+    }
+    PackedInt32Array result{};
+    result.resize(static_cast<int64_t>(m_cells.size()) * 5);
+    int32_t* out = result.ptrw();
+    for (const CellRecord& cell : m_cells) {
+        *out++ = cell.x;
+        *out++ = cell.y;
+        *out++ = cell.z;
+        *out++ = cell.item;
+        *out++ = cell.orientation;
+    }
+    return result;
+}
+
+void RoomLayout::set_spawn_points(const PackedVector3Array& points) {
+    unpack();
+    m_staged_spawn_points = points;
+}
+
+PackedVector3Array RoomLayout::get_spawn_points() const {
+    if (!is_packed()) {
+        return m_staged_spawn_points;
+    }
+    PackedVector3Array result{};
+    result.resize(static_cast<int64_t>(m_spawn_points.size()));
+    Vector3* out = result.ptrw();
+    for (const Vec3Record& point : m_spawn_points) {
+        *out++ = Vector3(point.x, point.y, point.z);
+    }
+    return result;
+}
+
+void RoomLayout::set_props(const PackedInt32Array& ids, const Array& transforms) {
+    unpack();
+    if (ids.size() != transforms.size()) {
+        UtilityFunctions::push_warning("[RoomLayout] set_props: ids and transforms differ in length; extra entries ignored.");
+    }
+    const int64_t count = Math::min(ids.size(), transforms.size());
+    m_staged_prop_ids = ids;
+    m_staged_prop_ids.resize(count);
+    m_staged_prop_transforms = transforms.slice(0, count);
+}
+
+PackedInt32Array RoomLayout::get_prop_ids() const {
+    if (!is_packed()) {
+        return m_staged_prop_ids;
+    }
+    PackedInt32Array result{};
+    result.resize(static_cast<int64_t>(m_props.size()));
+    int32_t* out = result.ptrw();
+    for (const PropRecord& prop : m_props) {
+        *out++ = prop.id;
+    }
+    return result;
+}
+
+Array RoomLayout::get_prop_transforms() const {
+    if (!is_packed()) {
+        return m_staged_prop_transforms;
+    }
+    Array result{};
+    result.resize(static_cast<int64_t>(m_props.size()));
+    for (size_t i = 0; i < m_props.size(); ++i) {
+        const PropRecord& prop = m_props[i];
+        const Basis basis(prop.basis[0], prop.basis[1], prop.basis[2],
+                          prop.basis[3], prop.basis[4], prop.basis[5],
+                          prop.basis[6], prop.basis[7], prop.basis[8]);
+        result[static_cast<int64_t>(i)] = Transform3D(basis, Vector3(prop.origin[0], prop.origin[1], prop.origin[2]));
+    }
+    return result;
+}
+
+void RoomLayout::set_navigation(const PackedVector3Array& vertices, const PackedInt32Array& indices) {
+    unpack();
+    m_staged_nav_vertices = vertices;
+    m_staged_nav_indices = indices;
+}
+
+PackedVector3Array RoomLayout::get_nav_vertices() const {
+    if (!is_packed()) {
+        return m_staged_nav_vertices;
+    }
+    PackedVector3Array result{};
+    result.resize(static_cast<int64_t>(m_nav_vertices.size()));
+    Vector3* out = result.ptrw();
+    for (const Vec3Record& vertex : m_nav_vertices) {
+        *out++ = Vector3(vertex.x, vertex.y, vertex.z);
+    }
+    return result;
+}
+
+PackedInt32Array RoomLayout::get_nav_indices() const {
+    if (!is_packed()) {
+        return m_staged_nav_indices;
+    }
+    PackedInt32Array result{};
+    result.resize(static_cast<int64_t>(m_nav_indices.size()));
+    std::memcpy(result.ptrw(), m_nav_indices.data(), m_nav_indices.size_bytes());
+    return result;
+}
+
+// ---------------------------------------------------------------------------
+// Serialization
+// ---------------------------------------------------------------------------
+
+void RoomLayout::pack() {
+    if (is_packed()) {
+        return;
+    }
+
+    const uint32_t counts[SECTION_COUNT] = {
+        static_cast<uint32_t>(m_staged_cells.size() / 5),
+        static_cast<uint32_t>(m_staged_spawn_points.size()),
+        static_cast<uint32_t>(m_staged_prop_ids.size()),
+        static_cast<uint32_t>(m_staged_nav_vertices.size()),
+        static_cast<uint32_t>(m_staged_nav_indices.size()),
+    };
+    const uint64_t strides[SECTION_COUNT] = {
+        sizeof(CellRecord), sizeof(Vec3Record), sizeof(PropRecord), sizeof(Vec3Record), sizeof(int32_t),
+    };
+
+    // Lay out the section table, then each section at an aligned offset.
+    SectionEntry entries[SECTION_COUNT]{};
+    uint64_t cursor = align_up(sizeof(Header) + sizeof(SectionEntry) * SECTION_COUNT);
+    for (uint32_t i = 0; i < SECTION_COUNT; ++i) {
+        entries[i] = {i + 1, counts[i], cursor};
+        cursor = align_up(cursor + strides[i] * counts[i]);
+    }
+
+    PackedByteArray blob{};
+    blob.resize(static_cast<int64_t>(cursor));
+    uint8_t* base = blob.ptrw();
+    std::memset(base, 0, cursor);
+
+    Header header{};
+    std::memcpy(header.magic, MAGIC, sizeof(MAGIC));
+    header.format_version = FORMAT_VERSION;
+    header.generator_version = m_generator_version;
+    header.section_count = SECTION_COUNT;
+    header.seed = m_seed;
+    header.total_size = cursor;
+    std::memcpy(base, &header, sizeof(Header));
+    std::memcpy(base + sizeof(Header), entries, sizeof(entries));
+
+    auto* cells = reinterpret_cast<CellRecord*>(base + entries[SECTION_CELLS - 1].offset);
+    const int32_t* cell_src = m_staged_cells.ptr();
+    for (uint32_t i = 0; i < counts[SECTION_CELLS - 1]; ++i, cell_src += 5) {
+        cells[i] = {cell_src[0], cell_src[1], cell_src[2],
+                    static_cast<int16_t>(cell_src[3]), static_cast<uint8_t>(cell_src[4]), 0};
+    }
+
+    auto* spawns = reinterpret_cast<Vec3Record*>(base + entries[SECTION_SPAWN_POINTS - 1].offset);
+    const Vector3* spawn_src = m_staged_spawn_points.ptr();
+    for (uint32_t i = 0; i < counts[SECTION_SPAWN_POINTS - 1]; ++i) {
+        const Vector3& p = spawn_src[i];
+        spawns[i] = {static_cast<float>(p.x), static_cast<float>(p.y), static_cast<float>(p.z)};
+    }
+
+    auto* props = reinterpret_cast<PropRecord*>(base + entries[SECTION_PROPS - 1].offset);
+    const int32_t* prop_id_src = m_staged_prop_ids.ptr();
+    for (uint32_t i = 0; i < counts[SECTION_PROPS - 1]; ++i) {
+        const Transform3D xform = m_staged_prop_transforms[i];
+        PropRecord& record = props[i];
+        record.id = prop_id_src[i];
+        for (int row = 0; row < 3; ++row) {
+            for (int col = 0; col < 3; ++col) {
+                record.basis[row * 3 + col] = static_cast<float>(xform.basis.rows[row][col]);
+            }
+            record.origin[row] = static_cast<float>(xform.origin[row]);
+        }
+    }
+
+    auto* nav_vertices = reinterpret_cast<Vec3Record*>(base + entries[SECTION_NAV_VERTICES - 1].offset);
+    const Vector3* vertex_src = m_staged_nav_vertices.ptr();
+    for (uint32_t i = 0; i < counts[SECTION_NAV_VERTICES - 1]; ++i) {
+        const Vector3& v = vertex_src[i];
+        nav_vertices[i] = {static_cast<float>(v.x), static_cast<float>(v.y), static_cast<float>(v.z)};
+    }
+
+    std::memcpy(base + entries[SECTION_NAV_INDICES - 1].offset, m_staged_nav_indices.ptr(),
+                sizeof(int32_t) * counts[SECTION_NAV_INDICES - 1]);
+
+    m_blob = blob;
+    fix_up();
+
+    // The blob is now the single source of truth.
+    m_staged_cells.clear();
+    m_staged_spawn_points.clear();
+    m_staged_prop_ids.clear();
+    m_staged_prop_transforms.clear();
+    m_staged_nav_vertices.clear();
+    m_staged_nav_indices.clear();
+}
+
+bool RoomLayout::is_packed() const {
+    return !m_blob.is_empty();
+}
+
+PackedByteArray RoomLayout::get_bytes() {
+    pack();
+    return m_blob;
+}
+
+// ---------------------------------------------------------------------------
+// Private helpers
+// ---------------------------------------------------------------------------
+
+bool RoomLayout::fix_up() {
+    const uint64_t size = static_cast<uint64_t>(m_blob.size());
+    if (size < sizeof(Header)) {
+        m_blob.clear();
+        return false;
+    }
+
+    Header header{};
+    std::memcpy(&header, m_blob.ptr(), sizeof(Header));
+    if (std::memcmp(header.magic, MAGIC, sizeof(MAGIC)) != 0 ||
+        header.format_version != FORMAT_VERSION ||
+        header.total_size != size ||
+        sizeof(Header) + sizeof(SectionEntry) * static_cast<uint64_t>(header.section_count) > size) {
+        m_blob.clear();
+        return false;
+    }
+
+    m_seed = header.seed;
+    m_generator_version = header.generator_version;
+
+    const auto* entries = reinterpret_cast<const SectionEntry*>(m_blob.ptr() + sizeof(Header));
+    for (uint32_t i = 0; i < header.section_count; ++i) {
+        const SectionEntry& entry = entries[i];
+        uint64_t stride = 0;
+        switch (entry.kind) {
+            case SECTION_CELLS:        stride = sizeof(CellRecord); break;
+            case SECTION_SPAWN_POINTS: stride = sizeof(Vec3Record); break;
+            case SECTION_PROPS:        stride = sizeof(PropRecord); break;
+            case SECTION_NAV_VERTICES: stride = sizeof(Vec3Record); break;
+            case SECTION_NAV_INDICES:  stride = sizeof(int32_t);    break;
+            default: continue; // Unknown sections are skipped for forward compatibility.
+        }
+        // Division form: offset and count come from disk, and the sum could wrap.
+        if (entry.offset % SECTION_ALIGNMENT != 0 || entry.offset > size || entry.count > (size - entry.offset) / stride) {
+            m_blob.clear();
+            return false;
+        }
+
+        switch (entry.kind) {
+            case SECTION_CELLS:        m_cells = view_section<CellRecord>(m_blob, entry); break;
+            case SECTION_SPAWN_POINTS: m_spawn_points = view_section<Vec3Record>(m_blob, entry); break;
+            case SECTION_PROPS:        m_props = view_section<PropRecord>(m_blob, entry); break;
+            case SECTION_NAV_VERTICES: m_nav_vertices = view_section<Vec3Record>(m_blob, entry); break;
+            case SECTION_NAV_INDICES:  m_nav_indices = view_section<int32_t>(m_blob, entry); break;
+            default: break;
+        }
+    }
+    return true;
+}
+
+void RoomLayout::unpack() {
+    if (!is_packed()) {
+        return;
+    }
+
+    // Copy the records back into staging arrays so a partial edit of a cached
+    // layout keeps the other sections.
+    m_staged_cells = get_cells();
+    m_staged_spawn_points = get_spawn_points();
+    m_staged_prop_ids = get_prop_ids();
+    m_staged_prop_transforms = get_prop_transforms();
+    m_staged_nav_vertices = get_nav_vertices();
+    m_staged_nav_indices = get_nav_indices();
+
+    m_cells = {};
+    m_spawn_points = {};
+    m_props = {};
+    m_nav_vertices = {};
+    m_nav_indices = {};
+    m_blob.clear();
+}
+
+} // namespace Rebel::Room
@@ -0,0 +1,105 @@
+// Copyright (c) 2026, and future.
+// Alejandro Morcillo Montejo - All Rights Reserved
+
+#include "Rebel/Room/RoomLayoutCache.hpp"
+
+#include <godot_cpp/classes/dir_access.hpp>
+#include <godot_cpp/classes/file_access.hpp>
+#include <godot_cpp/core/class_db.hpp>
+
+using namespace godot;
+
+namespace Rebel::Room {
+
+// ---------------------------------------------------------------------------
+// _bind_methods
+// ---------------------------------------------------------------------------
+
+void RoomLayoutCache::_bind_methods() {
+    ClassDB::bind_method(D_METHOD("set_cache_dir", "path"), &RoomLayoutCache::set_cache_dir);
+    ClassDB::bind_method(D_METHOD("get_cache_dir"), &RoomLayoutCache::get_cache_dir);
+
+    ClassDB::bind_method(D_METHOD("store_layout", "layout"), &RoomLayoutCache::store_layout);
+    ClassDB::bind_method(D_METHOD("load_layout", "seed", "generator_version"), &RoomLayoutCache::load_layout);
+    ClassDB::bind_method(D_METHOD("has_layout", "seed", "generator_version"), &RoomLayoutCache::has_layout);
+    ClassDB::bind_method(D_METHOD("erase_layout", "seed", "generator_version"), &RoomLayoutCache::erase_layout);
+
+    ADD_PROPERTY(PropertyInfo(Variant::STRING, "cache_dir", PROPERTY_HINT_DIR), "set_cache_dir", "get_cache_dir");
+}
+
+// ---------------------------------------------------------------------------
+// Setters / getters
+// ---------------------------------------------------------------------------
+
+void RoomLayoutCache::set_cache_dir(const String& path) {
+    m_cache_dir = path;
+}
+
+String RoomLayoutCache::get_cache_dir() const {
+    return m_cache_dir;
+}
+
+// ---------------------------------------------------------------------------
+// Cache operations
+// ---------------------------------------------------------------------------
+
+Error RoomLayoutCache::store_layout(const Ref<RoomLayout>& layout) {
+    if (layout.is_null()) {
+        return ERR_INVALID_PARAMETER;
+    }
+
+    const Error dir_err = DirAccess::make_dir_recursive_absolute(m_cache_dir);
+    if (dir_err != OK && dir_err != ERR_ALREADY_EXISTS) {
+        return dir_err;
+    }
+
+    const PackedByteArray bytes = layout->get_bytes();
+    const String path = get_layout_path(layout->get_seed(), layout->get_generator_version());
+
+    const Ref<FileAccess> file = FileAccess::open(path, FileAccess::WRITE);
+    if (file.is_null()) {
+        return FileAccess::get_open_error();
+    }
+    file->store_buffer(bytes);
+    return file->get_error();
+}
+
+Ref<RoomLayout> RoomLayoutCache::load_layout(const int64_t seed, const int generator_version) const {
+    const String path = get_layout_path(seed, generator_version);
+    if (!FileAccess::file_exists(path)) {
+        return {};
+    }
+
+    // One read of the whole file; RoomLayout keeps the buffer and points into it.
+    const Ref<RoomLayout> layout = RoomLayout::from_bytes(FileAccess::get_file_as_bytes(path));
+    if (layout.is_null() ||
+        layout->get_seed() != seed ||
+        layout->get_generator_version() != generator_version) {
+        return {};
+    }
+    return layout;
+}
+
+bool RoomLayoutCache::has_layout(const int64_t seed, const int generator_version) const {
+    return FileAccess::file_exists(get_layout_path(seed, generator_version));
+}
+
+Error RoomLayoutCache::erase_layout(const int64_t seed, const int generator_version) {
+    const String path = get_layout_path(seed, generator_version);
+    if (!FileAccess::file_exists(path)) {
+        return OK;
+    }
+    return DirAccess::remove_absolute(path);
+}
+
+// ---------------------------------------------------------------------------
+// Private helpers
+// ---------------------------------------------------------------------------
+
+String RoomLayoutCache::get_layout_path(const int64_t seed, const int generator_version) const {
+    const String file_name = String::num_uint64(static_cast<uint64_t>(seed), 16).lpad(16, "0") +
+                             "_g" + String::num_int64(generator_version) + ".rlay";
+    return m_cache_dir.path_join(file_name);
+}
+
+} // namespace Rebel::Room
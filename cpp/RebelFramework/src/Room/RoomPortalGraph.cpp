@@ -0,0 +1,265 @@
+// Copyright (c) 2026, and future.
+// Alejandro Morcillo Montejo - All Rights Reserved
+
+#include "Rebel/Room/RoomPortalGraph.hpp"
+
+#include <godot_cpp/classes/engine.hpp>
+#include <godot_cpp/core/class_db.hpp>
+
+using namespace godot;
+
+namespace Rebel::Room {
+
+// ---------------------------------------------------------------------------
+// _bind_methods
+// ---------------------------------------------------------------------------
+
+void RoomPortalGraph::_bind_methods() {
+    ClassDB::bind_method(D_METHOD("add_room", "room_root", "bounds"), &RoomPortalGraph::add_room);
+    ClassDB::bind_method(D_METHOD("remove_room", "room_id"), &RoomPortalGraph::remove_room);
+    ClassDB::bind_method(D_METHOD("add_portal", "room_a", "room_b", "open"), &RoomPortalGraph::add_portal, DEFVAL(true));
+    ClassDB::bind_method(D_METHOD("set_portal_open", "portal_id", "open"), &RoomPortalGraph::set_portal_open);
+    ClassDB::bind_method(D_METHOD("is_portal_open", "portal_id"), &RoomPortalGraph::is_portal_open);
+    ClassDB::bind_method(D_METHOD("clear"), &RoomPortalGraph::clear);
+    ClassDB::bind_method(D_METHOD("update_rooms"), &RoomPortalGraph::update_rooms);
+    ClassDB::bind_method(D_METHOD("get_current_room"), &RoomPortalGraph::get_current_room);
+    ClassDB::bind_method(D_METHOD("get_active_rooms"), &RoomPortalGraph::get_active_rooms);
+
+    // --- target ---
+    ClassDB::bind_method(D_METHOD("set_target", "target"), &RoomPortalGraph::set_target);
+    ClassDB::bind_method(D_METHOD("get_target"), &RoomPortalGraph::get_target);
+
+    // --- max_portal_depth ---
+    ClassDB::bind_method(D_METHOD("set_max_portal_depth", "depth"), &RoomPortalGraph::set_max_portal_depth);
+    ClassDB::bind_method(D_METHOD("get_max_portal_depth"), &RoomPortalGraph::get_max_portal_depth);
+
+    ADD_SIGNAL(MethodInfo("current_room_changed", PropertyInfo(Variant::INT, "room_id")));
+
+    ADD_GROUP("Culling", "");
+    ADD_PROPERTY(PropertyInfo(Variant::OBJECT, "target",           PROPERTY_HINT_NODE_TYPE, "Node3D"), "set_target",           "get_target");
+    ADD_PROPERTY(PropertyInfo(Variant::INT,    "max_portal_depth", PROPERTY_HINT_RANGE, "0,8,1"),      "set_max_portal_depth", "get_max_portal_depth");
+}
+
+void RoomPortalGraph::_notification(const int p_what) {
+    switch (p_what) {
+        case NOTIFICATION_READY:
+            set_process(!Engine::get_singleton()->is_editor_hint());
+            break;
+        case NOTIFICATION_PROCESS:
+            update_rooms();
+            break;
+        default:
+            break;
+    }
+}
+
+// ---------------------------------------------------------------------------
+// Graph construction
+// ---------------------------------------------------------------------------
+
+int RoomPortalGraph::add_room(Node3D* room_root, const AABB& bounds) {
+    ERR_FAIL_NULL_V(room_root, -1);
+
+    RoomEntry room{};
+    room.node_id = room_root->get_instance_id();
+    room.bounds = bounds;
+    m_rooms.push_back(room);
+    m_dirty = true;
+    return static_cast<int>(m_rooms.size()) - 1;
+}
+
+void RoomPortalGraph::remove_room(const int room_id) {
+    ERR_FAIL_COND(!is_valid_room(room_id));
+
+    RoomEntry& room = m_rooms[room_id];
+    for (const int32_t portal_id : room.portals) {
+        m_portals[portal_id].open = false;
+    }
+    room.alive = false;
+    room.node_id = 0;
+    if (m_current_room == room_id) {
+        m_current_room = -1;
+    }
+    m_dirty = true;
+}
+
+int RoomPortalGraph::add_portal(const int room_a, const int room_b, const bool open) {
+    ERR_FAIL_COND_V(!is_valid_room(room_a) || !is_valid_room(room_b), -1);
+
+    const auto portal_id = static_cast<int32_t>(m_portals.size());
+    m_portals.push_back({room_a, room_b, open});
+    m_rooms[room_a].portals.push_back(portal_id);
+    m_rooms[room_b].portals.push_back(portal_id);
+    m_dirty = true;
+    return portal_id;
+}
+
+void RoomPortalGraph::set_portal_open(const int portal_id, const bool open) {
+    ERR_FAIL_INDEX(portal_id, static_cast<int>(m_portals.size()));
+
+    PortalEntry& portal = m_portals[portal_id];
+    if (portal.open == open) {
+        return;
+    }
+    portal.open = open;
+    m_dirty = true;
+}
+
+bool RoomPortalGraph::is_portal_open(const int portal_id) const {
+    ERR_FAIL_INDEX_V(portal_id, static_cast<int>(m_portals.size()), false);
+    return m_portals[portal_id].open;
+}
+
+void RoomPortalGraph::clear() {
+    // Leave every room we touched in its normal, fully active state.
+    for (RoomEntry& room : m_rooms) {
+        if (room.alive && !room.active) {
+            apply_room_state(room, true);
+        }
+    }
+    m_rooms.clear();
+    m_portals.clear();
+    m_current_room = -1;
+    m_dirty = true;
+}
+
+// ---------------------------------------------------------------------------
+// Culling
+// ---------------------------------------------------------------------------
+
+void RoomPortalGraph::update_rooms() {
+    if (m_rooms.empty()) {
+        return;
+    }
+    // Resolved every update: the target may be freed with its scene at any time.
+    const Node3D* target = get_target();
+    if (target == nullptr) {
+        return;
+    }
+
+    const int32_t room = locate(target->get_global_position(), m_current_room);
+    if (room < 0) {
+        // Between rooms (e.g. inside a door frame): keep the last state.
+        return;
+    }
+    if (room == m_current_room && !m_dirty) {
+        return;
+    }
+
+    const bool room_changed = room != m_current_room;
+    m_current_room = room;
+    m_dirty = false;
+
+    // Breadth-first walk through open portals, bounded by max_portal_depth.
+    m_depth.assign(m_rooms.size(), -1);
+    m_frontier.clear();
+    m_frontier.push_back(room);
+    m_depth[room] = 0;
+    for (size_t head = 0; head < m_frontier.size(); ++head) {
+        const int32_t current = m_frontier[head];
+        if (m_depth[current] >= m_max_portal_depth) {
+            continue;
+        }
+        for (const int32_t portal_id : m_rooms[current].portals) {
+            const PortalEntry& portal = m_portals[portal_id];
+            if (!portal.open) {
+                continue;
+            }
+            const int32_t next = portal.room_a == current ? portal.room_b : portal.room_a;
+            if (m_depth[next] < 0 && m_rooms[next].alive) {
+                m_depth[next] = m_depth[current] + 1;
+                m_frontier.push_back(next);
+            }
+        }
+    }
+
+    // Only touch nodes whose state flips.
+    for (size_t i = 0; i < m_rooms.size(); ++i) {
+        RoomEntry& entry = m_rooms[i];
+        const bool active = m_depth[i] >= 0;
+        if (entry.alive && entry.active != active) {
+            apply_room_state(entry, active);
+        }
+    }
+
+    if (room_changed) {
+        emit_signal("current_room_changed", room);
+    }
+}
+
+int32_t RoomPortalGraph::locate(const Vector3& position, const int32_t hint) const {
+    if (hint >= 0 && m_rooms[hint].alive && m_rooms[hint].bounds.has_point(position)) {
+        return hint;
+    }
+    // Neighbours first: the target almost always leaves through a portal.
+    if (hint >= 0) {
+        for (const int32_t portal_id : m_rooms[hint].portals) {
+            const PortalEntry& portal = m_portals[portal_id];
+            const int32_t next = portal.room_a == hint ? portal.room_b : portal.room_a;
+            if (m_rooms[next].alive && m_rooms[next].bounds.has_point(position)) {
+                return next;
+            }
+        }
+    }
+    for (size_t i = 0; i < m_rooms.size(); ++i) {
+        if (m_rooms[i].alive && m_rooms[i].bounds.has_point(position)) {
+            return static_cast<int32_t>(i);
+        }
+    }
+    return -1;
+}
+
+void RoomPortalGraph::apply_room_state(RoomEntry& room, const bool active) {
+    room.active = active;
+    Node3D* root = Object::cast_to<Node3D>(ObjectDB::get_instance(room.node_id));
+    if (root == nullptr) {
+        room.alive = false;
+        return;
+    }
+    // Hiding the root hides every VisualInstance3D below it; disabling its
+    // process mode suspends every character and ability node it contains.
+    root->set_visible(active);
+    root->set_process_mode(active ? PROCESS_MODE_INHERIT : PROCESS_MODE_DISABLED);
+}
+
+// ---------------------------------------------------------------------------
+// Setters / getters
+// ---------------------------------------------------------------------------
+
+int RoomPortalGraph::get_current_room() const {
+    return m_current_room;
+}
+
+PackedInt32Array RoomPortalGraph::get_active_rooms() const {
+    PackedInt32Array result{};
+    for (size_t i = 0; i < m_rooms.size(); ++i) {
+        if (m_rooms[i].alive && m_rooms[i].active) {
+            result.push_back(static_cast<int32_t>(i));
+        }
+    }
+    return result;
+}
+
+void RoomPortalGraph::set_target(Node3D* target) {
+    m_target_id = target != nullptr ? target->get_instance_id() : 0;
+    m_dirty = true;
+}
+
+Node3D* RoomPortalGraph::get_target() const {
+    return m_target_id != 0 ? Object::cast_to<Node3D>(ObjectDB::get_instance(m_target_id)) : nullptr;
+}
+
+void RoomPortalGraph::set_max_portal_depth(const int depth) {
+    m_max_portal_depth = Math::max(0, depth);
+    m_dirty = true;
+}
+
+int RoomPortalGraph::get_max_portal_depth() const {
+    return m_max_portal_depth;
+}
+
+bool RoomPortalGraph::is_valid_room(const int room_id) const {
+    return room_id >= 0 && room_id < static_cast<int>(m_rooms.size()) && m_rooms[room_id].alive;
+}
+
+} // namespace Rebel::Room
@@ -0,0 +1,373 @@
+// Copyright (c) 2026, and future.
+// Alejandro Morcillo Montejo - All Rights Reserved
+
+#include "Rebel/Room/RoomPrefetcher.hpp"
+
+#include <godot_cpp/classes/engine.hpp>
+#include <godot_cpp/classes/os.hpp>
+#include <godot_cpp/classes/resource_loader.hpp>
+#include <godot_cpp/classes/worker_thread_pool.hpp>
+#include <godot_cpp/core/class_db.hpp>
+#include <godot_cpp/variant/callable_method_pointer.hpp>
+#include <godot_cpp/variant/utility_functions.hpp>
+
+using namespace godot;
+
+namespace Rebel::Room {
+
+// ---------------------------------------------------------------------------
+// Constructor / destructor
+// ---------------------------------------------------------------------------
+
+RoomPrefetcher::~RoomPrefetcher() {
+    // Worker tasks capture `this`; never let one outlive the prefetcher.
+    clear();
+}
+
+// ---------------------------------------------------------------------------
+// _bind_methods
+// ---------------------------------------------------------------------------
+
+void RoomPrefetcher::_bind_methods() {
+    ClassDB::bind_method(D_METHOD("prefetch", "scene_paths"), &RoomPrefetcher::prefetch);
+    ClassDB::bind_method(D_METHOD("take", "scene_path"), &RoomPrefetcher::take);
+    ClassDB::bind_method(D_METHOD("is_ready", "scene_path"), &RoomPrefetcher::is_ready);
+    ClassDB::bind_method(D_METHOD("clear"), &RoomPrefetcher::clear);
+
+    // --- budget ---
+    ClassDB::bind_method(D_METHOD("set_max_warm_rooms", "count"), &RoomPrefetcher::set_max_warm_rooms);
+    ClassDB::bind_method(D_METHOD("get_max_warm_rooms"), &RoomPrefetcher::get_max_warm_rooms);
+
+    ClassDB::bind_method(D_METHOD("set_memory_budget_mb", "megabytes"), &RoomPrefetcher::set_memory_budget_mb);
+    ClassDB::bind_method(D_METHOD("get_memory_budget_mb"), &RoomPrefetcher::get_memory_budget_mb);
+
+    ClassDB::bind_method(D_METHOD("set_instantiate_on_worker", "enabled"), &RoomPrefetcher::set_instantiate_on_worker);
+    ClassDB::bind_method(D_METHOD("get_instantiate_on_worker"), &RoomPrefetcher::get_instantiate_on_worker);
+
+    ADD_SIGNAL(MethodInfo("room_prefetched", PropertyInfo(Variant::STRING, "scene_path")));
+
+    ADD_GROUP("Prefetch", "");
+    ADD_PROPERTY(PropertyInfo(Variant::INT,  "max_warm_rooms",        PROPERTY_HINT_RANGE, "1,8,1"),                "set_max_warm_rooms",        "get_max_warm_rooms");
+    ADD_PROPERTY(PropertyInfo(Variant::INT,  "memory_budget_mb",      PROPERTY_HINT_RANGE, "0,8192,1,or_greater"),  "set_memory_budget_mb",      "get_memory_budget_mb");
+    ADD_PROPERTY(PropertyInfo(Variant::BOOL, "instantiate_on_worker"),                                              "set_instantiate_on_worker", "get_instantiate_on_worker");
+}
+
+void RoomPrefetcher::_notification(const int p_what) {
+    switch (p_what) {
+        case NOTIFICATION_READY:
+            // Only poll while something is in flight — see prefetch().
+            set_process(!m_entries.is_empty());
+            break;
+        case NOTIFICATION_PROCESS:
+            poll();
+            break;
+        case NOTIFICATION_EXIT_TREE:
+            clear();
+            break;
+        default:
+            break;
+    }
+}
+
+// ---------------------------------------------------------------------------
+// Public API
+// ---------------------------------------------------------------------------
+
+void RoomPrefetcher::prefetch(const PackedStringArray& scene_paths) {
+    if (Engine::get_singleton()->is_editor_hint()) {
+        return;
+    }
+
+    ResourceLoader* loader = ResourceLoader::get_singleton();
+    for (int i = 0; i < scene_paths.size(); ++i) {
+        const String& path = scene_paths[i];
+        if (path.is_empty() || m_entries.has(path)) {
+            continue;
+        }
+
+        Entry entry{};
+        entry.request_order = ++m_request_counter;
+
+        // use_sub_threads lets the loader fan dependencies (meshes, materials,
+        // meshlibs) out across the pool instead of loading them one by one.
+        const Error err = loader->load_threaded_request(path, "PackedScene", true);
+        if (err != OK) {
+            UtilityFunctions::push_warning("[RoomPrefetcher] Could not start loading '", path, "' (error ", err, ").");
+            entry.state = EntryState::Failed;
+        }
+        m_entries.insert(path, entry);
+    }
+
+    set_process(true);
+}
+
+Node* RoomPrefetcher::take(const String& scene_path) {
+    Entry* entry = m_entries.getptr(scene_path);
+    if (entry == nullptr) {
+        // Never prefetched — behave like a plain load().
+        const Ref<PackedScene> scene = ResourceLoader::get_singleton()->load(scene_path, "PackedScene");
+        return scene.is_valid() ? scene->instantiate() : nullptr;
+    }
+
+    if (entry->state == EntryState::Loading) {
+        // load_threaded_get() blocks until the threaded request completes.
+        entry->scene = ResourceLoader::get_singleton()->load_threaded_get(scene_path);
+        entry->state = entry->scene.is_valid() ? EntryState::Loaded : EntryState::Failed;
+    }
+    if (entry->state == EntryState::Instantiating) {
+        finish_task(scene_path, *entry);
+    }
+
+    Node* instance = entry->instance;
+    entry->instance = nullptr;
+
+    if (instance == nullptr) {
+        Ref<PackedScene> scene = entry->scene;
+        if (scene.is_null()) {
+            scene = ResourceLoader::get_singleton()->load(scene_path, "PackedScene");
+        }
+        if (scene.is_valid()) {
+            instance = scene->instantiate();
+        }
+    }
+
+    m_entries.erase(scene_path);
+
+    // A warm slot may have opened up for a room parked in Loaded state.
+    set_process(!m_entries.is_empty());
+    return instance;
+}
+
+bool RoomPrefetcher::is_ready(const String& scene_path) const {
+    const Entry* entry = m_entries.getptr(scene_path);
+    return entry != nullptr && entry->state == EntryState::Ready;
+}
+
+void RoomPrefetcher::clear() {
+    for (KeyValue<String, Entry>& kv : m_entries) {
+        release_entry(kv.key, kv.value);
+    }
+    m_entries.clear();
+
+    const std::scoped_lock lock(m_results_mutex);
+    for (const KeyValue<String, Node*>& kv : m_results) {
+        memdelete(kv.value);
+    }
+    m_results.clear();
+}
+
+// ---------------------------------------------------------------------------
+// Setters / getters
+// ---------------------------------------------------------------------------
+
+void RoomPrefetcher::set_max_warm_rooms(const int count) {
+    m_max_warm_rooms = Math::max(1, count);
+}
+
+int RoomPrefetcher::get_max_warm_rooms() const {
+    return m_max_warm_rooms;
+}
+
+void RoomPrefetcher::set_memory_budget_mb(const int megabytes) {
+    m_memory_budget_mb = Math::max(0, megabytes);
+    m_over_budget = false;
+}
+
+int RoomPrefetcher::get_memory_budget_mb() const {
+    return m_memory_budget_mb;
+}
+
+void RoomPrefetcher::set_instantiate_on_worker(const bool enabled) {
+    m_instantiate_on_worker = enabled;
+}
+
+bool RoomPrefetcher::get_instantiate_on_worker() const {
+    return m_instantiate_on_worker;
+}
+
+// ---------------------------------------------------------------------------
+// Polling
+// ---------------------------------------------------------------------------
+
+void RoomPrefetcher::poll() {
+    ResourceLoader* loader = ResourceLoader::get_singleton();
+    WorkerThreadPool* pool = WorkerThreadPool::get_singleton();
+
+    // Signals go out after every loop over m_entries: a listener may take()
+    // or clear(), which erases from the map.
+    PackedStringArray finished{};
+    bool in_flight = false;
+    for (KeyValue<String, Entry>& kv : m_entries) {
+        Entry& entry = kv.value;
+
+        if (entry.state == EntryState::Loading) {
+            switch (loader->load_threaded_get_status(kv.key)) {
+                case ResourceLoader::THREAD_LOAD_LOADED:
+                    entry.scene = loader->load_threaded_get(kv.key);
+                    entry.state = entry.scene.is_valid() ? EntryState::Loaded : EntryState::Failed;
+                    break;
+                case ResourceLoader::THREAD_LOAD_IN_PROGRESS:
+                    in_flight = true;
+                    break;
+                default:
+                    UtilityFunctions::push_warning("[RoomPrefetcher] Threaded load of '", kv.key, "' failed.");
+                    entry.state = EntryState::Failed;
+                    break;
+            }
+        }
+
+        if (entry.state == EntryState::Instantiating) {
+            if (pool->is_task_completed(entry.task_id)) {
+                finish_task(kv.key, entry);
+                finished.push_back(kv.key);
+            } else {
+                in_flight = true;
+            }
+        }
+    }
+
+    // Never rebuild in the poll that evicted: the freed memory may not show up
+    // in the process-wide reading yet, and rebuilding would just evict again.
+    if (!enforce_budget()) {
+        schedule_instantiations(finished);
+    }
+
+    // Stop polling once nothing is loading or instantiating. Scenes parked in
+    // Loaded state are picked up again when take() frees a warm slot.
+    if (!in_flight) {
+        for (const KeyValue<String, Entry>& kv : m_entries) {
+            if (kv.value.state == EntryState::Instantiating) {
+                in_flight = true;
+                break;
+            }
+        }
+    }
+    set_process(in_flight);
+
+    for (int64_t i = 0; i < finished.size(); ++i) {
+        emit_signal("room_prefetched", finished[i]);
+    }
+}
+
+void RoomPrefetcher::schedule_instantiations(PackedStringArray& r_finished) {
+    int warm = count_warm();
+    for (KeyValue<String, Entry>& kv : m_entries) {
+        if (warm >= m_max_warm_rooms || is_over_memory_budget()) {
+            return;
+        }
+
+        Entry& entry = kv.value;
+        if (entry.state != EntryState::Loaded) {
+            continue;
+        }
+
+        if (m_instantiate_on_worker) {
+            // PackedScene::instantiate() is safe off the main thread as long as
+            // the result is not inside the SceneTree yet.
+            entry.task_id = WorkerThreadPool::get_singleton()->add_task(
+                callable_mp(this, &RoomPrefetcher::instantiate_task).bind(kv.key, entry.scene),
+                false,
+                "RoomPrefetcher instantiate");
+            entry.state = EntryState::Instantiating;
+        } else {
+            entry.instance = entry.scene->instantiate();
+            entry.state = entry.instance != nullptr ? EntryState::Ready : EntryState::Failed;
+            r_finished.push_back(kv.key);
+        }
+        ++warm;
+    }
+}
+
+void RoomPrefetcher::instantiate_task(const String& scene_path, const Ref<PackedScene>& scene) {
+    Node* instance = scene->instantiate();
+
+    const std::scoped_lock lock(m_results_mutex);
+    m_results.insert(scene_path, instance);
+}
+
+void RoomPrefetcher::finish_task(const String& scene_path, Entry& entry) {
+    WorkerThreadPool::get_singleton()->wait_for_task_completion(entry.task_id);
+    entry.task_id = -1;
+
+    const std::scoped_lock lock(m_results_mutex);
+    Node** result = m_results.getptr(scene_path);
+    entry.instance = result != nullptr ? *result : nullptr;
+    m_results.erase(scene_path);
+
+    entry.state = entry.instance != nullptr ? EntryState::Ready : EntryState::Failed;
+}
+
+// ---------------------------------------------------------------------------
+// Budget
+// ---------------------------------------------------------------------------
+
+bool RoomPrefetcher::enforce_budget() {
+    bool evicted = false;
+    while (count_warm() > m_max_warm_rooms || is_over_memory_budget()) {
+        // Evict the oldest Ready instance; in-flight tasks are left to finish.
+        Entry* oldest = nullptr;
+        for (KeyValue<String, Entry>& kv : m_entries) {
+            if (kv.value.state != EntryState::Ready) {
+                continue;
+            }
+            if (oldest == nullptr || kv.value.request_order < oldest->request_order) {
+                oldest = &kv.value;
+            }
+        }
+        if (oldest == nullptr) {
+            return evicted;
+        }
+
+        // Drop the subtree but keep the PackedScene: take() will instantiate
+        // synchronously, which is still far cheaper than a disk load.
+        memdelete(oldest->instance);
+        oldest->instance = nullptr;
+        oldest->state = EntryState::Loaded;
+        evicted = true;
+    }
+    return evicted;
+}
+
+int RoomPrefetcher::count_warm() const {
+    int warm = 0;
+    for (const KeyValue<String, Entry>& kv : m_entries) {
+        if (kv.value.state == EntryState::Ready || kv.value.state == EntryState::Instantiating) {
+            ++warm;
+        }
+    }
+    return warm;
+}
+
+bool RoomPrefetcher::is_over_memory_budget() {
+    if (m_memory_budget_mb <= 0) {
+        return false;
+    }
+    // Static memory usage is process-wide and only partly ours, so the latch
+    // trips above the budget and only releases below the low-water mark.
+    const uint64_t budget_bytes = static_cast<uint64_t>(m_memory_budget_mb) * 1024u * 1024u;
+    const uint64_t usage = OS::get_singleton()->get_static_memory_usage();
+    if (usage > budget_bytes) {
+        m_over_budget = true;
+    } else if (usage < budget_bytes / 10u * 9u) {
+        m_over_budget = false;
+    }
+    return m_over_budget;
+}
+
+void RoomPrefetcher::release_entry(const String& scene_path, Entry& entry) {
+    if (entry.state == EntryState::Instantiating) {
+        finish_task(scene_path, entry);
+    }
+    if (entry.state == EntryState::Loading) {
+        // There is no cancel for threaded loads; collecting the result drops
+        // our reference and lets the resource cache release it.
+        ResourceLoader::get_singleton()->load_threaded_get(scene_path);
+    }
+    if (entry.instance != nullptr) {
+        memdelete(entry.instance);
+        entry.instance = nullptr;
+    }
+    entry.scene.unref();
+}
+
+} // namespace Rebel::Room
@@ -0,0 +1,436 @@
+// Copyright (c) 2026, and future.
+// Alejandro Morcillo Montejo - All Rights Reserved
+
+#include "Rebel/Timer/TimerServer.hpp"
+
+#include <godot_cpp/classes/engine.hpp>
+#include <godot_cpp/classes/scene_tree.hpp>
+#include <godot_cpp/classes/window.hpp>
+#include <godot_cpp/core/class_db.hpp>
+#include <godot_cpp/variant/callable_method_pointer.hpp>
+
+#include <cmath>
+
+using namespace godot;
+
+namespace Rebel::Timer {
+
+TimerServer* TimerServer::s_singleton = nullptr;
+
+namespace {
+
+constexpr int64_t pack_handle(const uint32_t index, const uint32_t generation) {
+    return static_cast<int64_t>((static_cast<uint64_t>(generation) << 32) | index);
+}
+
+constexpr uint32_t handle_index(const int64_t handle) {
+    return static_cast<uint32_t>(static_cast<uint64_t>(handle) & 0xFFFFFFFFu);
+}
+
+constexpr uint32_t handle_generation(const int64_t handle) {
+    return static_cast<uint32_t>(static_cast<uint64_t>(handle) >> 32);
+}
+
+} // namespace
+
+// ---------------------------------------------------------------------------
+// _bind_methods
+// ---------------------------------------------------------------------------
+
+void TimerServer::_bind_methods() {
+    ClassDB::bind_method(D_METHOD("schedule", "delay", "callback", "period"), &TimerServer::schedule, DEFVAL(0.0));
+    ClassDB::bind_method(D_METHOD("schedule_event", "delay", "tag", "owner", "period"), &TimerServer::schedule_event, DEFVAL(Variant()), DEFVAL(0.0));
+    ClassDB::bind_method(D_METHOD("cancel", "handle"), &TimerServer::cancel);
+    ClassDB::bind_method(D_METHOD("cancel_owned", "owner"), &TimerServer::cancel_owned);
+    ClassDB::bind_method(D_METHOD("is_active", "handle"), &TimerServer::is_active);
+    ClassDB::bind_method(D_METHOD("get_remaining", "handle"), &TimerServer::get_remaining);
+    ClassDB::bind_method(D_METHOD("advance", "seconds"), &TimerServer::advance);
+    ClassDB::bind_method(D_METHOD("get_timer_count"), &TimerServer::get_timer_count);
+    ClassDB::bind_method(D_METHOD("set_tick_rate", "ticks_per_second"), &TimerServer::set_tick_rate);
+    ClassDB::bind_method(D_METHOD("get_tick_rate"), &TimerServer::get_tick_rate);
+
+    ADD_PROPERTY(PropertyInfo(Variant::INT, "tick_rate", PROPERTY_HINT_RANGE, "1,1000,1"), "set_tick_rate", "get_tick_rate");
+
+    ADD_SIGNAL(MethodInfo("timers_fired",
+        PropertyInfo(Variant::PACKED_INT64_ARRAY, "handles"),
+        PropertyInfo(Variant::PACKED_INT32_ARRAY, "tags"),
+        PropertyInfo(Variant::ARRAY, "owners")));
+}
+
+TimerServer::TimerServer() {
+    s_singleton = this;
+    m_buckets.fill(NIL);
+}
+
+TimerServer::~TimerServer() {
+    if (s_singleton == this) {
+        s_singleton = nullptr;
+    }
+}
+
+TimerServer* TimerServer::get_singleton() {
+    return s_singleton;
+}
+
+// ---------------------------------------------------------------------------
+// Scheduling
+// ---------------------------------------------------------------------------
+
+int64_t TimerServer::schedule_native(const double delay, const NativeCallback callback, void* context, const uint64_t payload, const double period) {
+    ERR_FAIL_NULL_V(callback, 0);
+    const int64_t handle = allocate(Kind::Native, delay, period);
+    TimerRecord& timer = m_timers[handle_index(handle)];
+    timer.callback = callback;
+    timer.context = context;
+    timer.payload = payload;
+    return handle;
+}
+
+int64_t TimerServer::schedule(const double delay, const Callable& callback, const double period) {
+    ERR_FAIL_COND_V_MSG(!callback.is_valid(), 0, "[TimerServer] schedule: invalid callback.");
+    const int64_t handle = allocate(Kind::Callable, delay, period);
+    const uint32_t index = handle_index(handle);
+    m_timers[index].owner_id = callback.get_object_id();
+    m_callables[index] = callback;
+    return handle;
+}
+
+int64_t TimerServer::schedule_event(const double delay, const int tag, Object* owner, const double period) {
+    const int64_t handle = allocate(Kind::Event, delay, period);
+    TimerRecord& timer = m_timers[handle_index(handle)];
+    timer.payload = static_cast<uint32_t>(tag);
+    timer.owner_id = owner != nullptr ? owner->get_instance_id() : 0;
+    return handle;
+}
+
+int64_t TimerServer::allocate(const Kind kind, const double delay, const double period) {
+    connect_tree(Object::cast_to<SceneTree>(Engine::get_singleton()->get_main_loop()));
+
+    uint32_t index;
+    if (!m_free_timers.empty()) {
+        index = m_free_timers.back();
+        m_free_timers.pop_back();
+    } else {
+        index = static_cast<uint32_t>(m_timers.size());
+        m_timers.emplace_back();
+        m_callables.emplace_back();
+    }
+
+    TimerRecord& timer = m_timers[index];
+    const uint32_t generation = timer.generation;
+    timer = TimerRecord{};
+    timer.generation = generation;
+    timer.kind = kind;
+    timer.expiry = m_tick + to_ticks(delay);
+    timer.period = period > 0.0 ? to_ticks(period) : 0;
+
+    link(index);
+    ++m_active_count;
+    return pack_handle(index, generation);
+}
+
+uint64_t TimerServer::to_ticks(const double seconds) const {
+    // Round up so a timer never fires early; at least one tick so it never
+    // fires inside the tick that scheduled it.
+    const double ticks = std::ceil(Math::max(seconds, 0.0) / m_tick_length - 1e-6);
+    if (ticks >= static_cast<double>(MAX_DELAY_TICKS)) {
+        return MAX_DELAY_TICKS;
+    }
+    return Math::max<uint64_t>(static_cast<uint64_t>(ticks), 1);
+}
+
+bool TimerServer::cancel(const int64_t handle) {
+    const uint32_t index = record_of(handle);
+    if (index == NIL) {
+        return false;
+    }
+    release(index);
+    return true;
+}
+
+int TimerServer::cancel_owned(Object* owner) {
+    if (owner == nullptr) {
+        return 0;
+    }
+    const uint64_t owner_id = owner->get_instance_id();
+    int cancelled = 0;
+    for (uint32_t index = 0; index < m_timers.size(); ++index) {
+        if (m_timers[index].kind != Kind::Free && m_timers[index].owner_id == owner_id) {
+            release(index);
+            ++cancelled;
+        }
+    }
+    return cancelled;
+}
+
+uint32_t TimerServer::record_of(const int64_t handle) const {
+    const uint32_t index = handle_index(handle);
+    if (index >= m_timers.size() || m_timers[index].generation != handle_generation(handle) || m_timers[index].kind == Kind::Free) {
+        return NIL;
+    }
+    return index;
+}
+
+// ---------------------------------------------------------------------------
+// Wheel
+// ---------------------------------------------------------------------------
+
+void TimerServer::link(const uint32_t index) {
+    TimerRecord& timer = m_timers[index];
+    const uint64_t delta = timer.expiry > m_tick ? timer.expiry - m_tick : 0;
+
+    // Level L holds timers due within 256^(L+1) ticks, bucketed by the
+    // expiry bits of that level. A timer due this very tick (only possible
+    // while cascading) lands in the level-0 bucket about to be fired.
+    int level = 0;
+    while (level < WHEEL_LEVELS - 1 && delta >= (uint64_t{1} << (WHEEL_BITS * (level + 1)))) {
+        ++level;
+    }
+    const uint32_t slot = static_cast<uint32_t>(timer.expiry >> (WHEEL_BITS * level)) & (WHEEL_SIZE - 1);
+    const auto bucket = static_cast<uint16_t>(level * WHEEL_SIZE + slot);
+
+    timer.bucket = bucket;
+    timer.prev = NIL;
+    timer.next = m_buckets[bucket];
+    if (timer.next != NIL) {
+        m_timers[timer.next].prev = index;
+    }
+    m_buckets[bucket] = index;
+}
+
+void TimerServer::unlink(const uint32_t index) {
+    TimerRecord& timer = m_timers[index];
+    if (timer.bucket == NO_BUCKET) {
+        return;
+    }
+    if (timer.prev != NIL) {
+        m_timers[timer.prev].next = timer.next;
+    } else {
+        m_buckets[timer.bucket] = timer.next;
+    }
+    if (timer.next != NIL) {
+        m_timers[timer.next].prev = timer.prev;
+    }
+    timer.next = NIL;
+    timer.prev = NIL;
+    timer.bucket = NO_BUCKET;
+}
+
+void TimerServer::release(const uint32_t index) {
+    unlink(index);
+    TimerRecord& timer = m_timers[index];
+    timer.kind = Kind::Free;
+    timer.callback = nullptr;
+    timer.context = nullptr;
+    // Bumping the generation invalidates every handle still referring to the record.
+    ++timer.generation;
+    m_callables[index] = Callable();
+    m_free_timers.push_back(index);
+    --m_active_count;
+}
+
+void TimerServer::run_tick() {
+    ++m_tick;
+
+    // Each time a level's bits roll over, pull the next bucket of the level
+    // above down — lower levels first, as upper cascades never land in a
+    // bucket that was already pulled this tick.
+    for (int level = 1; level < WHEEL_LEVELS; ++level) {
+        if ((m_tick & ((uint64_t{1} << (WHEEL_BITS * level)) - 1)) != 0) {
+            break;
+        }
+        cascade(level, static_cast<uint32_t>(m_tick >> (WHEEL_BITS * level)) & (WHEEL_SIZE - 1));
+    }
+
+    const uint32_t bucket = static_cast<uint32_t>(m_tick) & (WHEEL_SIZE - 1);
+    if (m_buckets[bucket] == NIL) {
+        return;
+    }
+
+    // Detach the whole bucket first: callbacks may schedule or cancel timers.
+    m_firing.clear();
+    for (uint32_t index = m_buckets[bucket]; index != NIL;) {
+        TimerRecord& timer = m_timers[index];
+        const uint32_t next = timer.next;
+        timer.next = NIL;
+        timer.prev = NIL;
+        timer.bucket = NO_BUCKET;
+        m_firing.emplace_back(index, timer.generation);
+        index = next;
+    }
+    m_buckets[bucket] = NIL;
+
+    // fire() may re-enter run_tick() through advance(); iterate a private copy.
+    std::vector<std::pair<uint32_t, uint32_t>> firing{};
+    firing.swap(m_firing);
+    for (const auto& [index, generation] : firing) {
+        fire(index, generation);
+    }
+    firing.clear();
+    m_firing.swap(firing);
+}
+
+void TimerServer::cascade(const int level, const uint32_t slot) {
+    const uint32_t bucket = level * WHEEL_SIZE + slot;
+    uint32_t index = m_buckets[bucket];
+    m_buckets[bucket] = NIL;
+    while (index != NIL) {
+        const uint32_t next = m_timers[index].next;
+        link(index);
+        index = next;
+    }
+}
+
+void TimerServer::fire(const uint32_t index, const uint32_t generation) {
+    if (m_timers[index].generation != generation || m_timers[index].kind == Kind::Free) {
+        return; // Cancelled by an earlier callback in the same tick.
+    }
+
+    const int64_t handle = pack_handle(index, generation);
+    switch (m_timers[index].kind) {
+        case Kind::Native: {
+            // Copy out: the callback may schedule timers and grow m_timers.
+            const TimerRecord& timer = m_timers[index];
+            const NativeCallback callback = timer.callback;
+            void* context = timer.context;
+            const uint64_t payload = timer.payload;
+            callback(context, handle, payload);
+            break;
+        }
+        case Kind::Callable: {
+            // Copy: the callback may schedule timers and grow m_callables.
+            const Callable callback = m_callables[index];
+            if (!callback.is_valid()) {
+                release(index);
+                return;
+            }
+            callback.call();
+            break;
+        }
+        case Kind::Event: {
+            const TimerRecord& timer = m_timers[index];
+            Object* owner = nullptr;
+            if (timer.owner_id != 0) {
+                owner = ObjectDB::get_instance(timer.owner_id);
+                if (owner == nullptr) {
+                    release(index);
+                    return;
+                }
+            }
+            m_event_handles.push_back(handle);
+            m_event_tags.push_back(static_cast<int32_t>(timer.payload));
+            m_event_owners.push_back(owner);
+            break;
+        }
+        case Kind::Free:
+            break;
+    }
+
+    // The callback may have cancelled (and even reused) the record.
+    TimerRecord& timer = m_timers[index];
+    if (timer.generation != generation || timer.kind == Kind::Free || timer.bucket != NO_BUCKET) {
+        return;
+    }
+    if (timer.period > 0) {
+        timer.expiry = m_tick + timer.period;
+        link(index);
+    } else {
+        release(index);
+    }
+}
+
+void TimerServer::flush_events() {
+    if (m_event_handles.is_empty()) {
+        return;
+    }
+    // Swap the batch out so events fired by signal handlers go to the next flush.
+    const PackedInt64Array handles = m_event_handles;
+    const PackedInt32Array tags = m_event_tags;
+    const Array owners = m_event_owners;
+    m_event_handles = PackedInt64Array();
+    m_event_tags = PackedInt32Array();
+    m_event_owners = Array();
+    emit_signal("timers_fired", handles, tags, owners);
+}
+
+// ---------------------------------------------------------------------------
+// Time
+// ---------------------------------------------------------------------------
+
+void TimerServer::advance(const double seconds) {
+    if (seconds <= 0.0) {
+        return;
+    }
+    m_accumulator += seconds;
+    const auto ticks = static_cast<uint64_t>(m_accumulator / m_tick_length);
+    m_accumulator -= static_cast<double>(ticks) * m_tick_length;
+
+    if (m_active_count == 0) {
+        // Nothing to fire or cascade — just move the clock.
+        m_tick += ticks;
+        return;
+    }
+    for (uint64_t i = 0; i < ticks; ++i) {
+        run_tick();
+    }
+    flush_events();
+}
+
+void TimerServer::connect_tree(SceneTree* tree) {
+    if (tree == nullptr || tree->get_instance_id() == m_tree_id) {
+        return;
+    }
+    m_tree_id = tree->get_instance_id();
+    const Callable callable = callable_mp(this, &TimerServer::process_frame);
+    if (!tree->is_connected("process_frame", callable)) {
+        tree->connect("process_frame", callable);
+    }
+}
+
+void TimerServer::process_frame() {
+    // Advance at most once per frame, even if the signal is connected twice.
+    const uint64_t frame = Engine::get_singleton()->get_process_frames();
+    if (frame == m_last_frame) {
+        return;
+    }
+    m_last_frame = frame;
+
+    const auto* tree = Object::cast_to<SceneTree>(ObjectDB::get_instance(m_tree_id));
+    if (tree == nullptr || tree->get_root() == nullptr || tree->is_paused()) {
+        return;
+    }
+    advance(tree->get_root()->get_process_delta_time());
+}
+
+// ---------------------------------------------------------------------------
+// Queries
+// ---------------------------------------------------------------------------
+
+bool TimerServer::is_active(const int64_t handle) const {
+    return record_of(handle) != NIL;
+}
+
+double TimerServer::get_remaining(const int64_t handle) const {
+    const uint32_t index = record_of(handle);
+    if (index == NIL || m_timers[index].expiry <= m_tick) {
+        return 0.0;
+    }
+    const double remaining = static_cast<double>(m_timers[index].expiry - m_tick) * m_tick_length - m_accumulator;
+    return Math::max(remaining, 0.0);
+}
+
+int TimerServer::get_timer_count() const {
+    return m_active_count;
+}
+
+void TimerServer::set_tick_rate(const int ticks_per_second) {
+    m_tick_rate = Math::clamp(ticks_per_second, 1, 1000);
+    m_tick_length = 1.0 / m_tick_rate;
+    m_accumulator = Math::min(m_accumulator, m_tick_length);
+}
+
+int TimerServer::get_tick_rate() const {
+    return m_tick_rate;
+}
+
+} // namespace Rebel::Timer
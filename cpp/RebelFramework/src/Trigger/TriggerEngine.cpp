@@ -0,0 +1,455 @@
+// Copyright (c) 2026, and future.
+// Alejandro Morcillo Montejo - All Rights Reserved
+
+#include "Rebel/Trigger/TriggerEngine.hpp"
+
+#include <godot_cpp/classes/engine.hpp>
+#include <godot_cpp/classes/node3d.hpp>
+#include <godot_cpp/core/class_db.hpp>
+#include <godot_cpp/variant/callable_method_pointer.hpp>
+#include <godot_cpp/variant/dictionary.hpp>
+#include <godot_cpp/variant/typed_array.hpp>
+
+#include <algorithm>
+
+using namespace godot;
+
+namespace Rebel::Trigger {
+
+TriggerEngine* TriggerEngine::s_singleton = nullptr;
+
+namespace {
+
+constexpr const char* BUILTIN_CHANNEL_NAMES[TriggerEngine::CHANNEL_BUILTIN_COUNT] = {
+    "attack1_released",
+    "attack2_released",
+    "dodge_performed",
+    "hit",
+    "kill",
+    "pickup",
+};
+
+constexpr uint64_t pack_location(const int channel, const uint32_t index) {
+    return (static_cast<uint64_t>(channel) << 32) | index;
+}
+
+/** Character signals forwarded by watch_character(). */
+constexpr const char* WATCHED_SIGNALS[] = {"attack1_released", "attack2_released", "dodge_performed"};
+
+Vector3 position_of(Object* object) {
+    const auto* node = Object::cast_to<Node3D>(object);
+    return node != nullptr && node->is_inside_tree() ? node->get_global_position() : Vector3();
+}
+
+} // namespace
+
+// ---------------------------------------------------------------------------
+// _bind_methods
+// ---------------------------------------------------------------------------
+
+void TriggerEngine::_bind_methods() {
+    ClassDB::bind_method(D_METHOD("register_channel", "name"), &TriggerEngine::register_channel);
+    ClassDB::bind_method(D_METHOD("get_channel", "name"), &TriggerEngine::get_channel);
+    ClassDB::bind_method(D_METHOD("subscribe", "channel", "handler", "chance", "source"), &TriggerEngine::subscribe, DEFVAL(1.0f), DEFVAL(Variant()));
+    ClassDB::bind_method(D_METHOD("unsubscribe", "subscription"), &TriggerEngine::unsubscribe);
+    ClassDB::bind_method(D_METHOD("unsubscribe_owned", "owner"), &TriggerEngine::unsubscribe_owned);
+    ClassDB::bind_method(D_METHOD("emit", "channel", "source", "target", "amount", "position"), &TriggerEngine::emit, DEFVAL(0.0f), DEFVAL(Vector3()));
+    ClassDB::bind_method(D_METHOD("resolve"), &TriggerEngine::resolve);
+    ClassDB::bind_method(D_METHOD("watch_character", "character"), &TriggerEngine::watch_character);
+    ClassDB::bind_method(D_METHOD("unwatch_character", "character"), &TriggerEngine::unwatch_character);
+    ClassDB::bind_method(D_METHOD("set_seed", "seed"), &TriggerEngine::set_seed);
+    ClassDB::bind_method(D_METHOD("get_pending_events"), &TriggerEngine::get_pending_events);
+    ClassDB::bind_method(D_METHOD("get_proc_count"), &TriggerEngine::get_proc_count);
+    ClassDB::bind_method(D_METHOD("get_dropped_count"), &TriggerEngine::get_dropped_count);
+    ClassDB::bind_method(D_METHOD("get_subscriber_count", "channel"), &TriggerEngine::get_subscriber_count);
+
+    // --- limits ---
+    ClassDB::bind_method(D_METHOD("set_max_depth", "depth"), &TriggerEngine::set_max_depth);
+    ClassDB::bind_method(D_METHOD("get_max_depth"), &TriggerEngine::get_max_depth);
+    ClassDB::bind_method(D_METHOD("set_proc_budget", "procs"), &TriggerEngine::set_proc_budget);
+    ClassDB::bind_method(D_METHOD("get_proc_budget"), &TriggerEngine::get_proc_budget);
+
+    ADD_PROPERTY(PropertyInfo(Variant::INT, "max_depth",   PROPERTY_HINT_RANGE, "0,16,1"),                "set_max_depth",   "get_max_depth");
+    ADD_PROPERTY(PropertyInfo(Variant::INT, "proc_budget", PROPERTY_HINT_RANGE, "1,4096,1,or_greater"),   "set_proc_budget", "get_proc_budget");
+
+    BIND_ENUM_CONSTANT(CHANNEL_ATTACK1_RELEASED);
+    BIND_ENUM_CONSTANT(CHANNEL_ATTACK2_RELEASED);
+    BIND_ENUM_CONSTANT(CHANNEL_DODGE_PERFORMED);
+    BIND_ENUM_CONSTANT(CHANNEL_HIT);
+    BIND_ENUM_CONSTANT(CHANNEL_KILL);
+    BIND_ENUM_CONSTANT(CHANNEL_PICKUP);
+    BIND_ENUM_CONSTANT(CHANNEL_BUILTIN_COUNT);
+}
+
+TriggerEngine::TriggerEngine() {
+    s_singleton = this;
+    for (const char* name : BUILTIN_CHANNEL_NAMES) {
+        register_channel(name);
+    }
+}
+
+TriggerEngine::~TriggerEngine() {
+    if (s_singleton == this) {
+        s_singleton = nullptr;
+    }
+}
+
+TriggerEngine* TriggerEngine::get_singleton() {
+    return s_singleton;
+}
+
+// ---------------------------------------------------------------------------
+// Channels
+// ---------------------------------------------------------------------------
+
+int TriggerEngine::register_channel(const StringName& name) {
+    if (const int32_t* id = m_channel_ids.getptr(name)) {
+        return *id;
+    }
+    const auto id = static_cast<int32_t>(m_tables.size());
+    m_tables.emplace_back();
+    m_channel_ids.insert(name, id);
+    return id;
+}
+
+int TriggerEngine::get_channel(const StringName& name) const {
+    const int32_t* id = m_channel_ids.getptr(name);
+    return id != nullptr ? *id : -1;
+}
+
+// ---------------------------------------------------------------------------
+// Subscriptions
+// ---------------------------------------------------------------------------
+
+int64_t TriggerEngine::subscribe(const int channel, const Callable& handler, const float chance, Object* source) {
+    ERR_FAIL_COND_V_MSG(!handler.is_valid(), 0, "[TriggerEngine] subscribe: invalid handler.");
+
+    uint32_t callable_index;
+    if (!m_free_callables.empty()) {
+        callable_index = m_free_callables.back();
+        m_free_callables.pop_back();
+        m_callables[callable_index] = handler;
+    } else {
+        callable_index = static_cast<uint32_t>(m_callables.size());
+        m_callables.push_back(handler);
+    }
+
+    Subscriber subscriber{};
+    subscriber.callable = callable_index;
+    subscriber.chance = chance;
+    subscriber.source_filter = source != nullptr ? source->get_instance_id() : 0;
+    subscriber.owner_id = handler.get_object_id();
+    const int64_t id = add_subscriber(channel, subscriber);
+    if (id == 0) {
+        m_callables[callable_index] = Callable();
+        m_free_callables.push_back(callable_index);
+    }
+    return id;
+}
+
+int64_t TriggerEngine::subscribe_native(const int channel, const NativeHandler handler, void* context, const float chance, const uint64_t source_id) {
+    ERR_FAIL_NULL_V(handler, 0);
+    Subscriber subscriber{};
+    subscriber.handler = handler;
+    subscriber.context = context;
+    subscriber.chance = chance;
+    subscriber.source_filter = source_id;
+    return add_subscriber(channel, subscriber);
+}
+
+int64_t TriggerEngine::add_subscriber(const int channel, Subscriber subscriber) {
+    ERR_FAIL_INDEX_V(channel, static_cast<int>(m_tables.size()), 0);
+
+    subscriber.id = m_next_subscription++;
+    subscriber.chance = Math::clamp(subscriber.chance, 0.0f, 1.0f);
+
+    std::vector<Subscriber>& table = m_tables[channel];
+    m_locations.insert(subscriber.id, pack_location(channel, static_cast<uint32_t>(table.size())));
+    table.push_back(subscriber);
+    return subscriber.id;
+}
+
+bool TriggerEngine::unsubscribe(const int64_t subscription) {
+    const uint64_t* location = m_locations.getptr(subscription);
+    if (location == nullptr) {
+        return false;
+    }
+    remove_at(static_cast<int>(*location >> 32), static_cast<uint32_t>(*location & 0xFFFFFFFFu));
+    return true;
+}
+
+int TriggerEngine::unsubscribe_owned(Object* owner) {
+    if (owner == nullptr) {
+        return 0;
+    }
+    const uint64_t owner_id = owner->get_instance_id();
+    int removed = 0;
+    for (int channel = 0; channel < static_cast<int>(m_tables.size()); ++channel) {
+        // Walk backwards: swap-remove only moves entries we already visited.
+        for (int64_t index = static_cast<int64_t>(m_tables[channel].size()) - 1; index >= 0; --index) {
+            const Subscriber& subscriber = m_tables[channel][index];
+            if (subscriber.id != 0 && subscriber.owner_id == owner_id) {
+                remove_at(channel, static_cast<uint32_t>(index));
+                ++removed;
+            }
+        }
+    }
+    return removed;
+}
+
+void TriggerEngine::remove_at(const int channel, const uint32_t index) {
+    std::vector<Subscriber>& table = m_tables[channel];
+    Subscriber& subscriber = table[index];
+    m_locations.erase(subscriber.id);
+    if (subscriber.callable != NO_CALLABLE) {
+        m_callables[subscriber.callable] = Callable();
+        m_free_callables.push_back(subscriber.callable);
+    }
+
+    if (m_resolving) {
+        // dispatch() may be walking this table; leave a tombstone for compact().
+        subscriber = Subscriber{};
+        m_needs_compact = true;
+        return;
+    }
+
+    if (index + 1 != table.size()) {
+        subscriber = table.back();
+        m_locations.insert(subscriber.id, pack_location(channel, index));
+    }
+    table.pop_back();
+}
+
+void TriggerEngine::compact() {
+    for (int channel = 0; channel < static_cast<int>(m_tables.size()); ++channel) {
+        std::vector<Subscriber>& table = m_tables[channel];
+        const size_t before = table.size();
+        std::erase_if(table, [](const Subscriber& subscriber) { return subscriber.id == 0; });
+        if (table.size() == before) {
+            continue;
+        }
+        for (size_t index = 0; index < table.size(); ++index) {
+            m_locations.insert(table[index].id, pack_location(channel, static_cast<uint32_t>(index)));
+        }
+    }
+    m_needs_compact = false;
+}
+
+// ---------------------------------------------------------------------------
+// Events
+// ---------------------------------------------------------------------------
+
+void TriggerEngine::emit(const int channel, Object* source, Object* target, const float amount, const Vector3& position) {
+    TriggerEvent event{};
+    event.channel = channel;
+    event.source_id = source != nullptr ? source->get_instance_id() : 0;
+    event.target_id = target != nullptr ? target->get_instance_id() : 0;
+    event.amount = amount;
+    event.position = position;
+    emit_event(event);
+}
+
+void TriggerEngine::emit_event(const TriggerEvent& event) {
+    ERR_FAIL_INDEX(event.channel, static_cast<int>(m_tables.size()));
+    if (m_tables[event.channel].empty()) {
+        return; // Nobody listens — don't even queue it.
+    }
+
+    TriggerEvent queued = event;
+    queued.depth = m_dispatch_depth + 1;
+    if (queued.depth > m_max_depth) {
+        begin_frame();
+        ++m_dropped;
+        return;
+    }
+    m_queue.push_back(queued);
+
+    // First event of the tick: flush at the end of it. Deferred calls run
+    // once the current physics or process step is done, so events from
+    // _physics_process() and _process() resolve within the same frame.
+    if (!m_resolving && !m_flush_queued) {
+        m_flush_queued = true;
+        callable_mp(this, &TriggerEngine::resolve).call_deferred();
+    }
+}
+
+void TriggerEngine::resolve() {
+    if (m_resolving) {
+        return;
+    }
+    m_flush_queued = false;
+    if (m_queue.empty()) {
+        return;
+    }
+    begin_frame();
+
+    m_resolving = true;
+    // m_queue grows as handlers emit; index it and copy each event out.
+    for (size_t head = 0; head < m_queue.size(); ++head) {
+        const TriggerEvent event = m_queue[head];
+        dispatch(event);
+    }
+    m_queue.clear();
+    m_dispatch_depth = -1;
+    m_resolving = false;
+
+    if (m_needs_compact) {
+        compact();
+    }
+}
+
+void TriggerEngine::dispatch(const TriggerEvent& event) {
+    m_dispatch_depth = event.depth;
+
+    Object* source = nullptr;
+    Object* target = nullptr;
+    bool objects_fetched = false;
+
+    // Entries appended by handlers are skipped until the next event.
+    const size_t count = m_tables[event.channel].size();
+    for (size_t index = 0; index < count; ++index) {
+        // Copy: handlers may subscribe and reallocate the table.
+        const Subscriber subscriber = m_tables[event.channel][index];
+        if (subscriber.id == 0) {
+            continue;
+        }
+        if (subscriber.source_filter != 0 && subscriber.source_filter != event.source_id) {
+            continue;
+        }
+        if (subscriber.chance < 1.0f && next_random() >= subscriber.chance) {
+            continue;
+        }
+        if (m_procs >= m_proc_budget) {
+            ++m_dropped;
+            continue;
+        }
+        ++m_procs;
+
+        if (subscriber.handler != nullptr) {
+            subscriber.handler(subscriber.context, event);
+            continue;
+        }
+
+        const Callable handler = m_callables[subscriber.callable];
+        if (!handler.is_valid()) {
+            unsubscribe(subscriber.id);
+            continue;
+        }
+        if (!objects_fetched) {
+            source = event.source_id != 0 ? ObjectDB::get_instance(event.source_id) : nullptr;
+            target = event.target_id != 0 ? ObjectDB::get_instance(event.target_id) : nullptr;
+            objects_fetched = true;
+        }
+        handler.call(source, target, event.amount, event.position);
+    }
+}
+
+void TriggerEngine::begin_frame() {
+    const uint64_t frame = Engine::get_singleton()->get_process_frames();
+    if (frame == m_budget_frame) {
+        return;
+    }
+    m_budget_frame = frame;
+    m_procs = 0;
+    m_dropped = 0;
+}
+
+float TriggerEngine::next_random() {
+    m_rng_state ^= m_rng_state >> 12;
+    m_rng_state ^= m_rng_state << 25;
+    m_rng_state ^= m_rng_state >> 27;
+    // Top 24 bits → [0, 1).
+    return static_cast<float>((m_rng_state * 0x2545F4914F6CDD1Dull) >> 40) * (1.0f / 16777216.0f);
+}
+
+// ---------------------------------------------------------------------------
+// Character signals
+// ---------------------------------------------------------------------------
+
+void TriggerEngine::watch_character(Node* character) {
+    ERR_FAIL_NULL(character);
+    unwatch_character(character);
+
+    if (character->has_signal("attack1_released")) {
+        character->connect("attack1_released", callable_mp(this, &TriggerEngine::on_charge_released).bind(CHANNEL_ATTACK1_RELEASED, character));
+    }
+    if (character->has_signal("attack2_released")) {
+        character->connect("attack2_released", callable_mp(this, &TriggerEngine::on_charge_released).bind(CHANNEL_ATTACK2_RELEASED, character));
+    }
+    if (character->has_signal("dodge_performed")) {
+        character->connect("dodge_performed", callable_mp(this, &TriggerEngine::on_dodge_performed).bind(character));
+    }
+}
+
+void TriggerEngine::unwatch_character(Node* character) {
+    if (character == nullptr) {
+        return;
+    }
+    // Bound callables don't compare reliably; match on the target object instead.
+    for (const char* signal : WATCHED_SIGNALS) {
+        if (!character->has_signal(signal)) {
+            continue;
+        }
+        const TypedArray<Dictionary> connections = character->get_signal_connection_list(signal);
+        for (int i = 0; i < connections.size(); ++i) {
+            const Callable callable = Dictionary(connections[i])["callable"];
+            if (callable.get_object_id() == get_instance_id()) {
+                character->disconnect(signal, callable);
+            }
+        }
+    }
+}
+
+void TriggerEngine::on_charge_released(const float charge_level, const int channel, Object* character) {
+    emit(channel, character, nullptr, charge_level, position_of(character));
+}
+
+void TriggerEngine::on_dodge_performed(const Vector2& direction, Object* character) {
+    emit(CHANNEL_DODGE_PERFORMED, character, nullptr, direction.length(), position_of(character));
+}
+
+// ---------------------------------------------------------------------------
+// Settings / stats
+// ---------------------------------------------------------------------------
+
+void TriggerEngine::set_max_depth(const int depth) {
+    m_max_depth = Math::max(depth, 0);
+}
+
+int TriggerEngine::get_max_depth() const {
+    return m_max_depth;
+}
+
+void TriggerEngine::set_proc_budget(const int procs) {
+    m_proc_budget = Math::max(procs, 1);
+}
+
+int TriggerEngine::get_proc_budget() const {
+    return m_proc_budget;
+}
+
+void TriggerEngine::set_seed(const int64_t seed) {
+    m_rng_state = seed != 0 ? static_cast<uint64_t>(seed) : 0x9E3779B97F4A7C15ull;
+}
+
+int TriggerEngine::get_pending_events() const {
+    return static_cast<int>(m_queue.size());
+}
+
+int TriggerEngine::get_proc_count() const {
+    return m_procs;
+}
+
+int TriggerEngine::get_dropped_count() const {
+    return m_dropped;
+}
+
+int TriggerEngine::get_subscriber_count(const int channel) const {
+    ERR_FAIL_INDEX_V(channel, static_cast<int>(m_tables.size()), 0);
+    const std::vector<Subscriber>& table = m_tables[channel];
+    return static_cast<int>(std::count_if(table.begin(), table.end(), [](const Subscriber& subscriber) {
+        return subscriber.id != 0;
+    }));
+}
+
+} // namespace Rebel::Trigger
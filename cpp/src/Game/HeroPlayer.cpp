@@ -32,6 +32,14 @@ void HeroPlayer::_bind_methods() {
         "set_ability_tree",
         "get_ability_tree");
 
+    ClassDB::bind_method(D_METHOD("set_ability_state", "ability_state"), &HeroPlayer::set_ability_state);
+    ClassDB::bind_method(D_METHOD("get_ability_state"), &HeroPlayer::get_ability_state);
+    ClassDB::add_property(
+        "HeroPlayer",
+        PropertyInfo(Variant::OBJECT, "ability_state", PROPERTY_HINT_RESOURCE_TYPE, "AbilityState"),
+        "set_ability_state",
+        "get_ability_state");
+
     // -------------------------------------------------------------------------
     // AnimationTree node property
     // -------------------------------------------------------------------------
@@ -161,12 +169,35 @@ void HeroPlayer::_on_player_movement_changed(
 
 void HeroPlayer::set_ability_tree(const Ref<Rebel::Ability::AbilityTree>& tree) {
     m_abilityTree = tree;
+
+    // Keep the hero's progress pointing at the same tree; a fresh tree with
+    // no state yet gets an empty one, but only at runtime. A state created in
+    // the editor would be saved into the scene and shared by every instance.
+    if (m_abilityTree.is_null()) {
+        return;
+    }
+    if (m_abilityState.is_valid()) {
+        m_abilityState->set_tree(m_abilityTree);
+    } else if (!Engine::get_singleton()->is_editor_hint()) {
+        m_abilityState = m_abilityTree->create_state();
+    }
 }
 
 Ref<Rebel::Ability::AbilityTree> HeroPlayer::get_ability_tree() const {
     return m_abilityTree;
 }
 
+void HeroPlayer::set_ability_state(const Ref<Rebel::Ability::AbilityState>& state) {
+    m_abilityState = state;
+    if (m_abilityState.is_valid() && m_abilityTree.is_valid() && m_abilityState->get_tree().is_null()) {
+        m_abilityState->set_tree(m_abilityTree);
+    }
+}
+
+Ref<Rebel::Ability::AbilityState> HeroPlayer::get_ability_state() const {
+    return m_abilityState;
+}
+
 // -----------------------------------------------------------------------------
 // AnimationTree property
 // -----------------------------------------------------------------------------
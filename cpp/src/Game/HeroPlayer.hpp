@@ -9,6 +9,7 @@
 #include "godot_cpp/variant/string_name.hpp"
 #include "Rebel/CharacterBody/PlayerTopDownCharacterBody3D.hpp"
 #include "Rebel/Ability/AbilityTree.hpp"
+#include "Rebel/Ability/AbilityState.hpp"
 
 namespace GaS {
 
@@ -22,7 +23,8 @@ namespace GaS {
  * ## Editor-Exposed Properties
  *
  * ### Ability Tree
- * - `ability_tree` — The AbilityTree resource that defines the hero's abilities and upgrade paths.
+ * - `ability_tree`  — The AbilityTree resource that defines the hero's abilities and upgrade paths.
+ * - `ability_state` — The hero's own progress through that tree (unlocked nodes, levels).
  *
  * ### Animation Node
  * - `animation_tree` — The AnimationTree node to drive.
@@ -47,6 +49,9 @@ class HeroPlayer : public Rebel::CharacterBody::PlayerTopDownCharacterBody3D {
     /** The AbilityTree resource assigned in the editor. */
     godot::Ref<Rebel::Ability::AbilityTree> m_abilityTree{};
 
+    /** The hero's unlocked nodes and levels; created from m_abilityTree at runtime when none is assigned. */
+    godot::Ref<Rebel::Ability::AbilityState> m_abilityState{};
+
     // -------------------------------------------------------------------------
     // Animation node references
     // -------------------------------------------------------------------------
@@ -131,6 +136,18 @@ public:
      */
     [[nodiscard]] godot::Ref<Rebel::Ability::AbilityTree> get_ability_tree() const;
 
+    /**
+     * @brief Assigns the hero's ability progress (e.g. restored from a save).
+     * @param state The AbilityState resource. May be null to clear.
+     */
+    void set_ability_state(const godot::Ref<Rebel::Ability::AbilityState>& state);
+
+    /**
+     * @brief Returns the hero's ability progress.
+     * @return Ref<AbilityState>, null if no tree is assigned or in the editor.
+     */
+    [[nodiscard]] godot::Ref<Rebel::Ability::AbilityState> get_ability_state() const;
+
     // -------------------------------------------------------------------------
     // AnimationTree property accessors
     // -------------------------------------------------------------------------
@@ -21,12 +21,49 @@
 #include "Rebel/Ability/Ability.hpp"
 #include "Rebel/Ability/AbilityNode.hpp"
 #include "Rebel/Ability/AbilityTree.hpp"
+#include "Rebel/Ability/AbilityState.hpp"
+#include "Rebel/Ability/AbilityRespec.hpp"
+#include "Rebel/Ability/AbilityIconAtlas.hpp"
+#include "Rebel/Ability/AbilityIconAtlasBaker.hpp"
+#include "Rebel/Ability/AbilityTreeView.hpp"
 #include "Rebel/Ability/AbilityScriptContainerNode.hpp"
+#include "Rebel/Ability/AbilityBehaviour.hpp"
+#include "Rebel/Ability/AbilityScheduler.hpp"
+#include "Rebel/Ability/AbilityTaskExecutor.hpp"
+#include "Rebel/Ability/AbilityDatabase.hpp"
+#include "Rebel/Ability/AbilityDatabaseLoader.hpp"
+#include "Rebel/Ability/AbilityDatabaseSaver.hpp"
+#include "Rebel/Ability/AbilityRegistry.hpp"
+#include "Rebel/Room/RoomPrefetcher.hpp"
+#include "Rebel/Room/RoomLayout.hpp"
+#include "Rebel/Room/RoomLayoutCache.hpp"
+#include "Rebel/Room/GridMapBaker.hpp"
+#include "Rebel/Room/RoomPortalGraph.hpp"
+#include "Rebel/Navigation/NavigationBakeService.hpp"
+#include "Rebel/Health/HealthServer.hpp"
+#include "Rebel/Health/HealthComponent.hpp"
+#include "Rebel/Attribute/AttributeDefinition.hpp"
+#include "Rebel/Attribute/AttributeSet.hpp"
+#include "Rebel/Timer/TimerServer.hpp"
+#include "Rebel/Trigger/TriggerEngine.hpp"
+
+#include <godot_cpp/classes/engine.hpp>
+#include <godot_cpp/classes/resource_loader.hpp>
+#include <godot_cpp/classes/resource_saver.hpp>
 
 
 
 using namespace godot;
 
+static Rebel::Ability::AbilityScheduler* ability_scheduler = nullptr;
+static Rebel::Ability::AbilityTaskExecutor* ability_task_executor = nullptr;
+static Ref<Rebel::Ability::AbilityDatabaseLoader> ability_database_loader;
+static Ref<Rebel::Ability::AbilityDatabaseSaver> ability_database_saver;
+static Rebel::Ability::AbilityRegistry* ability_registry = nullptr;
+static Rebel::Health::HealthServer* health_server = nullptr;
+static Rebel::Timer::TimerServer* timer_server = nullptr;
+static Rebel::Trigger::TriggerEngine* trigger_engine = nullptr;
+
 void initialize_gems_and_souls_module(ModuleInitializationLevel p_level) {
 	if (p_level != MODULE_INITIALIZATION_LEVEL_SCENE) {
 		return;
@@ -43,7 +80,59 @@ void initialize_gems_and_souls_module(ModuleInitializationLevel p_level) {
 	GDREGISTER_CLASS(Rebel::Ability::AbilityImprovement);
 	GDREGISTER_CLASS(Rebel::Ability::Ability);
 	GDREGISTER_CLASS(Rebel::Ability::AbilityNode);
+	GDREGISTER_CLASS(Rebel::Ability::AbilityIconAtlas);
 	GDREGISTER_CLASS(Rebel::Ability::AbilityTree);
+	GDREGISTER_CLASS(Rebel::Ability::AbilityState);
+	GDREGISTER_CLASS(Rebel::Ability::AbilityRespec);
+	GDREGISTER_CLASS(Rebel::Ability::AbilityIconAtlasBaker);
+	GDREGISTER_CLASS(Rebel::Ability::AbilityTreeView);
+	GDREGISTER_CLASS(Rebel::Ability::AbilityBehaviour);
+	GDREGISTER_CLASS(Rebel::Ability::AbilityScheduler);
+	ability_scheduler = memnew(Rebel::Ability::AbilityScheduler);
+	Engine::get_singleton()->register_singleton("AbilityScheduler", ability_scheduler);
+	GDREGISTER_CLASS(Rebel::Ability::AbilityTaskExecutor);
+	ability_task_executor = memnew(Rebel::Ability::AbilityTaskExecutor);
+	Engine::get_singleton()->register_singleton("AbilityTaskExecutor", ability_task_executor);
+	GDREGISTER_CLASS(Rebel::Ability::AbilityDatabase);
+	GDREGISTER_CLASS(Rebel::Ability::AbilityDatabaseLoader);
+	GDREGISTER_CLASS(Rebel::Ability::AbilityDatabaseSaver);
+	ability_database_loader.instantiate();
+	ResourceLoader::get_singleton()->add_resource_format_loader(ability_database_loader);
+	ability_database_saver.instantiate();
+	ResourceSaver::get_singleton()->add_resource_format_saver(ability_database_saver);
+	GDREGISTER_CLASS(Rebel::Ability::AbilityRegistry);
+	ability_registry = memnew(Rebel::Ability::AbilityRegistry);
+	Engine::get_singleton()->register_singleton("AbilityRegistry", ability_registry);
+
+	// Room System
+	GDREGISTER_CLASS(Rebel::Room::RoomPrefetcher);
+	GDREGISTER_CLASS(Rebel::Room::RoomLayout);
+	GDREGISTER_CLASS(Rebel::Room::RoomLayoutCache);
+	GDREGISTER_CLASS(Rebel::Room::GridMapBaker);
+	GDREGISTER_CLASS(Rebel::Room::RoomPortalGraph);
+
+	// Navigation
+	GDREGISTER_CLASS(Rebel::Navigation::NavigationBakeService);
+
+	// Health System
+	GDREGISTER_CLASS(Rebel::Health::HealthServer);
+	GDREGISTER_CLASS(Rebel::Health::HealthComponent);
+	health_server = memnew(Rebel::Health::HealthServer);
+	Engine::get_singleton()->register_singleton("HealthServer", health_server);
+
+	// Attribute System
+	GDREGISTER_CLASS(Rebel::Attribute::AttributeDefinition);
+	GDREGISTER_CLASS(Rebel::Attribute::AttributeSet);
+
+	// Timer System
+	GDREGISTER_CLASS(Rebel::Timer::TimerServer);
+	timer_server = memnew(Rebel::Timer::TimerServer);
+	Engine::get_singleton()->register_singleton("TimerServer", timer_server);
+
+	// Trigger System
+	GDREGISTER_CLASS(Rebel::Trigger::TriggerEngine);
+	trigger_engine = memnew(Rebel::Trigger::TriggerEngine);
+	Engine::get_singleton()->register_singleton("TriggerEngine", trigger_engine);
 
 }
 
@@ -51,6 +140,37 @@ void uninitialize_gems_and_souls_module(ModuleInitializationLevel p_level) {
 	if (p_level != MODULE_INITIALIZATION_LEVEL_SCENE) {
 		return;
 	}
+
+	Engine::get_singleton()->unregister_singleton("AbilityRegistry");
+	memdelete(ability_registry);
+	ability_registry = nullptr;
+
+	Rebel::Ability::Ability::free_shared_defaults();
+
+	ResourceLoader::get_singleton()->remove_resource_format_loader(ability_database_loader);
+	ability_database_loader.unref();
+	ResourceSaver::get_singleton()->remove_resource_format_saver(ability_database_saver);
+	ability_database_saver.unref();
+
+	Engine::get_singleton()->unregister_singleton("AbilityScheduler");
+	memdelete(ability_scheduler);
+	ability_scheduler = nullptr;
+
+	Engine::get_singleton()->unregister_singleton("AbilityTaskExecutor");
+	memdelete(ability_task_executor);
+	ability_task_executor = nullptr;
+
+	Engine::get_singleton()->unregister_singleton("HealthServer");
+	memdelete(health_server);
+	health_server = nullptr;
+
+	Engine::get_singleton()->unregister_singleton("TimerServer");
+	memdelete(timer_server);
+	timer_server = nullptr;
+
+	Engine::get_singleton()->unregister_singleton("TriggerEngine");
+	memdelete(trigger_engine);
+	trigger_engine = nullptr;
 }
 
 extern "C" {